@@ -0,0 +1,357 @@
+/**
+ * @file CompiledRationalFunction.h
+ */
+
+#pragma once
+
+#include "FactorizedPolynomial.h"
+#include "RationalFunction.h"
+
+#include <algorithm>
+#include <map>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace carl {
+
+/**
+ * A rational function (or polynomial) that is compiled for the evaluation at many points.
+ *
+ * The numerator and the denominator are stored as products of flat term lists over dense variable indices.
+ * Factors that occur multiple times, for example in the factorizations of the numerator and the denominator of a
+ * rational function over FactorizedPolynomial, are evaluated only once per point, and so are the powers of the variables.
+ *
+ * Points are given as vectors of values in the order of variables(). Evaluation is possible with exact coefficients
+ * and with doubles. The batch evaluation processes blocks of points in a layout the compiler can vectorize and
+ * can distribute the points over multiple threads.
+ */
+template<typename Pol>
+class CompiledRationalFunction {
+public:
+	using CoeffType = typename Pol::CoeffType;
+	/// Number of points that are evaluated together in the batch evaluation of doubles.
+	static constexpr std::size_t BlockSize = 8;
+private:
+	/// A monomial within a term: variable index and exponent.
+	using VarExp = std::pair<std::size_t, carl::exponent>;
+	/// A product of a coefficient and powers of factors.
+	struct Product {
+		CoeffType coeff = constant_one<CoeffType>::get();
+		double doubleCoeff = 1;
+		std::vector<std::pair<std::size_t, carl::exponent>> factors;
+	};
+
+	std::vector<Variable> mVariables;
+	/// Offset of the powers of every variable in the power table.
+	std::vector<std::size_t> mPowerOffsets;
+	std::vector<carl::exponent> mMaxDegrees;
+
+	std::vector<CoeffType> mCoeffs;
+	std::vector<double> mDoubleCoeffs;
+	/// Term i consists of mMonomials[mTermOffsets[i]] to mMonomials[mTermOffsets[i+1]].
+	std::vector<std::size_t> mTermOffsets = {0};
+	std::vector<VarExp> mMonomials;
+	/// Factor i consists of the terms mFactorOffsets[i] to mFactorOffsets[i+1].
+	std::vector<std::size_t> mFactorOffsets = {0};
+
+	Product mNominator;
+	Product mDenominator;
+
+	template<typename T>
+	static T power(T base, carl::exponent exp) {
+		T res = constant_one<T>::get();
+		while (exp > 0) {
+			if (exp & 1) res *= base;
+			exp >>= 1;
+			if (exp > 0) base *= base;
+		}
+		return res;
+	}
+
+	template<typename T>
+	const std::vector<T>& coefficients() const {
+		if constexpr (std::is_same<T, double>::value) return mDoubleCoeffs;
+		else return mCoeffs;
+	}
+	template<typename T>
+	static const T& coefficient(const Product& p) {
+		if constexpr (std::is_same<T, double>::value) return p.doubleCoeff;
+		else return p.coeff;
+	}
+
+	std::size_t variableIndex(Variable var, std::map<Variable, std::size_t>& variableIndex) {
+		auto it = variableIndex.find(var);
+		if (it != variableIndex.end()) return it->second;
+		mVariables.push_back(var);
+		mMaxDegrees.push_back(0);
+		variableIndex.emplace(var, mVariables.size() - 1);
+		return mVariables.size() - 1;
+	}
+
+	template<typename P>
+	std::size_t addFactor(const P& poly, std::unordered_map<P, std::size_t>& factorIndex, std::map<Variable, std::size_t>& variableIndex) {
+		auto it = factorIndex.find(poly);
+		if (it != factorIndex.end()) return it->second;
+		for (const auto& term: poly) {
+			mCoeffs.push_back(term.coeff());
+			mDoubleCoeffs.push_back(carl::toDouble(term.coeff()));
+			if (term.monomial()) {
+				for (const auto& ve: *term.monomial()) {
+					std::size_t id = this->variableIndex(ve.first, variableIndex);
+					mMonomials.emplace_back(id, ve.second);
+					mMaxDegrees[id] = std::max(mMaxDegrees[id], ve.second);
+				}
+			}
+			mTermOffsets.push_back(mMonomials.size());
+		}
+		mFactorOffsets.push_back(mCoeffs.size());
+		std::size_t id = mFactorOffsets.size() - 2;
+		factorIndex.emplace(poly, id);
+		return id;
+	}
+
+	template<typename RawPol>
+	void compile(const Pol& p, Product& res, std::unordered_map<RawPol, std::size_t>& factorIndex, std::map<Variable, std::size_t>& variableIndex) {
+		if constexpr (needs_cache<Pol>::value) {
+			res.coeff = p.coefficient();
+			if (existsFactorization(p)) {
+				if (p.factorizedTrivially()) {
+					res.factors.emplace_back(addFactor(p.polynomial(), factorIndex, variableIndex), 1);
+				} else {
+					for (const auto& factor: p.factorization()) {
+						res.coeff *= carl::pow(factor.first.coefficient(), factor.second);
+						res.factors.emplace_back(addFactor(factor.first.polynomial(), factorIndex, variableIndex), factor.second);
+					}
+				}
+			}
+		} else {
+			if (p.isConstant()) {
+				res.coeff = p.constantPart();
+			} else {
+				res.factors.emplace_back(addFactor(p, factorIndex, variableIndex), 1);
+			}
+		}
+		res.doubleCoeff = carl::toDouble(res.coeff);
+	}
+
+	/// Sorts the variables and builds the power table layout.
+	void finalize() {
+		std::vector<std::size_t> order(mVariables.size());
+		for (std::size_t i = 0; i < order.size(); ++i) order[i] = i;
+		std::sort(order.begin(), order.end(), [this](std::size_t lhs, std::size_t rhs) { return mVariables[lhs] < mVariables[rhs]; });
+		std::vector<std::size_t> position(order.size());
+		std::vector<Variable> variables(order.size());
+		std::vector<carl::exponent> degrees(order.size());
+		for (std::size_t i = 0; i < order.size(); ++i) {
+			position[order[i]] = i;
+			variables[i] = mVariables[order[i]];
+			degrees[i] = mMaxDegrees[order[i]];
+		}
+		mVariables = std::move(variables);
+		mMaxDegrees = std::move(degrees);
+		for (auto& m: mMonomials) m.first = position[m.first];
+
+		std::size_t offset = 0;
+		for (auto d: mMaxDegrees) {
+			mPowerOffsets.push_back(offset);
+			offset += d;
+		}
+		mPowerOffsets.push_back(offset);
+	}
+
+	/**
+	 * Evaluates the factors at a single point.
+	 * @param powers Buffer for the power table, powers[mPowerOffsets[v] + e - 1] holds x_v^e.
+	 * @param factors Buffer for the values of the factors.
+	 */
+	template<typename T>
+	T evaluatePoint(const T* point, std::vector<T>& powers, std::vector<T>& factors) const {
+		powers.resize(mPowerOffsets.back());
+		for (std::size_t v = 0; v < mVariables.size(); ++v) {
+			T cur = point[v];
+			for (std::size_t e = mPowerOffsets[v]; e < mPowerOffsets[v+1]; ++e) {
+				powers[e] = cur;
+				cur *= point[v];
+			}
+		}
+		const auto& coeffs = coefficients<T>();
+		factors.resize(mFactorOffsets.size() - 1);
+		for (std::size_t f = 0; f + 1 < mFactorOffsets.size(); ++f) {
+			T sum = constant_zero<T>::get();
+			for (std::size_t t = mFactorOffsets[f]; t < mFactorOffsets[f+1]; ++t) {
+				T term = coeffs[t];
+				for (std::size_t m = mTermOffsets[t]; m < mTermOffsets[t+1]; ++m) {
+					term *= powers[mPowerOffsets[mMonomials[m].first] + mMonomials[m].second - 1];
+				}
+				sum += term;
+			}
+			factors[f] = sum;
+		}
+		return evaluateProduct(mNominator, factors) / evaluateProduct(mDenominator, factors);
+	}
+	template<typename T>
+	T evaluateProduct(const Product& p, const std::vector<T>& factors) const {
+		T res = coefficient<T>(p);
+		for (const auto& f: p.factors) res *= power(factors[f.first], f.second);
+		return res;
+	}
+
+	/**
+	 * Evaluates a block of BlockSize points, the layout of all buffers is [index][point].
+	 * The loops over the points in the block have a constant trip count and are vectorized by the compiler.
+	 */
+	void evaluateBlock(const std::vector<std::vector<double>>& points, std::size_t begin, double* results, std::vector<double>& powers, std::vector<double>& factors) const {
+		constexpr std::size_t B = BlockSize;
+		std::size_t count = std::min(B, points.size() - begin);
+		powers.resize(mPowerOffsets.back() * B);
+		factors.resize((mFactorOffsets.size() - 1) * B);
+		for (std::size_t v = 0; v < mVariables.size(); ++v) {
+			if (mPowerOffsets[v] == mPowerOffsets[v+1]) continue;
+			double* base = &powers[mPowerOffsets[v] * B];
+			for (std::size_t p = 0; p < B; ++p) base[p] = p < count ? points[begin + p][v] : 0.0;
+			for (std::size_t e = mPowerOffsets[v] + 1; e < mPowerOffsets[v+1]; ++e) {
+				double* cur = &powers[e * B];
+				const double* prev = cur - B;
+				for (std::size_t p = 0; p < B; ++p) cur[p] = prev[p] * base[p];
+			}
+		}
+		double term[B];
+		for (std::size_t f = 0; f + 1 < mFactorOffsets.size(); ++f) {
+			double* sum = &factors[f * B];
+			for (std::size_t p = 0; p < B; ++p) sum[p] = 0;
+			for (std::size_t t = mFactorOffsets[f]; t < mFactorOffsets[f+1]; ++t) {
+				for (std::size_t p = 0; p < B; ++p) term[p] = mDoubleCoeffs[t];
+				for (std::size_t m = mTermOffsets[t]; m < mTermOffsets[t+1]; ++m) {
+					const double* pw = &powers[(mPowerOffsets[mMonomials[m].first] + mMonomials[m].second - 1) * B];
+					for (std::size_t p = 0; p < B; ++p) term[p] *= pw[p];
+				}
+				for (std::size_t p = 0; p < B; ++p) sum[p] += term[p];
+			}
+		}
+		double nom[B];
+		double denom[B];
+		evaluateProductBlock(mNominator, factors, nom);
+		evaluateProductBlock(mDenominator, factors, denom);
+		for (std::size_t p = 0; p < count; ++p) results[begin + p] = nom[p] / denom[p];
+	}
+	void evaluateProductBlock(const Product& prod, const std::vector<double>& factors, double* res) const {
+		constexpr std::size_t B = BlockSize;
+		for (std::size_t p = 0; p < B; ++p) res[p] = prod.doubleCoeff;
+		for (const auto& f: prod.factors) {
+			const double* val = &factors[f.first * B];
+			for (carl::exponent e = 0; e < f.second; ++e) {
+				for (std::size_t p = 0; p < B; ++p) res[p] *= val[p];
+			}
+		}
+	}
+
+	template<typename T>
+	void evaluateRange(const std::vector<std::vector<T>>& points, std::size_t begin, std::size_t end, T* results) const {
+		std::vector<T> powers;
+		std::vector<T> factors;
+		if constexpr (std::is_same<T, double>::value) {
+			for (std::size_t i = begin; i < end; i += BlockSize) {
+				evaluateBlock(points, i, results, powers, factors);
+			}
+		} else {
+			for (std::size_t i = begin; i < end; ++i) {
+				assert(points[i].size() == mVariables.size());
+				results[i] = evaluatePoint(points[i].data(), powers, factors);
+			}
+		}
+	}
+
+public:
+	/**
+	 * Compiles a rational function.
+	 */
+	template<bool AutoSimplify>
+	explicit CompiledRationalFunction(const RationalFunction<Pol, AutoSimplify>& rf) {
+		if (rf.isConstant()) {
+			mNominator.coeff = rf.constantPart();
+			mNominator.doubleCoeff = carl::toDouble(mNominator.coeff);
+			finalize();
+			return;
+		}
+		std::unordered_map<typename Pol::PolyType, std::size_t> factorIndex;
+		std::map<Variable, std::size_t> variableIndex;
+		compile(rf.nominatorAsPolynomial(), mNominator, factorIndex, variableIndex);
+		compile(rf.denominatorAsPolynomial(), mDenominator, factorIndex, variableIndex);
+		finalize();
+	}
+	/**
+	 * Compiles a polynomial, i.e. a rational function with denominator one.
+	 */
+	explicit CompiledRationalFunction(const Pol& p) {
+		std::unordered_map<typename Pol::PolyType, std::size_t> factorIndex;
+		std::map<Variable, std::size_t> variableIndex;
+		compile(p, mNominator, factorIndex, variableIndex);
+		finalize();
+	}
+
+	/**
+	 * @return The variables in the order in which their values are expected.
+	 */
+	const std::vector<Variable>& variables() const {
+		return mVariables;
+	}
+	/**
+	 * @return The number of distinct factors that are evaluated per point.
+	 */
+	std::size_t numberOfFactors() const {
+		return mFactorOffsets.size() - 1;
+	}
+
+	/**
+	 * Evaluates at the given point, either exactly (with CoeffType) or with doubles.
+	 * @param point The values of the variables in the order of variables().
+	 */
+	template<typename T>
+	T evaluate(const std::vector<T>& point) const {
+		assert(point.size() == mVariables.size());
+		std::vector<T> powers;
+		std::vector<T> factors;
+		return evaluatePoint(point.data(), powers, factors);
+	}
+	/**
+	 * Evaluates exactly at the given point, like RationalFunction::evaluate().
+	 */
+	CoeffType evaluate(const std::map<Variable, CoeffType>& substitutions) const {
+		std::vector<CoeffType> point;
+		for (const auto& v: mVariables) point.push_back(substitutions.at(v));
+		return evaluate(point);
+	}
+
+	/**
+	 * Evaluates at all given points.
+	 * @param points The points, each in the order of variables().
+	 * @param threads The number of threads to use, zero for the hardware concurrency.
+	 * @return The values at the points.
+	 */
+	template<typename T>
+	std::vector<T> evaluate(const std::vector<std::vector<T>>& points, std::size_t threads = 1) const {
+		std::vector<T> results(points.size());
+		if (threads == 0) threads = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+		// Chunks are multiples of the block size such that blocks are never split.
+		std::size_t blocks = (points.size() + BlockSize - 1) / BlockSize;
+		threads = std::min(threads, blocks);
+		if (threads <= 1) {
+			evaluateRange(points, 0, points.size(), results.data());
+			return results;
+		}
+		std::size_t chunk = ((blocks + threads - 1) / threads) * BlockSize;
+		std::vector<std::thread> pool;
+		for (std::size_t begin = 0; begin < points.size(); begin += chunk) {
+			std::size_t end = std::min(begin + chunk, points.size());
+			pool.emplace_back([this, &points, &results, begin, end]() {
+				evaluateRange(points, begin, end, results.data());
+			});
+		}
+		for (auto& t: pool) t.join();
+		return results;
+	}
+};
+
+}
@@ -525,15 +525,27 @@ namespace carl
         Definiteness definiteness( bool _fullEffort = true ) const;
 		
 		/**
-		 * Derivative of the factorized polynomial wrt variable x
+		 * Derivative of the factorized polynomial wrt variable x.
+		 * The product rule is applied to the factors, such that the result of p = c * g_1^e_1 * ... * g_n^e_n is factorized as
+		 * c * g_1^(e_1-1) * ... * g_n^(e_n-1) * logDerivativeNominator(_var).
 		 * @param _var main variable
 		 * @param _nth how often should derivative be applied
-		 * 
-		 * @todo only _nth == 1 is supported
-		 * @todo we do not use factorization currently
 		 */
 		FactorizedPolynomial<P> derivative(const carl::Variable& _var, unsigned _nth = 1) const;
 		
+		/**
+		 * For p = c * g_1^e_1 * ... * g_n^e_n computes s = e_1 * g_1' * g_2 * ... * g_n + ... + e_n * g_1 * ... * g_(n-1) * g_n',
+		 * which is the nominator of p'/p = s / (c * g_1 * ... * g_n) wrt variable x.
+		 * @param _var main variable
+		 * @return s
+		 */
+		P logDerivativeNominator(const carl::Variable& _var) const;
+		
+		/**
+		 * @return The product of the distinct factors of this factorized polynomial, with coefficient one.
+		 */
+		FactorizedPolynomial<P> radical() const;
+		
 		/**
 		 * Raise polynomial to the power 
          * @param _exp the exponent of the power
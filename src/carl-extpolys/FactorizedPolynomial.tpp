@@ -7,6 +7,7 @@
 
 #include "FactorizedPolynomial.h"
 
+#include <carl/core/polynomialfunctions/Derivative.h>
 #include <carl/core/polynomialfunctions/Division.h>
 #include <carl/core/polynomialfunctions/Substitution.h>
 #include <carl/core/UnivariatePolynomial.h>
@@ -64,7 +65,6 @@ namespace carl
                 //Factorization is not set yet
                 auto ret = mpCache->cache( pfPair );//, &carl::canBeUpdated, &carl::update );
                 mCacheRef = ret.first;
-                mpCache->reg( mCacheRef );
                 if( ret.second )
                 {
                     assert( content().mFactorization.empty() );
@@ -108,7 +108,6 @@ namespace carl
             PolynomialFactorizationPair<P>* pfPair = new PolynomialFactorizationPair<P>( std::move( _factorization ) );
             auto ret = mpCache->cache( pfPair );//, &carl::canBeUpdated, &carl::update );
             mCacheRef = ret.first;
-            mpCache->reg( mCacheRef );
             if( !ret.second )
             {
                 delete pfPair;
@@ -218,12 +217,6 @@ namespace carl
                 mpCache->reg( mCacheRef );
             }
         }
-        else if( mpCache != nullptr )
-        {
-            mpCache->dereg(mCacheRef);
-            mCacheRef = _fpoly.cacheRef();
-            mpCache->reg( mCacheRef );
-        }
         ASSERT_CACHE_REF_LEGAL( (*this) );
         assert(computePolynomial(*this) == computePolynomial(_fpoly));
         CARL_LOG_DEBUG("carl.core.factorizedpolynomial", "Done.");
@@ -545,16 +538,75 @@ namespace carl
 	template<typename P>
     FactorizedPolynomial<P> FactorizedPolynomial<P>::derivative( const carl::Variable& _var, unsigned _nth ) const
     {
-		assert(_nth == 1);
+		if (_nth == 0) {
+			return *this;
+		}
 		if (this->isConstant()) {
 			return FactorizedPolynomial<P>( constant_zero<CoeffType>::get() );
 		}
-		// TODO VERY NAIVE
-        FactorizedPolynomial<P> result(carl::derivative(polynomial(), _var), mpCache);
-        result *= coefficient();
+		P s = logDerivativeNominator(_var);
+		if (carl::isZero(s)) {
+			return FactorizedPolynomial<P>( constant_zero<CoeffType>::get() );
+		}
+		// p' = c * g_1^(e_1-1) * ... * g_n^(e_n-1) * s
+		Factorization<P> remaining;
+		for (const auto& factor: factorization()) {
+			if (factor.second > 1) {
+				remaining.insert( std::make_pair( factor.first, factor.second - 1 ) );
+			}
+		}
+		FactorizedPolynomial<P> result( s, mpCache );
+		if (!remaining.empty()) {
+			result *= FactorizedPolynomial<P>( std::move(remaining), constant_one<CoeffType>::get(), mpCache );
+		}
+		result *= coefficient();
+		if (_nth > 1) {
+			return result.derivative(_var, _nth - 1);
+		}
 		return result;
 	}
 	
+	template<typename P>
+	P FactorizedPolynomial<P>::logDerivativeNominator( const carl::Variable& _var ) const
+	{
+		if (this->isConstant()) {
+			return P( constant_zero<CoeffType>::get() );
+		}
+		const Factorization<P>& factors = factorization();
+		// suffixes[i] is the product of the factors from the i-th on, such that s is computed with a linear number of multiplications
+		std::vector<P> suffixes( factors.size() + 1, P( constant_one<CoeffType>::get() ) );
+		std::size_t i = factors.size();
+		for (auto factor = factors.rbegin(); factor != factors.rend(); ++factor, --i) {
+			suffixes[i-1] = factor->first.polynomial() * suffixes[i];
+		}
+		P prefix( constant_one<CoeffType>::get() );
+		P result( constant_zero<CoeffType>::get() );
+		i = 0;
+		for (const auto& factor: factors) {
+			const P& g = factor.first.polynomial();
+			P derivative = carl::derivative(g, _var);
+			if (!carl::isZero(derivative)) {
+				result += prefix * derivative * suffixes[i+1] * CoeffType(factor.second);
+			}
+			prefix *= g;
+			++i;
+		}
+		return result;
+	}
+	
+	template<typename P>
+	FactorizedPolynomial<P> FactorizedPolynomial<P>::radical() const
+	{
+		if (this->isConstant()) {
+			return FactorizedPolynomial<P>( constant_one<CoeffType>::get() );
+		}
+		Factorization<P> distinct;
+		for (const auto& factor: factorization()) {
+			distinct.insert( std::make_pair( factor.first, 1 ) );
+		}
+		return FactorizedPolynomial<P>( std::move(distinct), constant_one<CoeffType>::get(), mpCache );
+	}
+	
 	template<typename P>
 	FactorizedPolynomial<P> FactorizedPolynomial<P>::pow(unsigned _exp) const
     {
@@ -7,8 +7,11 @@
 
 #pragma once
 
+#include <array>
+#include <cstdint>
 #include <map>
 #include <mutex>
+#include <unordered_set>
 
 #include <carl/core/Monomial.h>
 
@@ -123,6 +126,45 @@ namespace carl
          * Indicates, if the polynomial is irreducible
          */
         mutable int mIrreducible;
+        
+        /**
+         * The polynomial factorization pairs whose polynomials are known to be coprime to the polynomial of this pair.
+         * This relation is symmetric and a pair removes itself from the sets of its partners when it is destroyed.
+         * The set holds at most coprimeCapacity partners, hence the memo is freed together with the cache entry and its size is bounded.
+         */
+        mutable std::unordered_set<const PolynomialFactorizationPair<P>*> mCoprimePairs;
+        
+        /// The maximal number of partners remembered in mCoprimePairs.
+        static constexpr std::size_t coprimeCapacity = 64;
+        
+        /// The number of mutexes the coprime sets are striped over.
+        static constexpr std::size_t coprimeStripes = 64;
+        
+        /**
+         * The mutex guarding mCoprimePairs of the pair at the given address. No lock other than a second stripe is acquired while holding it.
+         * The mutexes are striped by address instead of being members, as a destructor updates the sets of its partners, which may be destroyed concurrently.
+         * Only the address of a pair is used, hence the stripe of a partner that is already gone can still be locked.
+         */
+        static std::mutex& coprimeMutex( const PolynomialFactorizationPair<P>* _pfPair )
+        {
+            static std::array<std::mutex, coprimeStripes> mutexes;
+            auto address = reinterpret_cast<std::uintptr_t>( _pfPair );
+            return mutexes[(address / alignof(PolynomialFactorizationPair<P>)) % coprimeStripes];
+        }
+        
+        /**
+         * Locks the stripes of two pairs without deadlocking against other threads locking the same stripes.
+         */
+        static std::pair<std::unique_lock<std::mutex>, std::unique_lock<std::mutex>> lockCoprime( const PolynomialFactorizationPair<P>* _pfPairA, const PolynomialFactorizationPair<P>* _pfPairB )
+        {
+            std::unique_lock<std::mutex> lockA( coprimeMutex( _pfPairA ), std::defer_lock );
+            std::unique_lock<std::mutex> lockB( coprimeMutex( _pfPairB ), std::defer_lock );
+            if( lockA.mutex() == lockB.mutex() )
+                lockA.lock();
+            else
+                std::lock( lockA, lockB );
+            return std::make_pair( std::move( lockA ), std::move( lockB ) );
+        }
 
         template<typename P1>
         friend P1 computePolynomial( const Factorization<P1>& );
@@ -184,6 +226,22 @@ namespace carl
         void setNewFactors( const FactorizedPolynomial<P>& _fpolyA, carl::exponent exponentA, const FactorizedPolynomial<P>& _fpolyB, carl::exponent exponentB ) const;
 
         bool isIrreducible() const;
+        
+        /**
+         * @param _pfPair A polynomial factorization pair.
+         * @return true, if the polynomials of this and the given pair are known to be coprime.
+         */
+        bool knownCoprime( const PolynomialFactorizationPair<P>& _pfPair ) const
+        {
+            std::lock_guard<std::mutex> lock( coprimeMutex( this ) );
+            return mCoprimePairs.find( &_pfPair ) != mCoprimePairs.end();
+        }
+        
+        /**
+         * Remembers that the polynomials of this and the given pair are coprime.
+         * @param _pfPair A polynomial factorization pair.
+         */
+        void setCoprime( const PolynomialFactorizationPair<P>& _pfPair ) const;
 
     public:
         // Constructor.
@@ -88,7 +88,8 @@ namespace carl
 		mMutex(),
         mFactorization( std::move( _factorization ) ),
         mpPolynomial( _polynomial ),
-        mIrreducible( -1 )
+        mIrreducible( -1 ),
+        mCoprimePairs()
     {
         if ( mpPolynomial == nullptr )
         {
@@ -119,8 +120,35 @@ namespace carl
     template<typename P>
     PolynomialFactorizationPair<P>::~PolynomialFactorizationPair()
     {
+        // Partners that are destroyed concurrently erase themselves from mCoprimePairs, hence it is only accessed under the lock.
+        // A partner is alive as long as it is contained in mCoprimePairs.
+        while( true )
+        {
+            const PolynomialFactorizationPair<P>* pfPair = nullptr;
+            {
+                std::lock_guard<std::mutex> lock( coprimeMutex( this ) );
+                if( mCoprimePairs.empty() )
+                    break;
+                pfPair = *mCoprimePairs.begin();
+            }
+            auto locks = lockCoprime( this, pfPair );
+            if( mCoprimePairs.erase( pfPair ) > 0 )
+                pfPair->mCoprimePairs.erase( this );
+        }
         delete mpPolynomial;
     }
+    
+    template<typename P>
+    void PolynomialFactorizationPair<P>::setCoprime( const PolynomialFactorizationPair<P>& _pfPair ) const
+    {
+        assert( this != &_pfPair );
+        auto locks = lockCoprime( this, &_pfPair );
+        // The memo is only a shortcut, hence pairs are not remembered once one of the sets is full.
+        if( mCoprimePairs.size() >= coprimeCapacity || _pfPair.mCoprimePairs.size() >= coprimeCapacity )
+            return;
+        mCoprimePairs.insert( &_pfPair );
+        _pfPair.mCoprimePairs.insert( this );
+    }
 
     template<typename P>
     void PolynomialFactorizationPair<P>::rehash() const
@@ -479,7 +507,8 @@ namespace carl
                     P polGCD, polA, polB;
                     assert( existsFactorization( factorA ) );
                     assert( existsFactorization( factorB ) );
-                    if ( factorA.content().isIrreducible() && factorB.content().isIrreducible() )
+                    // Refining the factorization of a factor does not change its polynomial, hence known coprime factors are skipped
+                    if ( factorA.content().knownCoprime( factorB.content() ) || (factorA.content().isIrreducible() && factorB.content().isIrreducible()) )
                         polGCD = P( 1 );
                     else
                     {
@@ -493,6 +522,8 @@ namespace carl
                             polGCD = -polGCD;
                         }
                         CARL_LOG_DEBUG( "carl.core.factorizedpolynomial", __LINE__ << ": GCD of " << polA << " and " << polB << ": " << polGCD);
+                        if (isOne(polGCD))
+                            factorA.content().setCoprime( factorB.content() );
                     }
 
                     if (isOne(polGCD))
@@ -15,6 +15,9 @@
 
 #include <boost/optional.hpp>
 
+#include <atomic>
+#include <vector>
+
 namespace carl {
 
 template<typename Pol, bool AutoSimplify = false>
@@ -25,9 +28,17 @@ public:
 	using NumberType = typename Pol::NumberType;
 
 private:
-	boost::optional<std::pair<Pol, Pol>> mPolynomialQuotient;
-	CoeffType mNumberQuotient;
-	bool mIsSimplified;
+	// The members are mutable as a deferred common factor is eliminated when the rational function is observed.
+	mutable boost::optional<std::pair<Pol, Pol>> mPolynomialQuotient;
+	mutable CoeffType mNumberQuotient;
+	mutable bool mIsSimplified;
+	/// Indicates, if the elimination of the common factor has been deferred, see setLazySimplification().
+	mutable bool mIsDeferred = false;
+
+	static std::atomic<std::size_t>& lazySimplificationBound() {
+		static std::atomic<std::size_t> bound(0);
+		return bound;
+	}
 
 public:
 	RationalFunction()
@@ -74,8 +85,8 @@ public:
 			mIsSimplified = true;
 		} else {
 			mPolynomialQuotient = std::pair<Pol, Pol>(nom, denom);
-			eliminateCommonFactor(!AutoSimplify);
-			assert(isConstant() || !carl::isZero(denominatorAsPolynomial()));
+			autoSimplify();
+			assert(isNumberQuotient() || !carl::isZero(denominatorAsPolynomial()));
 		}
 	}
 
@@ -83,8 +94,8 @@ public:
 		: mPolynomialQuotient(std::pair<Pol, Pol>(std::move(nom), std::move(denom))),
 		  mNumberQuotient(),
 		  mIsSimplified(false) {
-		eliminateCommonFactor(!AutoSimplify);
-		assert(isConstant() || !carl::isZero(denominatorAsPolynomial()));
+		autoSimplify();
+		assert(isNumberQuotient() || !carl::isZero(denominatorAsPolynomial()));
 	}
 
 	explicit RationalFunction(boost::optional<std::pair<Pol, Pol>>&& quotient, const CoeffType& num, bool simplified)
@@ -102,11 +113,47 @@ public:
 
 	RationalFunction& operator=(RationalFunction&& _rf) = default;
 
+	/**
+	 * Sets a bound on the sum of the total degrees of nominator and denominator, below which rational functions with AutoSimplify
+	 * defer the elimination of common factors. A deferred elimination takes place once an operation yields a rational function
+	 * that reaches the bound, or when the rational function is observed, i.e. compared, hashed, printed, evaluated, checked by
+	 * isConstant() or asked for its nominator(), denominator() or constantPart().
+	 * Thereby, long chains of operations need few large gcd computations instead of many small ones.
+	 * The raw accessors nominatorAsPolynomial() and denominatorAsPolynomial() do not eliminate a deferred common factor.
+	 *
+	 * The bound is process-wide, i.e. shared by all rational functions of this type in all threads.
+	 * As the observers modify a rational function with a deferred elimination, a rational function must be resolved,
+	 * see resolveDeferred(), before it is shared between threads.
+	 * @param bound The bound, zero (the default) eliminates common factors after every operation.
+	 */
+	static void setLazySimplification(std::size_t bound) {
+		lazySimplificationBound() = bound;
+	}
+
+	/**
+	 * @return The bound below which the elimination of common factors is deferred, see setLazySimplification().
+	 */
+	static std::size_t lazySimplification() {
+		return lazySimplificationBound();
+	}
+
+	/**
+	 * Eliminates the common factor, if its elimination has been deferred, see setLazySimplification().
+	 * Afterwards, the const member functions do not modify this rational function, hence it can be shared between threads.
+	 */
+	void resolveDeferred() const {
+		if (!mIsDeferred)
+			return;
+		const_cast<RationalFunction*>(this)->eliminateCommonFactor(false);
+		mIsDeferred = false;
+	}
+
 	/**
 	 * @return The nominator
 	 */
 	Pol nominator() const {
-		if (isConstant())
+		resolveDeferred();
+		if (isNumberQuotient())
 			return Pol(carl::getNum(mNumberQuotient));
 		else
 			return mPolynomialQuotient->first;
@@ -116,7 +163,8 @@ public:
 	 * @return  The denominator
 	 */
 	Pol denominator() const {
-		if (isConstant())
+		resolveDeferred();
+		if (isNumberQuotient())
 			return Pol(carl::getDenom(mNumberQuotient));
 		return mPolynomialQuotient->second;
 	}
@@ -125,7 +173,7 @@ public:
 	 * @return The nominator as a polynomial.
 	 */
 	const Pol& nominatorAsPolynomial() const {
-		assert(!isConstant());
+		assert(!isNumberQuotient());
 		return mPolynomialQuotient->first;
 	}
 
@@ -133,7 +181,7 @@ public:
 	 * @return  The denominator as a polynomial.
 	 */
 	const Pol& denominatorAsPolynomial() const {
-		assert(!isConstant());
+		assert(!isNumberQuotient());
 		return mPolynomialQuotient->second;
 	}
 
@@ -141,7 +189,7 @@ public:
 	 * @return The nominator as a polynomial.
 	 */
 	CoeffType nominatorAsNumber() const {
-		assert(isConstant());
+		assert(isNumberQuotient());
 		return carl::getNum(mNumberQuotient);
 	}
 
@@ -149,7 +197,7 @@ public:
 	 * @return  The denominator as a polynomial.
 	 */
 	CoeffType denominatorAsNumber() const {
-		assert(isConstant());
+		assert(isNumberQuotient());
 		return carl::getDenom(mNumberQuotient);
 	}
 
@@ -175,10 +223,12 @@ public:
 	 */
 	RationalFunction inverse() const {
 		assert(!this->isZero());
-		if (isConstant()) {
+		if (isNumberQuotient()) {
 			return RationalFunction(boost::none, 1 / mNumberQuotient, mIsSimplified);
 		} else {
-			return RationalFunction(boost::optional<std::pair<Pol, Pol>>(std::pair<Pol, Pol>(mPolynomialQuotient->second, mPolynomialQuotient->first)), carl::constant_zero<CoeffType>().get(), mIsSimplified);
+			RationalFunction res(boost::optional<std::pair<Pol, Pol>>(std::pair<Pol, Pol>(mPolynomialQuotient->second, mPolynomialQuotient->first)), carl::constant_zero<CoeffType>().get(), mIsSimplified);
+			res.mIsDeferred = mIsDeferred;
+			return res;
 		}
 	}
 
@@ -187,25 +237,32 @@ public:
 	 * @return true if it is
 	 */
 	bool isZero() const {
-		if (isConstant())
+		if (isNumberQuotient())
 			return carl::isZero(mNumberQuotient);
 		assert(!carl::isZero(denominatorAsPolynomial()));
 		return carl::isZero(nominatorAsPolynomial());
 	}
 
 	bool isOne() const {
-		if (isConstant())
+		resolveDeferred();
+		if (isNumberQuotient())
 			return carl::isOne(mNumberQuotient);
 		assert(!carl::isZero(denominatorAsPolynomial()));
 		return nominatorAsPolynomial() == denominatorAsPolynomial();
 	}
 
+	/**
+	 * Eliminates a deferred common factor before checking, see setLazySimplification().
+	 * Afterwards, nominatorAsNumber() and denominatorAsNumber() or nominatorAsPolynomial() and denominatorAsPolynomial() are consistent with operator==.
+	 */
 	bool isConstant() const {
-		return !mPolynomialQuotient;
+		resolveDeferred();
+		return isNumberQuotient();
 	}
 
 	CoeffType constantPart() const {
-		if (isConstant())
+		resolveDeferred();
+		if (isNumberQuotient())
 			return mNumberQuotient;
 		return nominatorAsPolynomial().constantPart() / denominatorAsPolynomial().constantPart();
 	}
@@ -225,7 +282,8 @@ public:
 	 * @param vars
 	 */
 	void gatherVariables(std::set<Variable>& vars) const {
-		if (isConstant())
+		resolveDeferred();
+		if (isNumberQuotient())
 			return;
 		nominatorAsPolynomial().gatherVariables(vars);
 		denominatorAsPolynomial().gatherVariables(vars);
@@ -237,7 +295,8 @@ public:
 	 * @return The result of the substitution
 	 */
 	CoeffType evaluate(const std::map<Variable, CoeffType>& substitutions) const {
-		if (isConstant()) {
+		resolveDeferred();
+		if (isNumberQuotient()) {
 			return mNumberQuotient;
 		} else {
 			return carl::evaluate(nominatorAsPolynomial(), substitutions) / carl::evaluate(denominatorAsPolynomial(), substitutions);
@@ -245,7 +304,7 @@ public:
 	}
 
 	RationalFunction substitute(const std::map<Variable, CoeffType>& substitutions) const {
-		if (isConstant())
+		if (isNumberQuotient())
 			return *this;
 		else {
 			return RationalFunction(carl::substitute(nominatorAsPolynomial(), substitutions), carl::substitute(denominatorAsPolynomial(), substitutions));
@@ -253,16 +312,31 @@ public:
 	}
 
 	/**
-	 * Derivative of the rational function with respect to variable x
+	 * Derivative of the rational function with respect to variable x.
+	 * For u/v, the quotient rule is applied as (u'*r - u*s)/(v*r), where r is the product of the distinct factors of v and v' = s*v/r.
+	 * For factorized polynomials, the denominator thereby stays factorized and is not squared.
+	 * For plain polynomials, the nth derivative of u/v is computed with the denominator v^(n+1).
 	 * @param x the main variable
 	 * @param nth which derivative one should take
-	 * @return 
-	 * 
-	 * @todo Currently only nth = 1 is supported
-	 * @todo Curretnly only factorized polynomials are supported
+	 * @return The nth derivative.
 	 */
 	RationalFunction derivative(const Variable& x, unsigned nth = 1) const;
 
+	/**
+	 * Computes the derivatives with respect to all given variables, which share their denominator.
+	 * @param vars The variables.
+	 * @return The derivatives in the order of the given variables.
+	 */
+	std::vector<RationalFunction> gradient(const std::vector<Variable>& vars) const;
+
+	/**
+	 * Computes the matrix of the second derivatives with respect to all given variables.
+	 * As the matrix is symmetric, only the derivatives on and above the diagonal are computed.
+	 * @param vars The variables.
+	 * @return The Hessian matrix, indexed in the order of the given variables.
+	 */
+	std::vector<std::vector<RationalFunction>> hessian(const std::vector<Variable>& vars) const;
+
 	std::string toString(bool infix = true, bool friendlyNames = true) const;
 
 private:
@@ -272,6 +346,50 @@ private:
 	 */
 	void eliminateCommonFactor(bool _justNormalize);
 
+	/**
+	 * @return The sum of the total degrees of nominator and denominator, a cheap bound on the size of the rational function.
+	 */
+	std::size_t degreeBound() const {
+		if (isNumberQuotient())
+			return 0;
+		return nominatorAsPolynomial().totalDegree() + denominatorAsPolynomial().totalDegree();
+	}
+
+	/**
+	 * @return true, if the elimination of the common factor is deferred for the current size of this rational function.
+	 */
+	bool defersSimplification() const {
+		return AutoSimplify && degreeBound() < lazySimplification();
+	}
+
+	/**
+	 * Eliminates the common factor after an operation, if AutoSimplify is set and the elimination is not deferred.
+	 * Otherwise, nominator and denominator are only normalized.
+	 */
+	void autoSimplify() {
+		bool deferred = defersSimplification();
+		eliminateCommonFactor(!AutoSimplify || deferred);
+		mIsDeferred = deferred && !mIsSimplified;
+	}
+
+	/**
+	 * @return The product of the distinct factors of the denominator, which is the denominator itself if it is not factorized.
+	 */
+	Pol denominatorRadical() const;
+
+	/**
+	 * @param x The variable.
+	 * @return s such that the derivative of the denominator v wrt x is s*v/denominatorRadical().
+	 */
+	Pol denominatorLogDerivativeNominator(Variable x) const;
+
+	/**
+	 * @return true, if this is a number, regardless of a deferred common factor.
+	 */
+	bool isNumberQuotient() const {
+		return !mPolynomialQuotient;
+	}
+
 	template<bool byInverse = false>
 	RationalFunction& add(const RationalFunction& rhs);
 
@@ -572,6 +690,7 @@ namespace std {
 template<typename Pol, bool AS>
 struct hash<carl::RationalFunction<Pol, AS>> {
 	std::size_t operator()(const carl::RationalFunction<Pol, AS>& r) const {
+		// isConstant() eliminates a deferred common factor, hence equal rational functions have equal hashes.
 		if (r.isConstant())
 			return carl::hash_all(r.nominatorAsNumber(), r.denominatorAsNumber());
 		else
@@ -9,30 +9,124 @@
 
 #include "RationalFunction.h"
 
+#include <carl/core/polynomialfunctions/Derivative.h>
 #include <carl/core/polynomialfunctions/LCM.h>
+#include <carl/core/polynomialfunctions/Power.h>
 
 namespace carl {
 
 template<typename Pol, bool AS>
 RationalFunction<Pol, AS> RationalFunction<Pol, AS>::derivative(const Variable& x, unsigned nth) const {
-	assert(nth == 1);
-	if (isConstant()) {
-		return RationalFunction<Pol, AS>(0);
+	if (nth == 0) {
+		return *this;
+	}
+	if constexpr (needs_cache<Pol>::value) {
+		RationalFunction<Pol, AS> res = gradient({x}).front();
+		if (nth > 1) {
+			return res.derivative(x, nth - 1);
+		}
+		return res;
+	} else {
+		if (isNumberQuotient()) {
+			return RationalFunction<Pol, AS>(0);
+		}
+		// The radical of a plain denominator v is not known, hence the derivatives are kept as u/v^k: (u/v^k)' = (u'*v - k*u*v')/v^(k+1)
+		Pol u = nominatorAsPolynomial();
+		const auto& v = denominatorAsPolynomial();
+		Pol dv = carl::derivative(v, x);
+		for (unsigned k = 1; k <= nth; ++k) {
+			u = carl::derivative(u, x) * v - u * dv * CoeffType(k);
+		}
+		return RationalFunction<Pol, AS>(std::move(u), carl::pow(v, nth + 1));
 	}
+}
 
-	// TODO use factorization whenever possible.
-	// TODO specialize if it is just a polynomial.
-	CARL_LOG_INEFFICIENT();
-	// (u/v)' = (u'v - uv')/(v^2)
+template<typename Pol, bool AS>
+std::vector<RationalFunction<Pol, AS>> RationalFunction<Pol, AS>::gradient(const std::vector<Variable>& vars) const {
+	if (isNumberQuotient()) {
+		return std::vector<RationalFunction<Pol, AS>>(vars.size(), RationalFunction<Pol, AS>(0));
+	}
+	// (u/v)' = (u'*v - u*v')/v^2 = (u'*r - u*s)/(v*r) as v' = s*v/r
 	const auto& u = nominatorAsPolynomial();
-	const auto& v = denominatorAsPolynomial();
-	return RationalFunction<Pol, AS>(u.derivative(x) * v - u * v.derivative(x), v.pow(2));
+	Pol r = denominatorRadical();
+	Pol denom = denominatorAsPolynomial() * r;
+	std::vector<RationalFunction<Pol, AS>> res;
+	res.reserve(vars.size());
+	for (Variable x: vars) {
+		Pol s = denominatorLogDerivativeNominator(x);
+		if constexpr (needs_cache<Pol>::value) {
+			res.emplace_back(u.derivative(x) * r - u * s, denom);
+		} else {
+			res.emplace_back(carl::derivative(u, x) * r - u * s, denom);
+		}
+	}
+	return res;
+}
+
+template<typename Pol, bool AS>
+std::vector<std::vector<RationalFunction<Pol, AS>>> RationalFunction<Pol, AS>::hessian(const std::vector<Variable>& vars) const {
+	std::vector<std::vector<RationalFunction<Pol, AS>>> res(vars.size(), std::vector<RationalFunction<Pol, AS>>(vars.size()));
+	if constexpr (!needs_cache<Pol>::value) {
+		if (isNumberQuotient()) {
+			for (auto& row: res) {
+				std::fill(row.begin(), row.end(), RationalFunction<Pol, AS>(0));
+			}
+			return res;
+		}
+		// As in derivative(), the second derivatives are computed as w/v^3 for the plain denominator v instead of differentiating w/v^2 again
+		const auto& u = nominatorAsPolynomial();
+		const auto& v = denominatorAsPolynomial();
+		Pol denom = carl::pow(v, 3);
+		std::vector<Pol> dv;
+		dv.reserve(vars.size());
+		for (Variable x: vars) {
+			dv.emplace_back(carl::derivative(v, x));
+		}
+		for (std::size_t i = 0; i < vars.size(); ++i) {
+			Pol first = carl::derivative(u, vars[i]) * v - u * dv[i];
+			for (std::size_t j = i; j < vars.size(); ++j) {
+				res[i][j] = RationalFunction<Pol, AS>(carl::derivative(first, vars[j]) * v - first * dv[j] * CoeffType(2), denom);
+				res[j][i] = res[i][j];
+			}
+		}
+		return res;
+	}
+	std::vector<RationalFunction<Pol, AS>> first = gradient(vars);
+	for (std::size_t i = 0; i < vars.size(); ++i) {
+		std::vector<RationalFunction<Pol, AS>> second = first[i].gradient(std::vector<Variable>(vars.begin() + long(i), vars.end()));
+		for (std::size_t j = i; j < vars.size(); ++j) {
+			res[i][j] = second[j - i];
+			res[j][i] = second[j - i];
+		}
+	}
+	return res;
+}
+
+template<typename Pol, bool AS>
+Pol RationalFunction<Pol, AS>::denominatorRadical() const {
+	assert(!isNumberQuotient());
+	if constexpr (needs_cache<Pol>::value) {
+		return denominatorAsPolynomial().radical();
+	} else {
+		// Computing the radical of a plain polynomial is as expensive as a gcd, derivative() and hessian() instead keep track of the power of the denominator
+		return denominatorAsPolynomial();
+	}
+}
+
+template<typename Pol, bool AS>
+Pol RationalFunction<Pol, AS>::denominatorLogDerivativeNominator(Variable x) const {
+	assert(!isNumberQuotient());
+	if constexpr (needs_cache<Pol>::value) {
+		return Pol(denominatorAsPolynomial().logDerivativeNominator(x), denominatorAsPolynomial().pCache());
+	} else {
+		return carl::derivative(denominatorAsPolynomial(), x);
+	}
 }
 
 template<typename Pol, bool AS>
 void RationalFunction<Pol, AS>::eliminateCommonFactor(bool _justNormalize) {
 	if (mIsSimplified) return;
-	assert(!isConstant());
+	assert(!isNumberQuotient());
 	if (carl::isZero(nominatorAsPolynomial())) {
 		mPolynomialQuotient.reset();
 		mNumberQuotient = std::move(CoeffType(0));
@@ -74,20 +168,20 @@ void RationalFunction<Pol, AS>::eliminateCommonFactor(bool _justNormalize) {
 template<typename Pol, bool AS>
 template<bool byInverse>
 RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::add(const RationalFunction<Pol, AS>& rhs) {
-	if (this->isConstant() && rhs.isConstant()) {
+	if (this->isNumberQuotient() && rhs.isNumberQuotient()) {
 		if (byInverse)
 			this->mNumberQuotient -= rhs.mNumberQuotient;
 		else
 			this->mNumberQuotient += rhs.mNumberQuotient;
 		return *this;
-	} else if (this->isConstant()) {
+	} else if (this->isNumberQuotient()) {
 		CoeffType c = this->mNumberQuotient;
 		if (byInverse)
 			*this = -rhs;
 		else
 			*this = rhs;
 		return *this += c;
-	} else if (rhs.isConstant()) {
+	} else if (rhs.isNumberQuotient()) {
 		if (byInverse)
 			return *this -= rhs.mNumberQuotient;
 		else
@@ -118,6 +212,13 @@ RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::add(const RationalFunction
 			else
 				mPolynomialQuotient->first += rhs.nominatorAsPolynomial() * denominatorAsPolynomial();
 			mPolynomialQuotient->second *= rhs.denominatorAsPolynomial().constantPart();
+		} else if (defersSimplification()) {
+			// The common factor is eliminated later on, hence there is no need for the gcd within the least common multiple.
+			if (byInverse)
+				mPolynomialQuotient->first = this->nominatorAsPolynomial() * rhs.denominatorAsPolynomial() - rhs.nominatorAsPolynomial() * this->denominatorAsPolynomial();
+			else
+				mPolynomialQuotient->first = this->nominatorAsPolynomial() * rhs.denominatorAsPolynomial() + rhs.nominatorAsPolynomial() * this->denominatorAsPolynomial();
+			mPolynomialQuotient->second *= rhs.denominatorAsPolynomial();
 		} else {
 			Pol leastCommonMultiple(std::move(carl::lcm(this->denominatorAsPolynomial(), rhs.denominatorAsPolynomial())));
 			if (byInverse) {
@@ -128,14 +229,14 @@ RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::add(const RationalFunction
 			mPolynomialQuotient->second = std::move(leastCommonMultiple);
 		}
 	}
-	eliminateCommonFactor(!AS);
+	autoSimplify();
 	return *this;
 }
 
 template<typename Pol, bool AS>
 template<bool byInverse>
 RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::add(const Pol& rhs) {
-	if (this->isConstant()) {
+	if (this->isNumberQuotient()) {
 		CoeffType c = this->mNumberQuotient;
 		Pol resultNum(std::move(byInverse ? (rhs * CoeffType(getDenom(c)) - CoeffType(getNum(c))) : (rhs * CoeffType(getDenom(c)) + CoeffType(getNum(c)))));
 		*this = std::move(RationalFunction<Pol, AS>(std::move(resultNum), std::move(Pol(CoeffType(getDenom(c))))));
@@ -146,14 +247,14 @@ RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::add(const Pol& rhs) {
 		mPolynomialQuotient->first -= std::move(rhs * denominatorAsPolynomial());
 	else
 		mPolynomialQuotient->first += std::move(rhs * denominatorAsPolynomial());
-	eliminateCommonFactor(!AS);
+	autoSimplify();
 	return *this;
 }
 
 template<typename Pol, bool AS>
 template<bool byInverse, typename P, DisableIf<needs_cache<P>>>
 RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::add(Variable rhs) {
-	if (this->isConstant()) {
+	if (this->isNumberQuotient()) {
 		CoeffType c(this->mNumberQuotient);
 		Pol resultNum(rhs);
 		resultNum *= CoeffType(getDenom(c));
@@ -169,14 +270,14 @@ RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::add(Variable rhs) {
 		mPolynomialQuotient->first -= std::move(rhs * denominatorAsPolynomial());
 	else
 		mPolynomialQuotient->first += std::move(rhs * denominatorAsPolynomial());
-	eliminateCommonFactor(!AS);
+	autoSimplify();
 	return *this;
 }
 
 template<typename Pol, bool AS>
 template<bool byInverse>
 RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::add(const typename Pol::CoeffType& rhs) {
-	if (this->isConstant()) {
+	if (this->isNumberQuotient()) {
 		if (byInverse)
 			this->mNumberQuotient -= rhs;
 		else
@@ -188,32 +289,32 @@ RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::add(const typename Pol::Co
 		mPolynomialQuotient->first -= std::move(rhs * denominatorAsPolynomial());
 	else
 		mPolynomialQuotient->first += std::move(rhs * denominatorAsPolynomial());
-	eliminateCommonFactor(!AS);
+	autoSimplify();
 	return *this;
 }
 
 template<typename Pol, bool AS>
 RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::operator*=(const RationalFunction<Pol, AS>& rhs) {
-	if (this->isConstant() && rhs.isConstant()) {
+	if (this->isNumberQuotient() && rhs.isNumberQuotient()) {
 		this->mNumberQuotient *= rhs.mNumberQuotient;
 		return *this;
-	} else if (this->isConstant()) {
+	} else if (this->isNumberQuotient()) {
 		CoeffType c(this->mNumberQuotient);
 		*this = rhs;
 		return *this *= c;
-	} else if (rhs.isConstant()) {
+	} else if (rhs.isNumberQuotient()) {
 		return *this *= rhs.mNumberQuotient;
 	}
 	mIsSimplified = false;
 	mPolynomialQuotient->first *= rhs.nominatorAsPolynomial();
 	mPolynomialQuotient->second *= rhs.denominatorAsPolynomial();
-	eliminateCommonFactor(!AS);
+	autoSimplify();
 	return *this;
 }
 
 template<typename Pol, bool AS>
 RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::operator*=(const Pol& rhs) {
-	if (this->isConstant()) {
+	if (this->isNumberQuotient()) {
 		CoeffType c = this->mNumberQuotient;
 		Pol resultNum(rhs);
 		resultNum *= CoeffType(getNum(c));
@@ -222,14 +323,14 @@ RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::operator*=(const Pol& rhs)
 	}
 	mIsSimplified = false;
 	mPolynomialQuotient->first *= rhs;
-	eliminateCommonFactor(!AS);
+	autoSimplify();
 	return *this;
 }
 
 template<typename Pol, bool AS>
 template<typename P, DisableIf<needs_cache<P>>>
 RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::operator*=(Variable rhs) {
-	if (this->isConstant()) {
+	if (this->isNumberQuotient()) {
 		CoeffType c(this->mNumberQuotient);
 		Pol resultNum(rhs);
 		resultNum *= CoeffType(getNum(c));
@@ -238,20 +339,20 @@ RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::operator*=(Variable rhs) {
 	}
 	mIsSimplified = false;
 	mPolynomialQuotient->first *= rhs;
-	eliminateCommonFactor(!AS);
+	autoSimplify();
 	return *this;
 }
 
 template<typename Pol, bool AS>
 RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::operator*=(const typename Pol::CoeffType& rhs) {
 	// TODO handle rhs == 0
-	if (this->isConstant()) {
+	if (this->isNumberQuotient()) {
 		this->mNumberQuotient *= rhs;
 		return *this;
 	}
 	mIsSimplified = false;
 	mPolynomialQuotient->first *= rhs;
-	eliminateCommonFactor(!AS);
+	autoSimplify();
 	return *this;
 }
 
@@ -262,14 +363,14 @@ RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::operator*=(carl::sint rhs)
 
 template<typename Pol, bool AS>
 RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::operator/=(const RationalFunction<Pol, AS>& rhs) {
-	if (this->isConstant() && rhs.isConstant()) {
+	if (this->isNumberQuotient() && rhs.isNumberQuotient()) {
 		this->mNumberQuotient /= rhs.mNumberQuotient;
 		return *this;
-	} else if (this->isConstant()) {
+	} else if (this->isNumberQuotient()) {
 		CoeffType c(this->mNumberQuotient);
 		*this = rhs.inverse();
 		return *this *= c;
-	} else if (rhs.isConstant()) {
+	} else if (rhs.isNumberQuotient()) {
 		return *this /= rhs.mNumberQuotient;
 	}
 	mIsSimplified = false;
@@ -278,13 +379,13 @@ RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::operator/=(const RationalF
 	}
 	mPolynomialQuotient->first *= rhs.denominatorAsPolynomial();
 	mPolynomialQuotient->second *= rhs.nominatorAsPolynomial();
-	eliminateCommonFactor(!AS);
+	autoSimplify();
 	return *this;
 }
 
 template<typename Pol, bool AS>
 RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::operator/=(const Pol& rhs) {
-	if (this->isConstant()) {
+	if (this->isNumberQuotient()) {
 		CoeffType c(this->mNumberQuotient);
 		Pol resultNum(rhs);
 		resultNum *= CoeffType(getDenom(c));
@@ -296,7 +397,7 @@ RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::operator/=(const Pol& rhs)
 		mPolynomialQuotient->first /= rhs.constantPart();
 	} else {
 		mPolynomialQuotient->second *= rhs;
-		eliminateCommonFactor(!AS);
+		autoSimplify();
 	}
 	return *this;
 }
@@ -304,7 +405,7 @@ RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::operator/=(const Pol& rhs)
 template<typename Pol, bool AS>
 template<typename P, DisableIf<needs_cache<P>>>
 RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::operator/=(Variable rhs) {
-	if (this->isConstant()) {
+	if (this->isNumberQuotient()) {
 		CoeffType c(this->mNumberQuotient);
 		Pol resultNum(rhs);
 		resultNum *= CoeffType(getDenom(c));
@@ -313,13 +414,13 @@ RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::operator/=(Variable rhs) {
 	}
 	mIsSimplified = false;
 	mPolynomialQuotient->second *= rhs;
-	eliminateCommonFactor(!AS);
+	autoSimplify();
 	return *this;
 }
 
 template<typename Pol, bool AS>
 RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::operator/=(unsigned long rhs) {
-	if (this->isConstant()) {
+	if (this->isNumberQuotient()) {
 		this->mNumberQuotient /= CoeffType(rhs);
 		return *this;
 	}
@@ -330,7 +431,7 @@ RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::operator/=(unsigned long r
 
 template<typename Pol, bool AS>
 RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::operator/=(const typename Pol::CoeffType& rhs) {
-	if (this->isConstant()) {
+	if (this->isNumberQuotient()) {
 		this->mNumberQuotient /= rhs;
 		return *this;
 	}
@@ -341,35 +442,39 @@ RationalFunction<Pol, AS>& RationalFunction<Pol, AS>::operator/=(const typename
 
 template<typename Pol, bool AS>
 bool operator==(const RationalFunction<Pol, AS>& lhs, const RationalFunction<Pol, AS>& rhs) {
-	if (lhs.isConstant()) {
-		if (rhs.isConstant())
+	lhs.resolveDeferred();
+	rhs.resolveDeferred();
+	if (lhs.isNumberQuotient()) {
+		if (rhs.isNumberQuotient())
 			return lhs.mNumberQuotient == rhs.mNumberQuotient;
 		else
 			return false;
 	}
-	if (rhs.isConstant())
+	if (rhs.isNumberQuotient())
 		return false;
 	return lhs.nominatorAsPolynomial() == rhs.nominatorAsPolynomial() && lhs.denominatorAsPolynomial() == rhs.denominatorAsPolynomial();
 }
 
 template<typename Pol, bool AS>
 bool operator<(const RationalFunction<Pol, AS>& lhs, const RationalFunction<Pol, AS>& rhs) {
-	if (lhs.isConstant()) {
-		if (rhs.isConstant())
+	lhs.resolveDeferred();
+	rhs.resolveDeferred();
+	if (lhs.isNumberQuotient()) {
+		if (rhs.isNumberQuotient())
 			return lhs.mNumberQuotient < rhs.mNumberQuotient;
 		else
 			return true;
 	}
-	if (rhs.isConstant())
+	if (rhs.isNumberQuotient())
 		return false;
 	return lhs.nominatorAsPolynomial() * rhs.denominatorAsPolynomial() < rhs.nominatorAsPolynomial() * lhs.denominatorAsPolynomial();
 }
 
 template<typename Pol, bool AS>
 std::string RationalFunction<Pol, AS>::toString(bool infix, bool friendlyNames) const {
-
-	std::string numeratorString = isConstant() ? carl::toString(nominatorAsNumber()) : nominatorAsPolynomial().toString(infix, friendlyNames);
-	std::string denominatorString = isConstant() ? carl::toString(denominatorAsNumber()) : denominatorAsPolynomial().toString(infix, friendlyNames);
+	resolveDeferred();
+	std::string numeratorString = isNumberQuotient() ? carl::toString(nominatorAsNumber()) : nominatorAsPolynomial().toString(infix, friendlyNames);
+	std::string denominatorString = isNumberQuotient() ? carl::toString(denominatorAsNumber()) : denominatorAsPolynomial().toString(infix, friendlyNames);
 
 	if (denominator().isOne()) {
 		return numeratorString;
@@ -384,7 +489,8 @@ std::string RationalFunction<Pol, AS>::toString(bool infix, bool friendlyNames)
 
 template<typename Pol, bool AS>
 std::ostream& operator<<(std::ostream& os, const RationalFunction<Pol, AS>& rhs) {
-	if (rhs.isConstant())
+	rhs.resolveDeferred();
+	if (rhs.isNumberQuotient())
 		return os << rhs.mNumberQuotient;
 	return os << "(" << rhs.nominatorAsPolynomial() << ")/(" << rhs.denominatorAsPolynomial() << ")";
 }
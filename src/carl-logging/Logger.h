@@ -7,17 +7,25 @@
 
 #include "Filter.h"
 #include "Formatter.h"
+#include "RecordBuffer.h"
 #include "Sink.h"
 
+#include <atomic>
 #include <cassert>
+#include <chrono>
+#include <condition_variable>
 #include <cstring>
 #include <fstream>
 #include <iostream>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <sstream>
+#include <system_error>
+#include <thread>
 #include <utility>
+#include <vector>
 
 
 namespace carl {
@@ -65,6 +73,13 @@ namespace carl {
  * <li>`CARLLOG_ASSERT(channel, condition, msg)` checks the condition and if it fails calls `CARLLOG_FATAL(channel, msg)` and asserts the condition.</li>
  * </ul>
  * Any message (`msg` or `args`) can be an arbitrary expression that one would stream to an `std::ostream` like `stream << (msg);`. No final newline is needed.
+ * 
+ * Every call site caches whether its messages are visible. The cache is invalidated whenever the Logger is reconfigured,
+ * that is when a Sink is installed, a rule is added to a Filter, a Formatter is replaced or resetFormatter() is called.
+ * 
+ * The Logger can write asynchronously, see Logger::asynchronous().
+ * Then, every logging thread only renders the message given by the user and stores it in a lock-free buffer of its own,
+ * while a background thread formats the messages and writes them to the sinks.
  */
 namespace logging {
 
@@ -75,10 +90,109 @@ class Logger: public carl::Singleton<Logger> {
 	friend carl::Singleton<Logger>;
 	/// Mapping from channels to associated logging classes.
 	std::map<std::string, std::tuple<std::shared_ptr<Sink>, Filter, std::shared_ptr<Formatter>>> mData;
-	/// Logging mutex to ensure thread-safe logging.
-	std::mutex mMutex;
+	/// Logging mutex to ensure thread-safe logging and filter updates. Visibility checks only take it in shared mode.
+	mutable std::shared_mutex mMutex;
+	/// Version of the configuration, see configurationVersion().
+	std::atomic<std::size_t> mVersion = 1;
+
+	/// Indicates whether messages are written by the background writer.
+	std::atomic<bool> mAsynchronous = false;
+	/// Capacity of newly created buffers.
+	std::size_t mBufferCapacity = 1024;
+	/// Buffers of all threads that have logged asynchronously.
+	std::vector<std::shared_ptr<RecordBuffer>> mBuffers;
+	/// Mutex for mBuffers and the background writer.
+	std::mutex mBuffersMutex;
+	/// Mutex ensuring that the buffers are consumed by a single thread at a time.
+	std::mutex mDrainMutex;
+	/// Wakes up the background writer.
+	std::condition_variable mWriterCondition;
+	/// Background writer.
+	std::thread mWriter;
+	/// Indicates that the background writer shall terminate.
+	bool mStopWriter = false;
+
+	Logger() = default;
+
+	/**
+	 * Invalidates the visibility decisions cached at the call sites.
+	 */
+	void changed() noexcept {
+		++mVersion;
+	}
+
+	/**
+	 * Writes a message to all sinks it is visible for.
+	 */
+	void write(LogLevel level, const std::string& channel, const std::string& message, const RecordInfo& info) {
+		std::lock_guard<std::shared_mutex> lock(mMutex);
+		for (auto& t: mData) {
+			if (!std::get<1>(t.second).check(channel, level)) continue;
+			std::get<2>(t.second)->prefix(std::get<0>(t.second)->log(), channel, level, info);
+			std::get<0>(t.second)->log() << message;
+			std::get<2>(t.second)->suffix(std::get<0>(t.second)->log());
+		}
+	}
+
+	/**
+	 * @return The buffer of the calling thread, which is created if necessary.
+	 */
+	RecordBuffer& buffer() {
+		/// Owns the buffer of a thread and marks it as closed when the thread terminates.
+		struct BufferHandle {
+			std::shared_ptr<RecordBuffer> buffer;
+			~BufferHandle() {
+				if (buffer) buffer->close();
+			}
+		};
+		static thread_local BufferHandle handle;
+		if (!handle.buffer) {
+			handle.buffer = std::make_shared<RecordBuffer>(mBufferCapacity);
+			std::lock_guard<std::mutex> lock(mBuffersMutex);
+			mBuffers.push_back(handle.buffer);
+		}
+		return *handle.buffer;
+	}
+
+	/**
+	 * Writes all buffered messages and forgets the buffers of terminated threads.
+	 */
+	void drain() {
+		std::vector<std::shared_ptr<RecordBuffer>> buffers;
+		{
+			std::lock_guard<std::mutex> lock(mBuffersMutex);
+			buffers = mBuffers;
+		}
+		std::lock_guard<std::mutex> lock(mDrainMutex);
+		for (const auto& b: buffers) {
+			b->drain([this](Record& r){
+				write(r.level, r.channel, r.message, r.info);
+			});
+		}
+		std::lock_guard<std::mutex> bufferLock(mBuffersMutex);
+		for (auto it = mBuffers.begin(); it != mBuffers.end();) {
+			if ((*it)->closed() && (*it)->empty()) it = mBuffers.erase(it);
+			else ++it;
+		}
+	}
+
+	/**
+	 * Main loop of the background writer, which wakes up periodically or if a buffer runs full.
+	 */
+	void writerLoop() {
+		std::unique_lock<std::mutex> lock(mBuffersMutex);
+		while (!mStopWriter) {
+			mWriterCondition.wait_for(lock, std::chrono::milliseconds(10));
+			lock.unlock();
+			drain();
+			lock.lock();
+		}
+	}
 
 public:
+	~Logger() noexcept override {
+		asynchronous(false);
+	}
 	/**
 	 * Check if a Sink with the given id has been installed.
 	 * @param id Sink identifier.
@@ -94,8 +208,9 @@ public:
 	 * @param sink Sink.
 	 */
 	void configure(const std::string& id, std::shared_ptr<Sink> sink) {
-		std::lock_guard<std::mutex> lock(mMutex);
+		std::lock_guard<std::shared_mutex> lock(mMutex);
 		mData[id] = std::make_tuple(std::move(sink), Filter(), std::make_shared<Formatter>());
+		changed();
 	}
 	/**
 	 * Installs a FileSink.
@@ -114,14 +229,47 @@ public:
 		configure(id, std::make_shared<StreamSink>(os));
 	}
 	/**
-	 * Retrieves the Filter for some Sink.
+	 * Modifies the Filter of some Sink, see Logger::filter().
+	 * Every rule invalidates the visibility decisions cached at the call sites after it has been added,
+	 * hence no call site can cache a decision based on the old rules under the new configuration version.
+	 */
+	class FilterModifier {
+		Logger& mLogger;
+		Filter& mFilter;
+	public:
+		FilterModifier(Logger& logger, Filter& filter) noexcept: mLogger(logger), mFilter(filter) {}
+		FilterModifier(const FilterModifier&) = delete;
+		FilterModifier& operator=(const FilterModifier&) = delete;
+		/**
+		 * Set the minimum log level for some channel, see Filter::operator().
+		 * @param channel Channel name.
+		 * @param level LogLevel.
+		 * @return This object.
+		 */
+		FilterModifier& operator()(const std::string& channel, LogLevel level) {
+			{
+				std::lock_guard<std::shared_mutex> lock(mLogger.mMutex);
+				mFilter(channel, level);
+			}
+			mLogger.changed();
+			return *this;
+		}
+		/**
+		 * @return The Filter.
+		 */
+		const Filter& get() const noexcept {
+			return mFilter;
+		}
+	};
+	/**
+	 * Retrieves the Filter for some Sink for modification.
 	 * @param id Sink identifier.
-	 * @return Filter.
+	 * @return Object that adds rules to the Filter.
 	 */
-	Filter& filter(const std::string& id) noexcept {
+	FilterModifier filter(const std::string& id) noexcept {
 		auto it = mData.find(id);
 		assert(it != mData.end());
-		return std::get<1>(it->second);
+		return FilterModifier(*this, std::get<1>(it->second));
 	}
 	/**
 	 * Retrieves the Formatter for some Sink.
@@ -143,6 +291,7 @@ public:
 		assert(it != mData.end());
 		std::get<2>(it->second) = std::move(fmt);
 		std::get<2>(it->second)->configure(std::get<1>(it->second));
+		changed();
 	}
 	/**
 	 * Reconfigures all Formatter objects.
@@ -152,14 +301,62 @@ public:
 		for (auto& t: mData) {
 			std::get<2>(t.second)->configure(std::get<1>(t.second));
 		}
+		changed();
+	}
+	/**
+	 * @return The version of the configuration, which changes whenever the Logger is reconfigured.
+	 */
+	std::size_t version() const noexcept {
+		return mVersion.load(std::memory_order_acquire);
+	}
+	/**
+	 * Enables or disables asynchronous logging.
+	 * If enabled, messages are written by a background thread. Messages of a single thread keep their order,
+	 * but messages of different threads may be interleaved differently than they were emitted.
+	 * When disabled, all pending messages are written before this method returns.
+	 * @param enable If messages shall be written asynchronously.
+	 * @param capacity Number of messages a thread can buffer before it has to wait for the background writer.
+	 */
+	void asynchronous(bool enable, std::size_t capacity = 1024) {
+		std::unique_lock<std::mutex> lock(mBuffersMutex);
+		mBufferCapacity = capacity;
+		if (enable == mAsynchronous) return;
+		if (enable) {
+			mStopWriter = false;
+			mWriter = std::thread([this](){ writerLoop(); });
+			mAsynchronous = true;
+		} else {
+			mAsynchronous = false;
+			mStopWriter = true;
+			lock.unlock();
+			mWriterCondition.notify_one();
+			mWriter.join();
+			// Pairs with the fence in log(): either we see records pushed concurrently or their producer sees that we are done.
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			drain();
+		}
+	}
+	/**
+	 * Writes all messages that have been buffered for asynchronous logging so far.
+	 */
+	void flush() {
+		drain();
 	}
 	/**
 	 * Checks whether a log message would be visible for some sink.
 	 * If this is not the case, we do not need to render it at all.
+	 * Concurrent checks do not block each other, as the mutex is only taken in shared mode.
+	 * If it can not be acquired, the message is considered visible and write() decides again.
 	 * @param level LogLevel.
 	 * @param channel Channel name.
 	 */
 	bool visible(LogLevel level, const std::string& channel) const noexcept {
+		std::shared_lock<std::shared_mutex> lock(mMutex, std::defer_lock);
+		try {
+			lock.lock();
+		} catch (const std::system_error&) {
+			return true;
+		}
 		for (const auto& t: mData) {
 			if (std::get<1>(t.second).check(channel, level)) {
 				return true;
@@ -175,12 +372,28 @@ public:
 	 * @param info Auxiliary information.
 	 */
 	void log(LogLevel level, const std::string& channel, const std::stringstream& ss, const RecordInfo& info) {
-		std::lock_guard<std::mutex> lock(mMutex);
-		for (auto& t: mData) {
-			if (!std::get<1>(t.second).check(channel, level)) continue;
-			std::get<2>(t.second)->prefix(std::get<0>(t.second)->log(), channel, level, info);
-			std::get<0>(t.second)->log() << ss.str();
-			std::get<2>(t.second)->suffix(std::get<0>(t.second)->log());
+		if (!mAsynchronous.load(std::memory_order_acquire)) {
+			write(level, channel, ss.str(), info);
+			return;
+		}
+		Record record{level, channel, ss.str(), info};
+		RecordBuffer& b = buffer();
+		while (!b.push(record)) {
+			if (!mAsynchronous.load(std::memory_order_acquire)) {
+				// The background writer is gone, consume the buffer ourselves.
+				drain();
+				continue;
+			}
+			// The buffer is full, wait for the background writer.
+			mWriterCondition.notify_one();
+			std::this_thread::yield();
+		}
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (!mAsynchronous.load(std::memory_order_relaxed)) {
+			// Asynchronous logging was disabled meanwhile and the final drain may have missed the record.
+			drain();
+		} else if (b.pressured()) {
+			mWriterCondition.notify_one();
 		}
 	}
 };
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "LogLevel.h"
+#include "logging.h"
+
+#include <atomic>
+#include <cassert>
+#include <string>
+#include <vector>
+
+namespace carl::logging {
+
+/**
+ * A log message that has been rendered by the user, but not yet formatted or written to any Sink.
+ */
+struct Record {
+	/// LogLevel.
+	LogLevel level;
+	/// Channel name.
+	std::string channel;
+	/// Message given by the user.
+	std::string message;
+	/// Auxiliary information.
+	RecordInfo info;
+};
+
+/**
+ * A lock-free ring buffer of Record objects for a single producer and a single consumer.
+ * Every thread that logs asynchronously owns such a buffer and the background writer of the Logger consumes it.
+ */
+class RecordBuffer {
+	/// Storage, the size is a power of two.
+	std::vector<Record> mRecords;
+	/// Position of the next record to consume.
+	std::atomic<std::size_t> mHead = 0;
+	/// Position of the next record to produce.
+	std::atomic<std::size_t> mTail = 0;
+	/// Indicates that the producing thread has terminated.
+	std::atomic<bool> mClosed = false;
+
+	static std::size_t roundUp(std::size_t capacity) noexcept {
+		std::size_t res = 1;
+		while (res < capacity) res <<= 1;
+		return res;
+	}
+public:
+	/**
+	 * Creates a buffer that holds at least the given number of records.
+	 * @param capacity Capacity.
+	 */
+	explicit RecordBuffer(std::size_t capacity): mRecords(roundUp(capacity)) {}
+
+	/**
+	 * Adds a record, may only be called by the producing thread.
+	 * @param record Record, it is moved from if it was added.
+	 * @return If the record was added, i.e. if the buffer was not full.
+	 */
+	bool push(Record& record) noexcept {
+		std::size_t tail = mTail.load(std::memory_order_relaxed);
+		if (tail - mHead.load(std::memory_order_acquire) == mRecords.size()) return false;
+		mRecords[tail & (mRecords.size() - 1)] = std::move(record);
+		mTail.store(tail + 1, std::memory_order_release);
+		return true;
+	}
+	/**
+	 * Passes all records to the given function and removes them, may only be called by one consumer at a time.
+	 * @param f Function that is called for every record.
+	 * @return Number of records.
+	 */
+	template<typename F>
+	std::size_t drain(F&& f) {
+		std::size_t head = mHead.load(std::memory_order_relaxed);
+		std::size_t tail = mTail.load(std::memory_order_acquire);
+		for (std::size_t i = head; i != tail; ++i) {
+			f(mRecords[i & (mRecords.size() - 1)]);
+		}
+		mHead.store(tail, std::memory_order_release);
+		return tail - head;
+	}
+	/**
+	 * @return If the buffer is (almost) full, used to wake up the consumer early.
+	 */
+	bool pressured() const noexcept {
+		return 2 * (mTail.load(std::memory_order_relaxed) - mHead.load(std::memory_order_relaxed)) >= mRecords.size();
+	}
+	bool empty() const noexcept {
+		return mTail.load(std::memory_order_acquire) == mHead.load(std::memory_order_acquire);
+	}
+	/// Marks that the producing thread has terminated.
+	void close() noexcept {
+		mClosed = true;
+	}
+	bool closed() const noexcept {
+		return mClosed;
+	}
+};
+
+}
@@ -12,4 +12,8 @@ void log(LogLevel level, const std::string& channel, const std::stringstream& ss
 	Logger::getInstance().log(level, channel, ss, info);
 }
 
+std::size_t configurationVersion() noexcept {
+	return Logger::getInstance().version();
+}
+
 }
\ No newline at end of file
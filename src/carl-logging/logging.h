@@ -2,6 +2,8 @@
 
 #include "LogLevel.h"
 
+#include <atomic>
+#include <limits>
 #include <sstream>
 #include <string>
 
@@ -21,6 +23,46 @@ struct RecordInfo {
 
 bool visible(LogLevel level, const std::string& channel) noexcept;
 void log(LogLevel level, const std::string& channel, const std::stringstream& ss, const RecordInfo& info);
+/**
+ * @return The version of the configuration of the Logger, which changes whenever the Logger is reconfigured.
+ */
+std::size_t configurationVersion() noexcept;
+
+/**
+ * Caches whether the log messages of a single call site are visible, see __CARL_LOG.
+ * The decision is recomputed only if the configuration version of the Logger has changed.
+ * Only channels given as string literals are cached, as they are identified by their address.
+ * A call site that is used with different channels only caches the decision for the first one.
+ */
+class VisibilityCache {
+	/// Channel the cache is bound to, it is set by the first call and never changed afterwards.
+	std::atomic<const char*> mChannel = nullptr;
+	/// Configuration version the cached decision is based on in the upper bits and the decision in the lowest bit.
+	/// Both are stored in a single word such that readers never see a decision together with a wrong version. Zero is never used by the Logger.
+	std::atomic<std::size_t> mState = 0;
+	static constexpr std::size_t version_mask = std::numeric_limits<std::size_t>::max() >> 1;
+public:
+	bool visible(LogLevel level, const char* channel) noexcept {
+		const char* bound = mChannel.load(std::memory_order_relaxed);
+		if (bound == nullptr && mChannel.compare_exchange_strong(bound, channel, std::memory_order_relaxed)) {
+			bound = channel;
+		}
+		if (bound != channel) {
+			return ::carl::logging::visible(level, channel);
+		}
+		std::size_t version = configurationVersion() & version_mask;
+		std::size_t state = mState.load(std::memory_order_relaxed);
+		if ((state >> 1) == version) {
+			return (state & 1) != 0;
+		}
+		bool res = ::carl::logging::visible(level, channel);
+		mState.store((version << 1) | (res ? 1 : 0), std::memory_order_relaxed);
+		return res;
+	}
+	bool visible(LogLevel level, const std::string& channel) noexcept {
+		return ::carl::logging::visible(level, channel);
+	}
+};
 
 }
 
@@ -32,15 +74,17 @@ void log(LogLevel level, const std::string& channel, const std::stringstream& ss
 #define __CARL_LOG_RECORD ::carl::logging::RecordInfo{__FILE__, __func__, __LINE__}
 /// Create a record info without function name.
 #define __CARL_LOG_RECORD_NOFUNC ::carl::logging::RecordInfo{__FILE__, "", __LINE__}
-/// Basic logging macro.
+/// Basic logging macro, the visibility is cached per call site.
 #define __CARL_LOG(level, channel, expr) { \
-	if (::carl::logging::visible(level, channel)) { \
+	static ::carl::logging::VisibilityCache __cache; \
+	if (__cache.visible(level, channel)) { \
 		std::stringstream __ss; __ss << expr; ::carl::logging::log(level, channel, __ss, __CARL_LOG_RECORD); \
 	}}
 
 /// Basic logging macro without function name.
 #define __CARL_LOG_NOFUNC(level, channel, expr) { \
-	if (::carl::logging::visible(level, channel)) { \
+	static ::carl::logging::VisibilityCache __cache; \
+	if (__cache.visible(level, channel)) { \
 		std::stringstream __ss; __ss << expr; ::carl::logging::log(level, channel, __ss, __CARL_LOG_RECORD_NOFUNC); \
 	}}
 
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "ModelValue.h"
+#include "ModelVariable.h"
+
+#include <optional>
+#include <vector>
+
+namespace carl
+{
+	/**
+	 * A dense view on the assignments of (algebraic) variables in a Model.
+	 * Values are indexed by the variable id and type, which allows for constant time lookups instead of a std::map lookup.
+	 * Rational values are additionally stored in a separate column such that the common case of a rational assignment
+	 * does not need to inspect the ModelValue at all.
+	 * The view stores pointers to the values of the Model and is kept up to date by the Model it belongs to.
+	 */
+	template<typename Rational, typename Poly>
+	class DenseModel {
+	public:
+		using Value = ModelValue<Rational,Poly>;
+	private:
+		std::vector<const Value*> mValues;
+		std::vector<std::optional<Rational>> mRationals;
+
+		static std::size_t index(Variable var) {
+			return var.id() * static_cast<std::size_t>(VariableType::TYPE_SIZE) + static_cast<std::size_t>(var.type());
+		}
+	public:
+		DenseModel() = default;
+		/**
+		 * Builds the view from the underlying map of a Model.
+		 */
+		template<typename Map>
+		explicit DenseModel(const Map& data) {
+			for (const auto& d: data) {
+				if (d.first.isVariable()) set(d.first.asVariable(), d.second);
+			}
+		}
+
+		/**
+		 * Sets the value of the given variable. The value must stay alive as long as it is stored in the view.
+		 */
+		void set(Variable var, const Value& value) {
+			std::size_t i = index(var);
+			if (i >= mValues.size()) {
+				mValues.resize(i + 1, nullptr);
+				mRationals.resize(i + 1);
+			}
+			mValues[i] = &value;
+			if (value.isRational()) mRationals[i] = value.asRational();
+			else mRationals[i] = std::nullopt;
+		}
+		/**
+		 * Forgets the rational value of the given variable, for example if the value may be modified outside of the Model.
+		 * The value itself is still available via value().
+		 */
+		void invalidate(Variable var) {
+			std::size_t i = index(var);
+			if (i < mRationals.size()) mRationals[i] = std::nullopt;
+		}
+		void remove(Variable var) {
+			std::size_t i = index(var);
+			if (i < mValues.size()) {
+				mValues[i] = nullptr;
+				mRationals[i] = std::nullopt;
+			}
+		}
+		void clear() {
+			mValues.clear();
+			mRationals.clear();
+		}
+
+		/**
+		 * @return The raw value of the given variable or nullptr if it is not assigned.
+		 */
+		const Value* value(Variable var) const {
+			std::size_t i = index(var);
+			if (i >= mValues.size()) return nullptr;
+			return mValues[i];
+		}
+		/**
+		 * @return The value of the given variable if it is assigned to a rational, nullptr otherwise.
+		 */
+		const Rational* rational(Variable var) const {
+			std::size_t i = index(var);
+			if (i >= mRationals.size() || !mRationals[i]) return nullptr;
+			return &*mRationals[i];
+		}
+	};
+}
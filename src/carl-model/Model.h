@@ -1,10 +1,18 @@
 #pragma once
 
 #include <carl/core/logging.h>
+#include <carl/formula/Formula.h>
 
+#include "DenseModel.h"
 #include "ModelVariable.h"
 #include "ModelValue.h"
 
+#include <list>
+#include <optional>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
 namespace carl
 {
 	/**
@@ -14,6 +22,15 @@ namespace carl
 	 * for these variables.
 	 * Most notably, a value can be a "carl::ModelSubstitution" whose value depends
 	 * on the values of other variables in the Model.
+	 *
+	 * The model tracks which substitutions and which cached formula evaluations
+	 * depend on which variables. Changing an assignment only invalidates the
+	 * (transitively) affected entries, which are then recomputed on demand.
+	 * Caching formula evaluations is opt-in via enableFormulaCache() and bounded,
+	 * the least recently used evaluations are evicted first.
+	 *
+	 * For evaluation hot paths, a DenseModel view can be enabled that allows
+	 * for constant time lookups of variables and is kept up to date incrementally.
 	 */
 	template<typename Rational, typename Poly>
 	class Model {
@@ -25,15 +42,144 @@ namespace carl
 		static_assert(std::is_same<mapped_type, typename Map::mapped_type>::value, "Should be the same type");
 	private:
 		Map mData;
-		std::map<key_type, std::size_t> mUsedInSubstitution;
-		void resetCaches() const {
-			for (const auto& d: mData) {
-				if (d.second.isSubstitution()) {
-					d.second.asSubstitution()->resetCache();
+		/// Maps every key to the keys whose substitutions depend on it.
+		std::map<key_type, std::set<key_type>> mDependents;
+		/// Maps every key assigned to a substitution to the keys it depends on.
+		std::map<key_type, std::set<key_type>> mDependencies;
+		/// Keys that are assigned to substitutions.
+		std::set<key_type> mSubstitutions;
+		struct CachedEvaluation {
+			mapped_type value;
+			/// The keys this evaluation depends on.
+			std::vector<key_type> keys;
+			/// Position in mFormulaCacheOrder.
+			typename std::list<Formula<Poly>>::iterator position;
+		};
+		/// Maximum number of cached formula evaluations, zero if formula caching is disabled.
+		std::size_t mFormulaCacheCapacity = 0;
+		mutable std::unordered_map<Formula<Poly>, CachedEvaluation> mFormulaCache;
+		/// Cached formulas, the most recently used first.
+		mutable std::list<Formula<Poly>> mFormulaCacheOrder;
+		/// Maps every key to the cached formula evaluations that depend on it.
+		mutable std::map<key_type, std::set<Formula<Poly>>> mFormulaDependents;
+		std::optional<DenseModel<Rational,Poly>> mDense;
+
+		/**
+		 * Resets the substitutions and drops the cached formula evaluations that (transitively) depend on the given key.
+		 */
+		void invalidate(const key_type& key) const {
+			std::vector<key_type> queue({key});
+			std::set<key_type> visited({key});
+			while (!queue.empty()) {
+				key_type cur = queue.back();
+				queue.pop_back();
+				auto fit = mFormulaDependents.find(cur);
+				if (fit != mFormulaDependents.end()) {
+					auto formulas = std::move(fit->second);
+					mFormulaDependents.erase(fit);
+					for (const auto& f: formulas) dropEvaluation(f);
 				}
+				auto dit = mDependents.find(cur);
+				if (dit == mDependents.end()) continue;
+				for (const auto& dep: dit->second) {
+					if (!visited.insert(dep).second) continue;
+					auto it = mData.find(dep);
+					if (it != mData.end() && it->second.isSubstitution()) {
+						it->second.asSubstitution()->resetCache();
+					}
+					queue.push_back(dep);
+				}
+			}
+		}
+		/// Drops the cached evaluation of f, if there is one, including its entries in mFormulaDependents.
+		void dropEvaluation(const Formula<Poly>& f) const {
+			auto it = mFormulaCache.find(f);
+			if (it == mFormulaCache.end()) return;
+			for (const auto& k: it->second.keys) {
+				auto dit = mFormulaDependents.find(k);
+				if (dit == mFormulaDependents.end()) continue;
+				dit->second.erase(f);
+				if (dit->second.empty()) mFormulaDependents.erase(dit);
+			}
+			mFormulaCacheOrder.erase(it->second.position);
+			mFormulaCache.erase(it);
+		}
+		void clearFormulaCache() const {
+			mFormulaCache.clear();
+			mFormulaCacheOrder.clear();
+			mFormulaDependents.clear();
+		}
+		void removeDependencies(const key_type& key) {
+			auto it = mDependencies.find(key);
+			if (it == mDependencies.end()) return;
+			for (const auto& var: it->second) {
+				mDependents[var].erase(key);
+			}
+			mDependencies.erase(it);
+		}
+		void addDependency(const key_type& var, const key_type& key) {
+			mDependents[var].insert(key);
+			mDependencies[key].insert(var);
+		}
+		void addDependencies(typename Map::const_iterator it) {
+			if (it->second.isSubstitution()) {
+				mSubstitutions.insert(it->first);
+				for (const auto& d: mData) {
+					if (d.first == it->first) continue;
+					if (it->second.asSubstitution()->dependsOn(d.first)) addDependency(d.first, it->first);
+				}
+			} else {
+				mSubstitutions.erase(it->first);
+			}
+			// Substitutions may depend on variables that have not been assigned before.
+			for (const auto& s: mSubstitutions) {
+				if (s == it->first) continue;
+				if (mData.at(s).asSubstitution()->dependsOn(it->first)) addDependency(it->first, s);
+			}
+		}
+		/// Updates the dependencies, caches and the dense view after the value at it has been (re)assigned.
+		void assigned(typename Map::const_iterator it) {
+			removeDependencies(it->first);
+			addDependencies(it);
+			invalidate(it->first);
+			updateDense(it);
+		}
+		void updateDense(typename Map::const_iterator it) {
+			if (mDense && it != mData.end() && it->first.isVariable()) {
+				mDense->set(it->first.asVariable(), it->second);
+			}
+		}
+		void removeDense(const key_type& key) {
+			if (mDense && key.isVariable()) {
+				mDense->remove(key.asVariable());
 			}
 		}
 	public:
+		Model() = default;
+		/**
+		 * Copies the assignments. Cached formula evaluations are not copied, but formula caching stays enabled.
+		 */
+		Model(const Model& model)
+			: mData(model.mData), mDependents(model.mDependents), mDependencies(model.mDependencies), mSubstitutions(model.mSubstitutions),
+			  mFormulaCacheCapacity(model.mFormulaCacheCapacity)
+		{
+			if (model.mDense) enableDenseView();
+		}
+		Model(Model&& model) = default;
+		Model& operator=(const Model& model) {
+			if (this == &model) return *this;
+			mData = model.mData;
+			mDependents = model.mDependents;
+			mDependencies = model.mDependencies;
+			mSubstitutions = model.mSubstitutions;
+			mFormulaCacheCapacity = model.mFormulaCacheCapacity;
+			clearFormulaCache();
+			mDense.reset();
+			if (model.mDense) enableDenseView();
+			return *this;
+		}
+		Model& operator=(Model&& model) = default;
+
 		// Element access
 		const auto& at(const key_type& key) const {
 			return mData.at(key);
@@ -56,37 +202,50 @@ namespace carl
 		// Modifiers
 		void clear() {
 			mData.clear();
+			mDependents.clear();
+			mDependencies.clear();
+			mSubstitutions.clear();
+			clearFormulaCache();
+			if (mDense) mDense->clear();
 		}
 		template<typename P>
 		auto insert(const P& pair) {
-			resetCaches();
-			return mData.insert(pair);
+			auto res = mData.insert(pair);
+			if (res.second) assigned(res.first);
+			return res;
 		}
 		template<typename P>
 		auto insert(typename Map::const_iterator it, const P& pair) {
-			resetCaches();
-			return mData.insert(it, pair);
+			auto size = mData.size();
+			auto res = mData.insert(it, pair);
+			if (mData.size() != size) assigned(res);
+			return res;
 		}
 		template<typename... Args>
 		auto emplace(const key_type& key, Args&& ...args) {
-			resetCaches();
-			return mData.emplace(key,std::forward<Args>(args)...);
+			auto res = mData.emplace(key,std::forward<Args>(args)...);
+			if (res.second) assigned(res.first);
+			return res;
 		}
 		template<typename... Args>
 		auto emplace_hint(typename Map::const_iterator it, const key_type& key, Args&& ...args) {
-			resetCaches();
-			return mData.emplace_hint(it, key,std::forward<Args>(args)...);
+			auto size = mData.size();
+			auto res = mData.emplace_hint(it, key,std::forward<Args>(args)...);
+			if (mData.size() != size) assigned(res);
+			return res;
 		}
 		typename Map::iterator erase(const ModelVariable& variable) {
-			resetCaches();
 			return erase(mData.find(variable));
 		}
 		typename Map::iterator erase(const typename Map::iterator& it) {
-			resetCaches();
 			return erase(typename Map::const_iterator(it));
 		}
 		typename Map::iterator erase(const typename Map::const_iterator& it) {
 			if (it == mData.end()) return mData.end();
+			invalidate(it->first);
+			removeDependencies(it->first);
+			mSubstitutions.erase(it->first);
+			removeDense(it->first);
 			return mData.erase(it);
 		}
         void clean() {
@@ -96,23 +255,47 @@ namespace carl
 				const auto& subs = val.asSubstitution();
                 CARL_LOG_DEBUG("carl.formula.model", "Evaluating " << m.first << " ->  " << subs << " as.");
                 m.second = subs->evaluate(*this);
+				// The value does not change, hence nothing needs to be invalidated.
+				removeDependencies(m.first);
+				mSubstitutions.erase(m.first);
+				if (mDense && m.first.isVariable()) mDense->set(m.first.asVariable(), m.second);
 			}
         }
 		// Lookup
 		auto find(const typename Map::key_type& key) const {
 			return mData.find(key);
 		}
+		/**
+		 * Values may be modified through the returned iterator, hence the rational value of key in the dense view is dropped
+		 * and dependent entries are invalidated. Note that they are not invalidated again after the modification, use assign() to change values.
+		 */
 		auto find(const typename Map::key_type& key) {
+			invalidate(key);
+			if (mDense && key.isVariable()) mDense->invalidate(key.asVariable());
 			return mData.find(key);
 		}
 		
 		// Additional (w.r.t. std::map)
-		Model() = default;
 		Model(const std::map<Variable, Rational>& assignment) {
 			for (const auto& a: assignment) {
 				mData.emplace(a.first, a.second);
 			}
 		}
+		/**
+		 * Builds the dense view on this model, which is then used by findEvaluated() and findRational().
+		 */
+		void enableDenseView() {
+			mDense.emplace(mData);
+		}
+		void disableDenseView() {
+			mDense.reset();
+		}
+		/**
+		 * @return The dense view or nullptr if it is not enabled.
+		 */
+		const DenseModel<Rational,Poly>* denseView() const {
+			return mDense ? &*mDense : nullptr;
+		}
 		template<typename Container>
 		bool contains(const Container& c) const {
 			for (const auto& var: c) {
@@ -123,8 +306,9 @@ namespace carl
 		template<typename T>
 		void assign(const typename Map::key_type& key, const T& t) {
 			auto it = mData.find(key);
-			if (it == mData.end()) mData.emplace(key, t);
+			if (it == mData.end()) it = mData.emplace(key, t).first;
 			else it->second = t;
+			assigned(it);
 		}
 		void update(const Model& model, bool disjoint = true) {
 			for (const auto& m: model) {
@@ -136,6 +320,7 @@ namespace carl
 						res.first->second = m.second;
 					}
 				}
+				assigned(res.first);
 			}
 		}
 		/**
@@ -148,6 +333,88 @@ namespace carl
 			if (it.isSubstitution()) return it.asSubstitution()->evaluate(*this);
 			else return it;
 		}
+		/**
+		 * Return the evaluated ModelValue for the given variable like evaluated(), or nullptr if the variable is not assigned.
+		 * Uses the dense view if it is enabled.
+		 */
+		const ModelValue<Rational,Poly>* findEvaluated(Variable var) const {
+			const ModelValue<Rational,Poly>* res = nullptr;
+			if (mDense) {
+				res = mDense->value(var);
+			} else {
+				auto it = mData.find(var);
+				if (it != mData.end()) res = &it->second;
+			}
+			if (res != nullptr && res->isSubstitution()) return &res->asSubstitution()->evaluate(*this);
+			return res;
+		}
+		/**
+		 * Return the value of the given variable if it evaluates to a rational, nullptr otherwise.
+		 * Uses the rational column of the dense view if it is enabled.
+		 */
+		const Rational* findRational(Variable var) const {
+			if (mDense) {
+				if (const Rational* r = mDense->rational(var)) return r;
+			}
+			const ModelValue<Rational,Poly>* value = findEvaluated(var);
+			if (value != nullptr && value->isRational()) return &value->asRational();
+			return nullptr;
+		}
+		/**
+		 * Enables caching the evaluations of formulas by model::evaluate(), keeping at most capacity evaluations.
+		 * Note that evaluating a formula then modifies the cache, hence concurrent evaluations on the same model are not safe.
+		 */
+		void enableFormulaCache(std::size_t capacity = 1024) {
+			assert(capacity > 0);
+			mFormulaCacheCapacity = capacity;
+			while (mFormulaCache.size() > mFormulaCacheCapacity) dropEvaluation(mFormulaCacheOrder.back());
+		}
+		void disableFormulaCache() {
+			mFormulaCacheCapacity = 0;
+			clearFormulaCache();
+		}
+		bool hasFormulaCache() const {
+			return mFormulaCacheCapacity > 0;
+		}
+		/// Number of cached formula evaluations.
+		std::size_t formulaCacheSize() const {
+			return mFormulaCache.size();
+		}
+		/**
+		 * Return the cached evaluation of the given formula or nullptr if there is none.
+		 * A cached evaluation is dropped as soon as an assignment it depends on changes.
+		 */
+		const ModelValue<Rational,Poly>* cachedEvaluation(const Formula<Poly>& f) const {
+			auto it = mFormulaCache.find(f);
+			if (it == mFormulaCache.end()) return nullptr;
+			mFormulaCacheOrder.splice(mFormulaCacheOrder.begin(), mFormulaCacheOrder, it->second.position);
+			return &it->second.value;
+		}
+		/**
+		 * Caches the evaluation of the given formula over this model, if formula caching is enabled.
+		 * Evicts the least recently used evaluation if the cache is full.
+		 */
+		void cacheEvaluation(const Formula<Poly>& f, const ModelValue<Rational,Poly>& value) const {
+			if (!hasFormulaCache()) return;
+			dropEvaluation(f);
+			if (mFormulaCache.size() >= mFormulaCacheCapacity) dropEvaluation(mFormulaCacheOrder.back());
+			std::vector<key_type> keys;
+			for (auto v: f.variables()) keys.emplace_back(v);
+			std::set<UVariable> uvs;
+			f.gatherUVariables(uvs);
+			for (const auto& v: uvs) keys.emplace_back(v);
+			std::set<BVVariable> bvvs;
+			f.gatherBVVariables(bvvs);
+			for (const auto& v: bvvs) keys.emplace_back(v);
+			std::set<UninterpretedFunction> ufs;
+			f.gatherUFs(ufs);
+			for (const auto& v: ufs) keys.emplace_back(v);
+			for (const auto& k: keys) {
+				mFormulaDependents[k].insert(f);
+			}
+			mFormulaCacheOrder.push_front(f);
+			mFormulaCache.emplace(f, CachedEvaluation{value, std::move(keys), mFormulaCacheOrder.begin()});
+		}
 		void print(std::ostream& os, bool simple = true) const {
 			os << "(model" << std::endl;
 			for (const auto& ass: mData) {
@@ -45,15 +45,24 @@ T substitute(const T& t, const Model<Rational,Poly>& m) {
 /**
  * Evaluates a given expression t over a model.
  * The result is always a ModelValue, though it may be a ModelSubstitution in some cases.
+ * If enabled via Model::enableFormulaCache(), evaluations of formulas are cached in the model until an assignment they depend on changes.
  */
 template<typename T, typename Rational, typename Poly>
 ModelValue<Rational,Poly> evaluate(const T& t, const Model<Rational,Poly>& m) {
+	if constexpr (std::is_same<T, Formula<Poly>>::value) {
+		if (m.hasFormulaCache()) {
+			if (const auto* cached = m.cachedEvaluation(t)) return *cached;
+		}
+	}
 	T tmp = t;
 	ModelValue<Rational,Poly> res;
 	evaluate(res, tmp, m);
 	if (res.isRAN() && res.asRAN().is_numeric()) {
 		res = res.asRAN().value();
 	}
+	if constexpr (std::is_same<T, Formula<Poly>>::value) {
+		if (m.hasFormulaCache()) m.cacheEvaluation(t, res);
+	}
 	return res;
 }
 
@@ -29,13 +29,13 @@ namespace model {
 	template<typename Rational, typename Poly>
 	void substituteIn(MultivariateRoot<Poly>& mvr, const Model<Rational,Poly>& m) {
 		for (auto var: carl::variables(mvr)) {
-			auto it = m.find(var);
-			if (it == m.end()) continue;
-			const ModelValue<Rational,Poly>& value = m.evaluated(var);
-			if (value.isRational()) {
-				substituteIn(mvr, var, value.asRational());
-			} else if (value.isRAN()) {
-				substituteIn(mvr, var, value.asRAN());
+			if (const Rational* r = m.findRational(var)) {
+				substituteIn(mvr, var, *r);
+				continue;
+			}
+			const ModelValue<Rational,Poly>* value = m.findEvaluated(var);
+			if (value != nullptr && value->isRAN()) {
+				substituteIn(mvr, var, value->asRAN());
 			}
 		}
 	}
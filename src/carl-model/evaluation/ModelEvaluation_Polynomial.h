@@ -52,15 +52,16 @@ namespace model {
 	template<typename Rational, typename Poly, typename ModelPoly>
 	void substituteIn(Poly& p, const Model<Rational,ModelPoly>& m) {
 		for (auto var: carl::variables(p)) {
-			auto it = m.find(var);
-			if (it == m.end()) continue;
-			const ModelValue<Rational,ModelPoly>& value = m.evaluated(var);
-			if (value.isRational()) {
-				substituteIn(p, var, value.asRational());
-			} else if (value.isRAN()) {
-				substituteIn(p, var, value.asRAN());
-			} else if (value.isSubstitution()) {
-				const auto& subs = value.asSubstitution();
+			if (const Rational* r = m.findRational(var)) {
+				substituteIn(p, var, *r);
+				continue;
+			}
+			const ModelValue<Rational,ModelPoly>* value = m.findEvaluated(var);
+			if (value == nullptr) continue;
+			if (value->isRAN()) {
+				substituteIn(p, var, value->asRAN());
+			} else if (value->isSubstitution()) {
+				const auto& subs = value->asSubstitution();
 				auto polysub = dynamic_cast<const ModelPolynomialSubstitution<Rational,Poly>*>(subs.get());
 				if (polysub != nullptr) {
 					substituteIn(p, var, polysub->getPoly());
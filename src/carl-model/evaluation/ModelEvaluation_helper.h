@@ -9,10 +9,9 @@ template<typename Rational, typename Poly>
 ran::RANMap<Rational> collectRANIR(const std::set<Variable>& vars, const Model<Rational,Poly>& model) {
 	ran::RANMap<Rational> map;
 	for (auto var: vars) {
-		if (model.find(var) == model.end()) continue;
-		const ModelValue<Rational,Poly>& mv = model.evaluated(var);
-		if (mv.isRAN()) {
-			map.emplace(var, mv.asRAN());
+		const ModelValue<Rational,Poly>* mv = model.findEvaluated(var);
+		if (mv != nullptr && mv->isRAN()) {
+			map.emplace(var, mv->asRAN());
 		}
 	}
 	return map;
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace carl {
+namespace statistics {
+
+/**
+ * Histogram of nonnegative values with buckets of exponentially growing width.
+ * Bucket zero holds the value zero, bucket i > 0 holds the values from 2^(i-1) to 2^i - 1.
+ */
+class histogram {
+    std::vector<std::size_t> m_buckets;
+    std::size_t m_count = 0;
+    std::size_t m_sum = 0;
+    std::size_t m_max = 0;
+public:
+    /// Return the bucket that holds the given value.
+    static std::size_t bucket_of(std::size_t value) {
+        std::size_t res = 0;
+        while (value > 0) {
+            value >>= 1;
+            ++res;
+        }
+        return res;
+    }
+    /// Return the smallest value of the given bucket.
+    static std::size_t lower_bound(std::size_t bucket) {
+        if (bucket == 0) return 0;
+        return std::size_t(1) << (bucket - 1);
+    }
+
+    void add(std::size_t value) {
+        std::size_t bucket = bucket_of(value);
+        if (m_buckets.size() <= bucket) m_buckets.resize(bucket + 1, 0);
+        ++m_buckets[bucket];
+        ++m_count;
+        m_sum += value;
+        m_max = std::max(m_max, value);
+    }
+    /// Add all values of another histogram.
+    void merge(const histogram& other) {
+        if (m_buckets.size() < other.m_buckets.size()) m_buckets.resize(other.m_buckets.size(), 0);
+        for (std::size_t i = 0; i < other.m_buckets.size(); ++i) {
+            m_buckets[i] += other.m_buckets[i];
+        }
+        m_count += other.m_count;
+        m_sum += other.m_sum;
+        m_max = std::max(m_max, other.m_max);
+    }
+    /// Set the histogram from the given bucket counts, the sum and the maximum of the values.
+    void assign(std::vector<std::size_t>&& buckets, std::size_t sum, std::size_t max) {
+        m_buckets = std::move(buckets);
+        while (!m_buckets.empty() && m_buckets.back() == 0) m_buckets.pop_back();
+        m_count = 0;
+        for (auto b: m_buckets) m_count += b;
+        m_sum = sum;
+        m_max = max;
+    }
+    void clear() {
+        m_buckets.clear();
+        m_count = 0;
+        m_sum = 0;
+        m_max = 0;
+    }
+
+    const auto& buckets() const {
+        return m_buckets;
+    }
+    auto count() const {
+        return m_count;
+    }
+    auto sum() const {
+        return m_sum;
+    }
+    auto max() const {
+        return m_max;
+    }
+    double mean() const {
+        if (m_count == 0) return 0;
+        return static_cast<double>(m_sum) / static_cast<double>(m_count);
+    }
+    /**
+     * Return an approximation of the given quantile, where q is between zero and one.
+     * The value is interpolated linearly within the bucket that contains the quantile.
+     */
+    std::size_t quantile(double q) const {
+        if (m_count == 0) return 0;
+        double rank = std::clamp(q, 0.0, 1.0) * static_cast<double>(m_count);
+        std::size_t seen = 0;
+        for (std::size_t i = 0; i < m_buckets.size(); ++i) {
+            if (m_buckets[i] == 0) continue;
+            if (static_cast<double>(seen + m_buckets[i]) >= rank) {
+                double lower = static_cast<double>(lower_bound(i));
+                double upper = static_cast<double>(i < 64 ? std::min(m_max, lower_bound(i + 1) - 1) : m_max);
+                double fraction = (rank - static_cast<double>(seen)) / static_cast<double>(m_buckets[i]);
+                return static_cast<std::size_t>(lower + std::max(0.0, fraction) * (upper - lower));
+            }
+            seen += m_buckets[i];
+        }
+        return m_max;
+    }
+};
+
+}
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "Metrics.h"
+#include "Statistics.h"
+#include "StatisticsCollector.h"
+#include "Timing.h"
+
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace carl {
+namespace statistics {
+
+/**
+ * Size of the input of an operation.
+ * For multiple inputs, degree and bits are the maxima and terms is the sum over all inputs.
+ */
+struct input_size {
+    std::size_t degree = 0;
+    std::size_t terms = 0;
+    std::size_t bits = 0;
+};
+
+/**
+ * Statistics of a single instrumented operation: the number of calls, the overall running time
+ * as well as histograms of the running times and the input sizes.
+ * All metrics are updated concurrently, thus an operation may be called from multiple threads.
+ */
+class OperationStatistics: public Statistics {
+public:
+    counter calls;
+    counter time_ns;
+    concurrent_histogram latency_ns;
+    concurrent_histogram degree;
+    concurrent_histogram terms;
+    concurrent_histogram bits;
+
+    OperationStatistics() {
+        addMetric("calls", calls);
+        addMetric("time_ns", time_ns);
+        addMetric("latency_ns", latency_ns);
+        addMetric("degree", degree);
+        addMetric("terms", terms);
+        addMetric("bits", bits);
+    }
+    void record(const input_size& size, std::size_t ns) {
+        calls.inc();
+        time_ns.inc(ns);
+        latency_ns.add(ns);
+        degree.add(size.degree);
+        terms.add(size.terms);
+        bits.add(size.bits);
+    }
+};
+
+/**
+ * Return the statistics of the operation with the given name, which are registered on first use.
+ * All call sites that use the same name share their statistics.
+ */
+inline OperationStatistics& operation_statistics(const std::string& name) {
+    static std::mutex mutex;
+    static std::map<std::string, OperationStatistics*> operations;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = operations.find(name);
+    if (it != operations.end()) return *it->second;
+    auto& res = get<OperationStatistics>(name);
+    operations.emplace(name, &res);
+    return res;
+}
+
+/**
+ * Records a call of an operation from its construction to its destruction.
+ */
+class operation_scope {
+    OperationStatistics& m_statistics;
+    input_size m_size;
+    timing::time_point m_start;
+public:
+    operation_scope(OperationStatistics& statistics, const input_size& size):
+        m_statistics(statistics), m_size(size), m_start(timing::now())
+    {}
+    ~operation_scope() {
+        m_statistics.record(m_size, timing::since(m_start).count());
+    }
+    operation_scope(const operation_scope&) = delete;
+    operation_scope& operator=(const operation_scope&) = delete;
+};
+
+}
+}
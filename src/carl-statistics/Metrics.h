@@ -0,0 +1,84 @@
+#pragma once
+
+#include "Histogram.h"
+#include "Timing.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace carl {
+namespace statistics {
+
+/**
+ * Monotonically increasing count of events.
+ * Metrics can be updated and read concurrently, such that they can be exported while carl is running.
+ */
+class counter {
+    std::atomic<std::uint64_t> m_value = 0;
+public:
+    void inc(std::uint64_t n = 1) noexcept {
+        m_value.fetch_add(n, std::memory_order_relaxed);
+    }
+    std::uint64_t value() const noexcept {
+        return m_value.load(std::memory_order_relaxed);
+    }
+};
+
+/**
+ * Value that can go up and down, for example the size of a pool.
+ */
+class gauge {
+    std::atomic<std::int64_t> m_value = 0;
+public:
+    void set(std::int64_t value) noexcept {
+        m_value.store(value, std::memory_order_relaxed);
+    }
+    void add(std::int64_t n) noexcept {
+        m_value.fetch_add(n, std::memory_order_relaxed);
+    }
+    std::int64_t value() const noexcept {
+        return m_value.load(std::memory_order_relaxed);
+    }
+};
+
+/**
+ * Histogram that can be updated and read concurrently.
+ * Uses the same buckets as histogram, to which it can be converted.
+ */
+class concurrent_histogram {
+    std::array<std::atomic<std::size_t>, 65> m_buckets = {};
+    std::atomic<std::size_t> m_sum = 0;
+    std::atomic<std::size_t> m_max = 0;
+
+    static std::size_t bucket_of(std::size_t value) {
+        std::size_t res = 0;
+        while (value > 0) {
+            value >>= 1;
+            ++res;
+        }
+        return res;
+    }
+public:
+    void add(std::size_t value) noexcept {
+        m_buckets[bucket_of(value)].fetch_add(1, std::memory_order_relaxed);
+        m_sum.fetch_add(value, std::memory_order_relaxed);
+        std::size_t max = m_max.load(std::memory_order_relaxed);
+        while (max < value && !m_max.compare_exchange_weak(max, value, std::memory_order_relaxed));
+    }
+    /// Add the running time since start in nanoseconds, such that the histogram can be used like a timer.
+    void finish(timing::time_point start) noexcept {
+        add(timing::since(start).count());
+    }
+    /// Return the current state. Concurrent updates may only be partially visible.
+    histogram value() const {
+        histogram res;
+        std::vector<std::size_t> buckets;
+        for (const auto& b: m_buckets) buckets.push_back(b.load(std::memory_order_relaxed));
+        res.assign(std::move(buckets), m_sum.load(std::memory_order_relaxed), m_max.load(std::memory_order_relaxed));
+        return res;
+    }
+};
+
+}
+}
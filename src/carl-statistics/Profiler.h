@@ -0,0 +1,224 @@
+#pragma once
+
+#include "../carl/util/Singleton.h"
+#include "Statistics.h"
+#include "Timing.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace carl {
+namespace statistics {
+
+/**
+ * Call tree of the profiling scopes of a single thread.
+ * Only the owning thread enters and leaves scopes, other threads may only read the tree using merge_into().
+ * The owning thread never locks: children are published through atomic pointers and every counter of a scope has the owning thread as its single writer.
+ * merge_into() and reset() must not be called concurrently with each other, the profiler calls them while holding its mutex.
+ */
+class call_tree {
+public:
+    /**
+     * Running times of a scope in ticks, stored like a histogram.
+     * The owning thread updates a counter by a plain load and store, readers may see a concurrent update only partially.
+     */
+    class recorder {
+        std::array<std::atomic<std::uint64_t>, 65> m_buckets = {};
+        std::atomic<std::uint64_t> m_sum = 0;
+        std::atomic<std::uint64_t> m_max = 0;
+        /// State at the last reset, only accessed by readers.
+        histogram m_baseline;
+
+        static void add(std::atomic<std::uint64_t>& counter, std::uint64_t value) noexcept {
+            counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+        }
+        histogram current() const {
+            histogram res;
+            std::vector<std::size_t> buckets;
+            for (const auto& b: m_buckets) buckets.push_back(b.load(std::memory_order_relaxed));
+            res.assign(std::move(buckets), m_sum.load(std::memory_order_relaxed), m_max.load(std::memory_order_relaxed));
+            return res;
+        }
+    public:
+        /// Record the running time since start, may only be called by the owning thread.
+        void finish(timing::time_point start) noexcept {
+            auto ticks = timing::ticks_since(start);
+            add(m_buckets[histogram::bucket_of(ticks)], 1);
+            add(m_sum, ticks);
+            if (ticks > m_max.load(std::memory_order_relaxed)) m_max.store(ticks, std::memory_order_relaxed);
+        }
+        /**
+         * Return the running times since the last reset.
+         * The maximum is not reset, hence it is bounded by the largest bucket that has been used since.
+         */
+        timer value() const {
+            histogram h = current();
+            std::vector<std::size_t> buckets = h.buckets();
+            std::size_t max = 0;
+            for (std::size_t i = 0; i < buckets.size(); ++i) {
+                if (i < m_baseline.buckets().size()) buckets[i] -= m_baseline.buckets()[i];
+                if (buckets[i] > 0) max = i < 64 ? std::min(h.max(), histogram::lower_bound(i + 1) - 1) : h.max();
+            }
+            h.assign(std::move(buckets), h.sum() - m_baseline.sum(), max);
+            timer res;
+            res.assign(std::move(h));
+            return res;
+        }
+        /// Forget all running times recorded so far.
+        void reset() {
+            m_baseline = current();
+        }
+    };
+    struct node {
+        const char* name;
+        node* parent;
+        recorder time;
+        /// Most recently created child, the children are linked by next_sibling.
+        std::atomic<node*> first_child = nullptr;
+        /// Next older sibling, it does not change after the node has been published.
+        std::unique_ptr<node> next_sibling;
+        node(const char* n, node* p): name(n), parent(p) {}
+        ~node() {
+            delete first_child.load(std::memory_order_relaxed);
+        }
+    };
+private:
+    node m_root = node("", nullptr);
+    node* m_current = &m_root;
+
+    static void merge_into(const node& n, const std::string& path, std::map<std::string,timer>& result) {
+        for (const node* c = n.first_child.load(std::memory_order_acquire); c != nullptr; c = c->next_sibling.get()) {
+            std::string p = path.empty() ? std::string(c->name) : path + "/" + c->name;
+            result[p].merge(c->time.value());
+            merge_into(*c, p, result);
+        }
+    }
+    static void reset(node& n) {
+        for (node* c = n.first_child.load(std::memory_order_acquire); c != nullptr; c = c->next_sibling.get()) {
+            c->time.reset();
+            reset(*c);
+        }
+    }
+public:
+    /**
+     * Enter the scope with the given name as a child of the current scope.
+     * Names are usually string literals and are compared by address first.
+     */
+    node* enter(const char* name) {
+        node* first = m_current->first_child.load(std::memory_order_relaxed);
+        for (node* c = first; c != nullptr; c = c->next_sibling.get()) {
+            if (c->name == name || std::strcmp(c->name, name) == 0) {
+                m_current = c;
+                return m_current;
+            }
+        }
+        auto child = std::make_unique<node>(name, m_current);
+        child->next_sibling.reset(first);
+        m_current->first_child.store(child.get(), std::memory_order_release);
+        m_current = child.release();
+        return m_current;
+    }
+    /// Leave the given scope, that must be the current scope, and record its running time.
+    void leave(node* n, timing::time_point start) noexcept {
+        n->time.finish(start);
+        m_current = n->parent;
+    }
+    /// Add the timers of all scopes to result, identified by the path of scope names separated by slashes.
+    void merge_into(std::map<std::string,timer>& result) const {
+        merge_into(m_root, "", result);
+    }
+    /// Reset all timers, but keep the scopes.
+    void reset() {
+        reset(m_root);
+    }
+};
+
+/**
+ * Hierarchical profiler.
+ * Every thread records its profiling scopes in a call tree of its own without locking, hence there is no contention between threads.
+ * Only collect() and reset() synchronize.
+ * collect() aggregates the call trees of all threads, including threads that have already terminated.
+ * Profiling can be disabled at runtime, then a scope only costs a single relaxed atomic load.
+ */
+class profiler: public carl::Singleton<profiler> {
+    friend carl::Singleton<profiler>;
+    std::atomic<bool> m_enabled = true;
+    mutable std::mutex m_mutex;
+    std::vector<std::shared_ptr<call_tree>> m_trees;
+
+    profiler() = default;
+public:
+    bool enabled() const noexcept {
+        return m_enabled.load(std::memory_order_relaxed);
+    }
+    void enable(bool enabled) noexcept {
+        m_enabled.store(enabled, std::memory_order_relaxed);
+    }
+    /// Return the call tree of the calling thread.
+    call_tree& local() {
+        static thread_local std::shared_ptr<call_tree> tree = [this](){
+            auto res = std::make_shared<call_tree>();
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_trees.push_back(res);
+            return res;
+        }();
+        return *tree;
+    }
+    /// Return the merged timers of all threads, identified by the path of scope names separated by slashes.
+    std::map<std::string,timer> collect() const {
+        std::map<std::string,timer> result;
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (const auto& t: m_trees) t->merge_into(result);
+        return result;
+    }
+    void reset() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto& t: m_trees) t->reset();
+    }
+};
+
+/**
+ * Profiling scope that measures its lifetime.
+ * Scopes that are alive at the same time on the same thread are nested in the call tree.
+ */
+class profile_scope {
+    call_tree* m_tree = nullptr;
+    call_tree::node* m_node = nullptr;
+    timing::time_point m_start = 0;
+public:
+    explicit profile_scope(const char* name) {
+        auto& p = profiler::getInstance();
+        if (!p.enabled()) return;
+        m_tree = &p.local();
+        m_node = m_tree->enter(name);
+        m_start = timing::now();
+    }
+    ~profile_scope() {
+        if (m_tree != nullptr) m_tree->leave(m_node, m_start);
+    }
+    profile_scope(const profile_scope&) = delete;
+    profile_scope& operator=(const profile_scope&) = delete;
+};
+
+/**
+ * Exports the results of the profiler.
+ * Register it like any other statistics, for example using `carl::statistics::get<profile_statistics>("profile")`.
+ */
+class profile_statistics: public Statistics {
+public:
+    void collect() override {
+        for (const auto& kv: profiler::getInstance().collect()) {
+            addKeyValuePair(kv.first, kv.second);
+        }
+    }
+};
+
+}
+}
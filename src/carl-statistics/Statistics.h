@@ -1,39 +1,77 @@
 #pragma once
 
+#include "Histogram.h"
+#include "Metrics.h"
 #include "StatisticsCollector.h"
 #include "Timing.h"
 
 #include <map>
+#include <mutex>
 #include <sstream>
 #include <algorithm>
+#include <variant>
 #include <assert.h>
 
 namespace carl {
 namespace statistics {
 
 class Statistics {
+public:
+	/// Reference to a metric that is owned by the Statistics object.
+	using Metric = std::variant<const counter*, const gauge*, const concurrent_histogram*>;
 private:
 	std::string mName;
 	std::map<std::string, std::string> mCollected;
+	std::map<std::string, Metric> mMetrics;
+	/// Protects mCollected against concurrent exports.
+	mutable std::mutex mMutex;
 	bool has_illegal_chars(const std::string& val) const {
 		return std::find_if(val.begin(), val.end(), [](char c) {
 				return c == '(' || c == ')' || std::isspace(static_cast<unsigned char>(c));
 			}) != val.end();
 	}
 protected:
+	/**
+	 * Registers a metric, usually a member of the derived class.
+	 * Unlike key value pairs, metrics are read whenever the statistics are exported and need not be collected.
+	 */
+	template<typename T>
+	void addMetric(const std::string& key, const T& metric) {
+		assert(!has_illegal_chars(key) && "spaces, (, ) are not allowed here");
+		std::lock_guard<std::mutex> lock(mMutex);
+		mMetrics.emplace(key, &metric);
+	}
+	/**
+	 * Sets a key value pair, replacing the value from a previous call to collect().
+	 */
 	template<typename T>
 	void addKeyValuePair(const std::string& key, const T& value) {
 		assert(!has_illegal_chars(key) && "spaces, (, ) are not allowed here");
+		std::lock_guard<std::mutex> lock(mMutex);
 		if constexpr(std::is_same<T,std::string>::value) {
 			assert(!has_illegal_chars(static_cast<std::string>(value)) && "spaces, (, ) are not allowed here");
-			mCollected.emplace(key, value);
+			mCollected.insert_or_assign(key, value);
 		} else if constexpr(std::is_same<T,timer>::value) {
-			mCollected.emplace(key+"_count", std::to_string(static_cast<timer>(value).count()));
-			mCollected.emplace(key+"_overall_ms", std::to_string(static_cast<timer>(value).overall_ms()));
+			mCollected.insert_or_assign(key+"_count", std::to_string(value.count()));
+			mCollected.insert_or_assign(key+"_overall_ms", std::to_string(value.overall_ms()));
+			mCollected.insert_or_assign(key+"_overall_ns", std::to_string(value.overall_ns()));
+			mCollected.insert_or_assign(key+"_p50_ns", std::to_string(value.percentile_ns(50)));
+			mCollected.insert_or_assign(key+"_p99_ns", std::to_string(value.percentile_ns(99)));
+		} else if constexpr(std::is_same<T,histogram>::value) {
+			mCollected.insert_or_assign(key+"_count", std::to_string(value.count()));
+			mCollected.insert_or_assign(key+"_max", std::to_string(value.max()));
+			mCollected.insert_or_assign(key+"_mean", std::to_string(value.mean()));
+			std::stringstream ss;
+			for (std::size_t i = 0; i < value.buckets().size(); ++i) {
+				if (value.buckets()[i] == 0) continue;
+				if (ss.tellp() > 0) ss << ",";
+				ss << histogram::lower_bound(i) << ":" << value.buckets()[i];
+			}
+			mCollected.insert_or_assign(key+"_histogram", ss.str());
 		} else {
 			std::stringstream ss;
 			ss << value;
-			mCollected.emplace(key, ss.str());
+			mCollected.insert_or_assign(key, ss.str());
 		}
 	}
 public:
@@ -59,6 +97,14 @@ public:
 	const auto& collected() const {
 		return mCollected;
 	}
+	/// Return a copy of the collected key value pairs that is safe to use while collect() is running.
+	std::map<std::string, std::string> collected_snapshot() const {
+		std::lock_guard<std::mutex> lock(mMutex);
+		return mCollected;
+	}
+	const auto& metrics() const {
+		return mMetrics;
+	}
 };
 
 }
@@ -6,7 +6,13 @@ namespace carl {
 namespace statistics {
 
 void StatisticsCollector::collect() {
-	for (auto& s: mStatistics) {
+	std::lock_guard<std::mutex> lock(mCollectMutex);
+	std::vector<Statistics*> statistics;
+	{
+		std::lock_guard<std::mutex> statisticsLock(mMutex);
+		for (const auto& s: mStatistics) statistics.push_back(s.get());
+	}
+	for (auto* s: statistics) {
 		if (s->enabled()) {
 			s->collect();
 		}
@@ -3,6 +3,7 @@
 #include "../carl/util/Singleton.h"
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -14,19 +15,32 @@ class Statistics;
 class StatisticsCollector: public carl::Singleton<StatisticsCollector> {
 private:
 	std::vector<std::unique_ptr<Statistics>> mStatistics;
+	/// Protects mStatistics, as statistics may be exported by a background thread.
+	mutable std::mutex mMutex;
+	/// Ensures that the statistics are collected by a single thread at a time.
+	std::mutex mCollectMutex;
 public:
 	template<typename T>
 	T& get(const std::string& name) {
+		std::lock_guard<std::mutex> lock(mMutex);
 		auto& ptr = mStatistics.emplace_back(std::make_unique<T>());
 		ptr->set_name(name);
 		return static_cast<T&>(*ptr);
 	}
 
+	/// Collect all enabled statistics, may be called concurrently, for example by a StatisticsSnapshotWriter.
 	void collect();
 
 	const auto& statistics() const {
 		return mStatistics;
 	}
+	/// Return the currently registered statistics, which is safe to use while statistics are registered.
+	std::vector<const Statistics*> snapshot() const {
+		std::lock_guard<std::mutex> lock(mMutex);
+		std::vector<const Statistics*> res;
+		for (const auto& s: mStatistics) res.push_back(s.get());
+		return res;
+	}
 };
 
 template<typename T>
@@ -3,6 +3,8 @@
 #include "Statistics.h"
 #include "StatisticsCollector.h"
 
+#include <cctype>
+#include <cstdlib>
 #include <fstream>
 #include <iostream>
 #include <iomanip>
@@ -12,9 +14,69 @@ namespace statistics {
 
 enum class StatisticsOutputFormat {
 	SMTLIB,
-	XML
+	XML,
+	JSON,
+	PROMETHEUS
 };
 
+namespace detail {
+	/// Return the percentile of a histogram, which is a string to print it like other collected values.
+	inline std::string percentile(const histogram& h, double p) {
+		return std::to_string(h.quantile(p / 100));
+	}
+	/// Return the collected key value pairs together with the current values of the metrics.
+	inline std::map<std::string, std::string> key_values(const Statistics& s) {
+		auto res = s.collected_snapshot();
+		for (const auto& m: s.metrics()) {
+			if (auto c = std::get_if<const counter*>(&m.second)) {
+				res.emplace(m.first, std::to_string((*c)->value()));
+			} else if (auto g = std::get_if<const gauge*>(&m.second)) {
+				res.emplace(m.first, std::to_string((*g)->value()));
+			} else {
+				auto h = std::get<const concurrent_histogram*>(m.second)->value();
+				res.emplace(m.first+"_count", std::to_string(h.count()));
+				res.emplace(m.first+"_max", std::to_string(h.max()));
+				res.emplace(m.first+"_mean", std::to_string(h.mean()));
+				res.emplace(m.first+"_p50", percentile(h, 50));
+				res.emplace(m.first+"_p99", percentile(h, 99));
+			}
+		}
+		return res;
+	}
+	/// Check whether a collected value is a number that can be printed without quotes.
+	inline bool is_number(const std::string& value) {
+		std::size_t first = (!value.empty() && value.front() == '-') ? 1 : 0;
+		// Exclude values like nan, inf or hexadecimal numbers that strtod accepts.
+		if (value.size() <= first || !std::isdigit(static_cast<unsigned char>(value[first]))) return false;
+		if (value.find_first_of("xX") != std::string::npos) return false;
+		char* end = nullptr;
+		std::strtod(value.c_str(), &end);
+		return *end == '\0';
+	}
+	inline std::string json_escape(const std::string& s) {
+		std::stringstream ss;
+		for (char c: s) {
+			switch (c) {
+				case '"': ss << "\\\""; break;
+				case '\\': ss << "\\\\"; break;
+				case '\n': ss << "\\n"; break;
+				default:
+					if (static_cast<unsigned char>(c) < 0x20) ss << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+					else ss << c;
+			}
+		}
+		return ss.str();
+	}
+	/// Turn module and key into a valid Prometheus metric name.
+	inline std::string prometheus_name(const std::string& module, const std::string& key) {
+		std::string res = "carl_" + module + "_" + key;
+		for (auto& c: res) {
+			if (!std::isalnum(static_cast<unsigned char>(c)) && c != '_' && c != ':') c = '_';
+		}
+		return res;
+	}
+}
+
 template<StatisticsOutputFormat SOF>
 struct StatisticsPrinter {};
 
@@ -22,15 +84,16 @@ template<StatisticsOutputFormat SOF>
 std::ostream& operator<<(std::ostream& os, StatisticsPrinter<SOF>);
 
 template<>
-std::ostream& operator<<(std::ostream& os, StatisticsPrinter<StatisticsOutputFormat::SMTLIB>) {
-	for (const auto& s: StatisticsCollector::getInstance().statistics()) {
-		if (s->collected().empty()) continue;
+inline std::ostream& operator<<(std::ostream& os, StatisticsPrinter<StatisticsOutputFormat::SMTLIB>) {
+	for (const auto& s: StatisticsCollector::getInstance().snapshot()) {
+		auto collected = detail::key_values(*s);
+		if (collected.empty()) continue;
 		os << "(:" << s->name() << " (" << std::endl;
 		std::size_t max_width = 0;
-		for (const auto& kv: s->collected()) {
+		for (const auto& kv: collected) {
 			max_width = std::max(max_width, kv.first.size());
 		}
-		for (const auto& kv: s->collected()) {
+		for (const auto& kv: collected) {
 			os << "\t:" << std::setw(static_cast<int>(max_width)) << std::left << kv.first << " " << kv.second << std::endl;
 		}
 		os << "))" << std::endl;
@@ -39,14 +102,15 @@ std::ostream& operator<<(std::ostream& os, StatisticsPrinter<StatisticsOutputFor
 }
 
 template<>
-std::ostream& operator<<(std::ostream& os, StatisticsPrinter<StatisticsOutputFormat::XML>) {
-	for (const auto& s: StatisticsCollector::getInstance().statistics()) {
-		if (s->collected().empty()) continue;
+inline std::ostream& operator<<(std::ostream& os, StatisticsPrinter<StatisticsOutputFormat::XML>) {
+	for (const auto& s: StatisticsCollector::getInstance().snapshot()) {
+		auto collected = detail::key_values(*s);
+		if (collected.empty()) continue;
 		std::string name = s->name();
 		std::replace(name.begin(), name.end(), '<', '(');
 		std::replace(name.begin(), name.end(), '>', ')');
 		os << "\t<module name=\"" << name << "\">\n"; 
-		for (const auto& kv: s->collected()) {
+		for (const auto& kv: collected) {
 			os << "\t\t<stat name=\"" << kv.first << "\" value=\"" << kv.second << "\" />\n";
 		}
 		os << "\t</module>\n"; 
@@ -54,14 +118,103 @@ std::ostream& operator<<(std::ostream& os, StatisticsPrinter<StatisticsOutputFor
 	return os;
 }
 
-auto statistics_as_smtlib() {
+/**
+ * Prints all statistics as a single JSON object that maps module names to objects of statistics.
+ * Counters, gauges and numeric values are printed as numbers, histograms as objects and other values as strings.
+ */
+template<>
+inline std::ostream& operator<<(std::ostream& os, StatisticsPrinter<StatisticsOutputFormat::JSON>) {
+	os << "{";
+	bool first_module = true;
+	for (const auto& s: StatisticsCollector::getInstance().snapshot()) {
+		auto collected = s->collected_snapshot();
+		if (collected.empty() && s->metrics().empty()) continue;
+		os << (first_module ? "" : ",") << "\n\t\"" << detail::json_escape(s->name()) << "\": {";
+		first_module = false;
+		bool first = true;
+		auto key = [&os, &first](const std::string& k) -> std::ostream& {
+			os << (first ? "" : ",") << "\n\t\t\"" << detail::json_escape(k) << "\": ";
+			first = false;
+			return os;
+		};
+		for (const auto& kv: collected) {
+			if (detail::is_number(kv.second)) key(kv.first) << kv.second;
+			else key(kv.first) << "\"" << detail::json_escape(kv.second) << "\"";
+		}
+		for (const auto& m: s->metrics()) {
+			if (auto c = std::get_if<const counter*>(&m.second)) {
+				key(m.first) << (*c)->value();
+			} else if (auto g = std::get_if<const gauge*>(&m.second)) {
+				key(m.first) << (*g)->value();
+			} else {
+				auto h = std::get<const concurrent_histogram*>(m.second)->value();
+				key(m.first) << "{\"count\": " << h.count() << ", \"sum\": " << h.sum() << ", \"max\": " << h.max();
+				os << ", \"p50\": " << detail::percentile(h, 50) << ", \"p99\": " << detail::percentile(h, 99) << ", \"buckets\": {";
+				bool first_bucket = true;
+				for (std::size_t i = 0; i < h.buckets().size(); ++i) {
+					if (h.buckets()[i] == 0) continue;
+					os << (first_bucket ? "" : ", ") << "\"" << histogram::lower_bound(i) << "\": " << h.buckets()[i];
+					first_bucket = false;
+				}
+				os << "}}";
+			}
+		}
+		os << "\n\t}";
+	}
+	os << "\n}" << std::endl;
+	return os;
+}
+
+/**
+ * Prints all statistics in the Prometheus text exposition format.
+ * Metrics are named `carl_<module>_<key>`, collected values that are not numbers are omitted.
+ */
+template<>
+inline std::ostream& operator<<(std::ostream& os, StatisticsPrinter<StatisticsOutputFormat::PROMETHEUS>) {
+	for (const auto& s: StatisticsCollector::getInstance().snapshot()) {
+		for (const auto& kv: s->collected_snapshot()) {
+			if (!detail::is_number(kv.second)) continue;
+			auto name = detail::prometheus_name(s->name(), kv.first);
+			os << "# TYPE " << name << " untyped\n" << name << " " << kv.second << "\n";
+		}
+		for (const auto& m: s->metrics()) {
+			auto name = detail::prometheus_name(s->name(), m.first);
+			if (auto c = std::get_if<const counter*>(&m.second)) {
+				os << "# TYPE " << name << " counter\n" << name << " " << (*c)->value() << "\n";
+			} else if (auto g = std::get_if<const gauge*>(&m.second)) {
+				os << "# TYPE " << name << " gauge\n" << name << " " << (*g)->value() << "\n";
+			} else {
+				auto h = std::get<const concurrent_histogram*>(m.second)->value();
+				os << "# TYPE " << name << " histogram\n";
+				std::size_t cumulative = 0;
+				// The last bucket has no finite upper bound and is only covered by +Inf.
+				for (std::size_t i = 0; i < std::min<std::size_t>(h.buckets().size(), 64); ++i) {
+					cumulative += h.buckets()[i];
+					os << name << "_bucket{le=\"" << (histogram::lower_bound(i + 1) - 1) << "\"} " << cumulative << "\n";
+				}
+				os << name << "_bucket{le=\"+Inf\"} " << h.count() << "\n";
+				os << name << "_sum " << h.sum() << "\n";
+				os << name << "_count " << h.count() << "\n";
+			}
+		}
+	}
+	return os;
+}
+
+inline auto statistics_as_smtlib() {
 	return StatisticsPrinter<StatisticsOutputFormat::SMTLIB>();
 }
-auto statistics_as_xml() {
+inline auto statistics_as_xml() {
 	return StatisticsPrinter<StatisticsOutputFormat::XML>();
 }
+inline auto statistics_as_json() {
+	return StatisticsPrinter<StatisticsOutputFormat::JSON>();
+}
+inline auto statistics_as_prometheus() {
+	return StatisticsPrinter<StatisticsOutputFormat::PROMETHEUS>();
+}
 
-void statistics_to_xml_file(const std::string& filename) {
+inline void statistics_to_xml_file(const std::string& filename) {
 	std::ofstream file;
 	file.open(filename, std::ios::out);
 	file << "<runtimestats>" << std::endl;
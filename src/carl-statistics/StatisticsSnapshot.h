@@ -0,0 +1,89 @@
+#pragma once
+
+#include "StatisticsPrinter.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace carl {
+namespace statistics {
+
+/**
+ * Writes the current statistics to a file.
+ * The file is written to a temporary file first and then renamed, hence readers never observe a partially written file.
+ * @return If the file was written successfully.
+ */
+inline bool statistics_to_file(const std::string& filename, StatisticsOutputFormat format) {
+	std::string tmp = filename + ".tmp";
+	{
+		std::ofstream file(tmp, std::ios::out);
+		switch (format) {
+			case StatisticsOutputFormat::SMTLIB: file << statistics_as_smtlib(); break;
+			case StatisticsOutputFormat::XML: file << "<runtimestats>" << std::endl << statistics_as_xml() << "</runtimestats>" << std::endl; break;
+			case StatisticsOutputFormat::JSON: file << statistics_as_json(); break;
+			case StatisticsOutputFormat::PROMETHEUS: file << statistics_as_prometheus(); break;
+		}
+		if (!file) return false;
+	}
+	return std::rename(tmp.c_str(), filename.c_str()) == 0;
+}
+
+/**
+ * Periodically writes snapshots of the statistics to a file from a background thread.
+ * This allows to monitor long running processes, for example by pointing the textfile collector of a Prometheus node exporter to the file.
+ * Before every snapshot, the writer calls StatisticsCollector::collect(), hence snapshots contain current key value pairs and the current values of all metrics.
+ */
+class StatisticsSnapshotWriter {
+	std::thread mThread;
+	std::mutex mMutex;
+	std::condition_variable mCondition;
+	bool mStop = false;
+public:
+	StatisticsSnapshotWriter() = default;
+	StatisticsSnapshotWriter(const StatisticsSnapshotWriter&) = delete;
+	StatisticsSnapshotWriter& operator=(const StatisticsSnapshotWriter&) = delete;
+	~StatisticsSnapshotWriter() {
+		stop();
+	}
+
+	/**
+	 * Starts writing snapshots, replacing a previous configuration.
+	 * @param filename File that is overwritten with every snapshot.
+	 * @param interval Time between two snapshots.
+	 * @param format Output format.
+	 */
+	void start(const std::string& filename, std::chrono::milliseconds interval, StatisticsOutputFormat format = StatisticsOutputFormat::JSON) {
+		stop();
+		mStop = false;
+		mThread = std::thread([this, filename, interval, format](){
+			std::unique_lock<std::mutex> lock(mMutex);
+			while (!mCondition.wait_for(lock, interval, [this](){ return mStop; })) {
+				StatisticsCollector::getInstance().collect();
+				statistics_to_file(filename, format);
+			}
+			// A final snapshot contains the last state.
+			StatisticsCollector::getInstance().collect();
+			statistics_to_file(filename, format);
+		});
+	}
+	/// Stops writing snapshots after writing a final one.
+	void stop() {
+		if (!mThread.joinable()) return;
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			mStop = true;
+		}
+		mCondition.notify_one();
+		mThread.join();
+	}
+	bool running() const {
+		return mThread.joinable();
+	}
+};
+
+}
+}
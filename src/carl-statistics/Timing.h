@@ -1,25 +1,73 @@
 #pragma once
 
+#include "Histogram.h"
+
 #include <chrono>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define CARL_STATISTICS_TSC
+#endif
 
 namespace carl {
 namespace statistics {
 
 namespace timing {
     /// The clock type used here.
-    using clock = std::chrono::high_resolution_clock;
+    using clock = std::chrono::steady_clock;
     /// The duration type used here.
-    using duration = std::chrono::duration<std::size_t,std::milli>;
-    /// The type of a time point.
-    using time_point = clock::time_point;
+    using duration = std::chrono::duration<std::size_t,std::nano>;
+    /**
+     * The type of a time point, given in ticks.
+     * If available, ticks are read from the time stamp counter of the processor. Otherwise, ticks are the nanoseconds of clock.
+     */
+    using time_point = std::uint64_t;
 
     /// Return the current time point.
-    inline auto now() {
-        return clock::now();
+    inline time_point now() noexcept {
+#ifdef CARL_STATISTICS_TSC
+        return __rdtsc();
+#else
+        return static_cast<time_point>(std::chrono::duration_cast<duration>(clock::now().time_since_epoch()).count());
+#endif
+    }
+
+    /**
+     * Return the number of nanoseconds per tick.
+     * The time stamp counter is calibrated against clock once, during the first call, over one millisecond.
+     * Thus, the first call should happen before any measurement, which is ensured by the constructor of timer.
+     */
+    inline double nanoseconds_per_tick() noexcept {
+#ifdef CARL_STATISTICS_TSC
+        static const double ratio = [](){
+            auto start = clock::now();
+            auto start_ticks = now();
+            std::size_t ns = 0;
+            std::uint64_t ticks = 0;
+            do {
+                ns = static_cast<std::size_t>(std::chrono::duration_cast<duration>(clock::now() - start).count());
+                ticks = now() - start_ticks;
+            } while (ns < 1000000);
+            return static_cast<double>(ns) / static_cast<double>(ticks);
+        }();
+        return ratio;
+#else
+        return 1;
+#endif
+    }
+    /// Convert a number of ticks to a duration.
+    inline duration to_duration(std::uint64_t ticks) noexcept {
+        return duration(static_cast<std::size_t>(static_cast<double>(ticks) * nanoseconds_per_tick()));
+    }
+
+    /// Return the number of ticks since the given start time point.
+    inline std::uint64_t ticks_since(time_point start) noexcept {
+        return now() - start;
     }
     /// Return the duration since the given start time point.
-    inline auto since(time_point start) {
-        return std::chrono::duration_cast<duration>(clock::now() - start);
+    inline auto since(time_point start) noexcept {
+        return to_duration(ticks_since(start));
     }
     /// Return a zero duration.
     inline auto zero() {
@@ -27,25 +75,59 @@ namespace timing {
     }
 }
 
+/**
+ * Accumulates the running times of some operation.
+ * Times are recorded as raw ticks and only converted to nanoseconds when they are read.
+ * Additionally, a histogram of the individual running times allows to retrieve percentiles of the latency.
+ * A timer is not synchronized. Threads should use separate timers that are merged afterwards.
+ */
 class timer {
     std::size_t m_count = 0;
-    timing::duration m_overall = timing::zero();
+    std::uint64_t m_overall = 0;
+    histogram m_latencies;
 
 public:
+    timer() noexcept {
+        timing::nanoseconds_per_tick();
+    }
     static timing::time_point start() {
 		return timing::now();
 	}
     void finish(timing::time_point start) {
+		auto ticks = timing::ticks_since(start);
 		++m_count;
-		m_overall += timing::since(start);
+		m_overall += ticks;
+		m_latencies.add(ticks);
 	}
+    /// Set the measurements from a histogram of the individual running times in ticks.
+    void assign(histogram&& latencies) {
+        m_count = latencies.count();
+        m_overall = latencies.sum();
+        m_latencies = std::move(latencies);
+    }
+    /// Add the measurements of another timer.
+    void merge(const timer& other) {
+        m_count += other.m_count;
+        m_overall += other.m_overall;
+        m_latencies.merge(other.m_latencies);
+    }
     auto count() const {
         return m_count;
     }
+    auto overall() const {
+        return timing::to_duration(m_overall);
+    }
+    auto overall_ns() const {
+        return overall().count();
+    }
     auto overall_ms() const {
-        return m_overall.count();
+        return std::chrono::duration_cast<std::chrono::milliseconds>(overall()).count();
+    }
+    /// Return an approximation of the given percentile of the individual running times in nanoseconds.
+    auto percentile_ns(double p) const {
+        return timing::to_duration(m_latencies.quantile(p / 100)).count();
     }
 };
 
 }
-}
\ No newline at end of file
+}
@@ -13,6 +13,7 @@
 #pragma once
 
 #include "config.h"
+#include "Profiler.h"
 #include "Statistics.h"
 
 namespace carl {
@@ -23,11 +24,15 @@ namespace statistics {
     #define CARL_CALL_STATISTICS(function) function
     #define CARL_TIME_START() carl::statistics::timer::start()
     #define CARL_TIME_FINISH(timer, start) timer.finish(start)
+    #define __CARL_PROFILE_SCOPE_NAME(id) __carl_profile_scope_ ## id
+    #define __CARL_PROFILE_SCOPE(name, id) carl::statistics::profile_scope __CARL_PROFILE_SCOPE_NAME(id)(name)
+    #define CARL_PROFILE_SCOPE(name) __CARL_PROFILE_SCOPE(name, __COUNTER__)
 #else
     #define CARL_INIT_STATISTICS(class, member, name)
     #define CARL_CALL_STATISTICS(function)
     #define CARL_TIME_START() carl::statistics::timing::time_point()
     #define CARL_TIME_FINISH(timer, start) static_cast<carl::statistics::timing::time_point>(start)
+    #define CARL_PROFILE_SCOPE(name)
 #endif
 
 
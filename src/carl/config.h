@@ -0,0 +1,20 @@
+/**
+ * Auto generated file config.h from config.h.in.
+ */ 
+#pragma once
+
+#define CARL_BUILD_RELEASE
+/* #undef LOGGING */
+/* #undef LOGGING_DISABLE_INEFFICIENT */
+/* #undef THREAD_SAFE */
+/* #undef USE_BLISS */
+/* #undef USE_CLN_NUMBERS */
+/* #undef USE_COCOA */
+/* #undef USE_GINAC */
+/* #undef USE_LIBPOLY */
+
+#define RAN_USE_INTERVAL
+/* #undef RAN_USE_DYADIC */
+/* #undef RAN_USE_THOM */
+/* #undef RAN_USE_Z3 */
+/* #undef RAN_USE_LIBPOLY */
@@ -7,15 +7,19 @@
 namespace carl {
 namespace cocoa {
  
+/**
+ * Running times of the calls to CoCoA in nanoseconds.
+ * They are metrics, hence they can be updated by concurrent calls and are exported without collecting them.
+ */
 class CoCoAAdaptorStatistics : public statistics::Statistics {
 public:
-    statistics::timer gcd;
-    statistics::timer factorize;
-    statistics::timer gbasis;
-    void collect() {
-        Statistics::addKeyValuePair("gcd", gcd);
-        Statistics::addKeyValuePair("factorize", factorize);
-        Statistics::addKeyValuePair("gbasis", gbasis);
+    statistics::concurrent_histogram gcd;
+    statistics::concurrent_histogram factorize;
+    statistics::concurrent_histogram gbasis;
+    CoCoAAdaptorStatistics() {
+        addMetric("gcd_ns", gcd);
+        addMetric("factorize_ns", factorize);
+        addMetric("gbasis_ns", gbasis);
     }
 };
 
@@ -12,7 +12,6 @@ namespace carl
 {
 	Monomial::~Monomial() {
 		CARL_LOG_TRACE("carl.core.monomial", "Freeing " << *this);
-		MonomialPool::getInstance().free(this);
 	}
 	Monomial::Arg Monomial::dropVariable(Variable v) const
 	{
@@ -148,7 +147,7 @@ namespace carl
 		return createMonomial(std::move(newExps), mTotalDegree / 2);
 	}
 	
-	Monomial::Arg Monomial::lcm(const std::shared_ptr<const Monomial>& lhs, const std::shared_ptr<const Monomial>& rhs)
+	Monomial::Arg Monomial::lcm(const Monomial::Arg& lhs, const Monomial::Arg& rhs)
 	{
 		if (!lhs && !rhs) return nullptr;
 		if (!lhs) return rhs;
@@ -170,7 +169,7 @@ namespace carl
 			{
 				// Insert remaining part
 				newExps.insert(newExps.end(), itleft, lhs->mExponents.end());
-				std::shared_ptr<const Monomial> result = MonomialPool::getInstance().create( std::move(newExps), expsum );
+				Monomial::Arg result = MonomialPool::getInstance().create( std::move(newExps), expsum );
 				CARL_LOG_TRACE("carl.core.monomial", "Result: " << result);
 				return result;
 			}
@@ -199,7 +198,7 @@ namespace carl
 		}
 		 // Insert remaining part
 		newExps.insert(newExps.end(), itright, rhs->mExponents.end());
-		std::shared_ptr<const Monomial> result = MonomialPool::getInstance().create( std::move(newExps), expsum );
+		Monomial::Arg result = MonomialPool::getInstance().create( std::move(newExps), expsum );
 		CARL_LOG_TRACE("carl.core.monomial", "Result: " << result);
 		return result;
 	}
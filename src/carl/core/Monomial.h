@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include "../config.h"
 #include "../util/hash.h"
 #include "../numbers/numbers.h"
 #include "CompareResult.h"
@@ -15,12 +16,14 @@
 #include "VariablePool.h"
 
 #include <algorithm>
+#include <atomic>
 #include <list>
 #include <numeric>
 #include <set>
 #include <sstream>
 
 #include <boost/intrusive/unordered_set.hpp>
+#include <boost/smart_ptr/intrusive_ptr.hpp>
 
 
 namespace carl
@@ -58,8 +61,15 @@ namespace carl
 	class Monomial final : public boost::intrusive::unordered_set_base_hook<>
 	{
 		friend class MonomialPool;
+		friend void intrusive_ptr_add_ref(const Monomial* m);
+		friend void intrusive_ptr_release(const Monomial* m);
 	public:
-		using Arg = std::shared_ptr<const Monomial>;
+		/**
+		 * Reference to a pooled monomial.
+		 * The reference count is stored within the monomial and only atomic if THREAD_SAFE is set.
+		 * Monomials that are no longer referenced are not freed immediately but collected by the MonomialPool later on.
+		 */
+		using Arg = boost::intrusive_ptr<const Monomial>;
 		using Content = std::vector<std::pair<Variable, std::size_t>>;
 		~Monomial();
 
@@ -79,11 +89,19 @@ namespace carl
 		/// Cached hash.
 		mutable std::size_t mHash = 0;
 
+		#ifdef THREAD_SAFE
+		using RefCount = std::atomic<std::size_t>;
+		#else
+		using RefCount = std::size_t;
+		#endif
+		/// Number of references to this monomial.
+		mutable RefCount mRefCount = 0;
+		/// Number of monomials whose reference count dropped to zero since the last collection of the pool. This is only an estimate.
+		static inline RefCount mUnreferenced = 0;
+
 		using exponents_it = Content::iterator ;
 		using exponents_cIt = Content::const_iterator;
 
-		mutable std::weak_ptr<const Monomial> mWeakPtr;
-
 		/**
 		 * Calculates the hash and stores it to mHash.
 		 */
@@ -490,6 +508,14 @@ namespace carl
          */
 	};
 	
+	inline void intrusive_ptr_add_ref(const Monomial* m) {
+		++m->mRefCount;
+	}
+	inline void intrusive_ptr_release(const Monomial* m) {
+		// The monomial is not freed here, but by MonomialPool::collectGarbage().
+		if (--m->mRefCount == 0) ++Monomial::mUnreferenced;
+	}
+
 	/// @name Comparison operators
 	/// @{
 
@@ -638,7 +664,7 @@ namespace carl
 		return os;
 	}
 	/**
-	 * Streaming operator for std::shared_ptr<Monomial>.
+	 * Streaming operator for Monomial::Arg.
 	 * @param os Output stream.
 	 * @param rhs Monomial.
 	 * @return `os`
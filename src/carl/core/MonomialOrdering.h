@@ -13,6 +13,9 @@ namespace carl
 
 using MonomialOrderingFunction = CompareResult(*)(const Monomial::Arg&, const Monomial::Arg&);
 
+template<typename Coefficient>
+class PackedTerm;
+
 /**
  * A class for term orderings.
  * @ingroup multirp
@@ -29,11 +32,21 @@ struct MonomialComparator
         return compare(t1.monomial(), t2.monomial());
     }
     
+    template<typename Coeff>
+    static CompareResult compare(const PackedTerm<Coeff>& t1, const PackedTerm<Coeff>& t2) {
+        return PackedTerm<Coeff>::template compare<f, degreeOrdered>(t1, t2);
+    }
+    
     template<typename Coeff>
     static bool less(const Term<Coeff>& t1, const Term<Coeff>& t2) {
         return (compare(t1, t2) == CompareResult::LESS );
     }
 	
+	template<typename Coeff>
+    static bool less(const PackedTerm<Coeff>& t1, const PackedTerm<Coeff>& t2) {
+        return (compare(t1, t2) == CompareResult::LESS );
+    }
+	
 	static bool less(const Monomial::Arg& m1, const Monomial::Arg& m2) {
         return (compare(m1, m2) == CompareResult::LESS );
     }
@@ -54,6 +67,10 @@ struct MonomialComparator
 	bool operator()(const Term<Coeff>& t1, const Term<Coeff>& t2) const {
 		return less(t1, t2);
 	}
+	template<typename Coeff>
+	bool operator()(const PackedTerm<Coeff>& t1, const PackedTerm<Coeff>& t2) const {
+		return less(t1, t2);
+	}
 
     static const bool degreeOrder = degreeOrdered;
 };
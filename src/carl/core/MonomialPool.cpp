@@ -17,17 +17,65 @@ Monomial::Arg MonomialPool::add(Monomial::Content&& c, exponent totalDegree) {
 	underlying_set::insert_commit_data insert_data;
 	auto res = mPool.insert_check(c, content_hash(), content_equal(), insert_data);
 	if (!res.second) {
-		return res.first->mWeakPtr.lock();
+		// Revive a monomial that is unreferenced but was not collected yet.
+		if (res.first->mRefCount == 0 && Monomial::mUnreferenced > 0) --Monomial::mUnreferenced;
+		mCounters.hits.inc();
+		return Monomial::Arg(&*res.first);
 	} else {
-		auto shared = std::shared_ptr<Monomial>(new Monomial(c, totalDegree));
-		shared.get()->mId = mIDs.get();
-		shared.get()->mWeakPtr = shared;
-		mPool.insert_commit(*shared.get(), insert_data);
+		mCounters.misses.inc();
+		auto* monomial = new Monomial(std::move(c), totalDegree);
+		monomial->mId = mIDs.get();
+		mPool.insert_commit(*monomial, insert_data);
+		Monomial::Arg result(monomial);
+		check_collect();
 		check_rehash();
-		return shared;
+		return result;
 	}
 }
 
+void MonomialPool::collectGarbage() {
+	MONOMIAL_POOL_LOCK_GUARD
+	CARL_LOG_DEBUG("carl.pool", "Collecting unreferenced monomials, pool has size " << mPool.size());
+	Monomial::mUnreferenced = 0;
+	for (auto it = mPool.begin(); it != mPool.end();) {
+		auto cur = it++;
+		if (cur->mRefCount == 0) {
+			mPool.erase_and_dispose(cur, [this](Monomial* m) {
+				mIDs.free(m->id());
+				delete m;
+			});
+		}
+	}
+	CARL_LOG_DEBUG("carl.pool", "Pool has size " << mPool.size() << " after collection");
+}
+
+std::size_t MonomialPool::size() const {
+	MONOMIAL_POOL_LOCK_GUARD
+	return static_cast<std::size_t>(std::count_if(mPool.begin(), mPool.end(), [](const Monomial& m){ return m.mRefCount > 0; }));
+}
+
+std::size_t MonomialPool::memory_usage() const {
+	MONOMIAL_POOL_LOCK_GUARD
+	std::size_t res = sizeof(MonomialPool) + mPool.bucket_count() * sizeof(underlying_set::bucket_type);
+	for (std::size_t i = 0; i < pinChunks; ++i) {
+		if (mPinned[i].load() != nullptr) res += (pinChunkBase << i) * sizeof(PinSlot);
+	}
+	for (const auto& m: mPool) {
+		res += sizeof(Monomial) + m.mExponents.capacity() * sizeof(Monomial::Content::value_type);
+	}
+	return res;
+}
+
+Monomial::Arg MonomialPool::largest() const {
+	MONOMIAL_POOL_LOCK_GUARD
+	const Monomial* res = nullptr;
+	for (const auto& m: mPool) {
+		if (m.mRefCount == 0) continue;
+		if (res == nullptr || m.tdeg() > res->tdeg()) res = &m;
+	}
+	return Monomial::Arg(res);
+}
+
 Monomial::Arg MonomialPool::create(Variable _var, exponent _exp) {
 	CARL_LOG_TRACE("carl.core.monomial", _var << ", " << _exp);
 	return add(Monomial::Content(1, std::make_pair(_var, _exp)), _exp);
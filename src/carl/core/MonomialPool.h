@@ -13,7 +13,11 @@
 #include "config.h"
 
 #include <boost/intrusive/unordered_set.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <memory>
+#include <vector>
 
 namespace carl {
 
@@ -47,10 +51,55 @@ private:
 	IDPool mIDs;
 	//size_t mIdAllocator;
 	pool::RehashPolicy mRehashPolicy;
+	/// Usage counters.
+	pool::Counters mCounters;
 	using underlying_set = boost::intrusive::unordered_set<Monomial>;
 	std::unique_ptr<underlying_set::bucket_type[]> mPoolBuckets;
 	/// The pool.
 	underlying_set mPool;
+	/// Pinned monomial together with the number of its pins.
+	struct PinSlot {
+		Monomial::Arg monomial;
+		std::atomic<std::size_t> pins{0};
+	};
+	/// Size of the first chunk of the pin table.
+	static constexpr std::size_t pinChunkBase = 256;
+	/// Number of chunks of the pin table, enough for all 32 bit ids.
+	static constexpr std::size_t pinChunks = 32;
+	/**
+	 * Monomials that are referenced by their id, indexed by id. See pin().
+	 * Chunk k holds pinChunkBase * 2^k slots and is never moved once allocated, hence slots can be read without the lock.
+	 */
+	std::array<std::atomic<PinSlot*>, pinChunks> mPinned = {};
+
+	/// Returns the chunk and the offset within the chunk of the given id.
+	static std::pair<std::size_t,std::size_t> pinPosition(std::size_t id) {
+		std::size_t q = id / pinChunkBase + 1;
+		auto chunk = static_cast<std::size_t>(63 - __builtin_clzll(static_cast<unsigned long long>(q)));
+		return std::make_pair(chunk, id - pinChunkBase * ((std::size_t(1) << chunk) - 1));
+	}
+	/// Returns the slot of the given id, allocating its chunk if necessary. Must be called with the lock held.
+	PinSlot& pinSlot(std::size_t id) {
+		auto pos = pinPosition(id);
+		assert(pos.first < pinChunks);
+		PinSlot* chunk = mPinned[pos.first].load(std::memory_order_relaxed);
+		if (chunk == nullptr) {
+			chunk = new PinSlot[pinChunkBase << pos.first];
+			mPinned[pos.first].store(chunk, std::memory_order_release);
+		}
+		return chunk[pos.second];
+	}
+	/// Returns the slot of a pinned id without taking the lock.
+	const PinSlot& pinnedSlot(std::size_t id) const {
+		auto pos = pinPosition(id);
+		assert(pos.first < pinChunks);
+		const PinSlot* chunk = mPinned[pos.first].load(std::memory_order_acquire);
+		assert(chunk != nullptr);
+		return chunk[pos.second];
+	}
+	PinSlot& pinnedSlot(std::size_t id) {
+		return const_cast<PinSlot&>(static_cast<const MonomialPool*>(this)->pinnedSlot(id));
+	}
 	/// Mutex to avoid multiple access to the pool
 	mutable std::recursive_mutex mMutex;
 
@@ -79,18 +128,36 @@ protected:
 	}
 
 	~MonomialPool() {
+		// Release pinned monomials while the pool is still intact.
+		for (auto& chunk: mPinned) {
+			delete[] chunk.load();
+			chunk = nullptr;
+		}
+		// Monomials that are still referenced are left alone, they may be released after the pool has been destroyed.
+		collectGarbage();
 		// for (const auto& m : mPool) m.mId = 0; // hacky fix for singletons not being destroyed in proper order
 		// CARL_LOG_DEBUG("carl.pool", "Monomialpool destructed");
 	}
 
 	Monomial::Arg add(Monomial::Content&& c, exponent totalDegree = 0);
 
+	/// Minimal number of unreferenced monomials before they are collected.
+	static constexpr std::size_t collectionThreshold = 1024;
+
+	void check_collect() {
+		std::size_t unreferenced = Monomial::mUnreferenced;
+		if (unreferenced > collectionThreshold && unreferenced > mPool.size() / 2) {
+			collectGarbage();
+		}
+	}
+
 	void check_rehash() {
 		auto rehash = mRehashPolicy.needRehash(mPool.bucket_count(), mPool.size());
 		if (rehash.first) {
 			auto new_buckets = new underlying_set::bucket_type[rehash.second];
 			mPool.rehash(underlying_set::bucket_traits(new_buckets, rehash.second));
 			mPoolBuckets.reset(new_buckets);
+			mCounters.rehashes.inc();
 		}
 	}
 
@@ -134,31 +201,116 @@ public:
 	 */
 	Monomial::Arg create(std::vector<std::pair<Variable, exponent>>&& _exponents);
 
-	void free(const Monomial* m) {
-		if (m == nullptr) return;
-		if (m->id() == 0) return;
-		CARL_LOG_TRACE("carl.core.monomial", "Freeing " << m);
+	/**
+	 * Frees all monomials that are no longer referenced.
+	 * This is called automatically when new monomials are added and many monomials have become unreferenced,
+	 * such that releasing a monomial never needs to take the lock of the pool.
+	 */
+	void collectGarbage();
+
+	/**
+	 * Keeps the given monomial alive until it is unpinned, such that it can be referenced by its id only.
+	 * Every call to pin() or retain() must be matched by a call to unpin().
+	 * Pinned monomials can be retrieved in constant time using pinned().
+	 * @param m Monomial, may be nullptr for the constant monomial.
+	 * @return The id of the monomial, zero for the constant monomial.
+	 */
+	std::size_t pin(const Monomial::Arg& m) {
+		if (!m) return 0;
 		MONOMIAL_POOL_LOCK_GUARD;
-		auto it = mPool.find(*m);
-		if (it != mPool.end()) {
-			CARL_LOG_TRACE("carl.core.monomial", "Found " << m->id());
-			mIDs.free(m->id());
-			mPool.erase(it);
-		} else {
-			CARL_LOG_TRACE("carl.core.monomial", "Not found in pool.");
+		std::size_t id = m->id();
+		assert(id != 0);
+		PinSlot& slot = pinSlot(id);
+		if (!slot.monomial) slot.monomial = m;
+		assert(slot.monomial == m);
+		slot.pins.fetch_add(1, std::memory_order_relaxed);
+		return id;
+	}
+
+	/**
+	 * Adds another pin to a monomial that is already pinned.
+	 * This does not take the lock of the pool.
+	 * @param id Id obtained from pin().
+	 */
+	void retain(std::size_t id) {
+		if (id == 0) return;
+		assert(pinnedSlot(id).pins > 0);
+		pinnedSlot(id).pins.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	/**
+	 * Removes a pin from a monomial.
+	 * Only the removal of the last pin takes the lock of the pool and releases the monomial.
+	 * @param id Id obtained from pin().
+	 */
+	void unpin(std::size_t id) {
+		if (id == 0) return;
+		PinSlot& slot = pinnedSlot(id);
+		assert(slot.pins > 0);
+		if (slot.pins.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+			MONOMIAL_POOL_LOCK_GUARD;
+			// The monomial may have been pinned again in the meantime.
+			if (slot.pins.load(std::memory_order_acquire) == 0) {
+				slot.monomial = nullptr;
+			}
 		}
 	}
 
-	std::size_t size() const {
+	/**
+	 * Returns the pinned monomial with the given id.
+	 * This does not take the lock of the pool: the slot of a pinned monomial is neither moved nor modified while the caller holds a pin.
+	 * @param id Id obtained from pin().
+	 * @return The monomial, nullptr for id zero.
+	 */
+	const Monomial::Arg& pinned(std::size_t id) const {
+		static const Monomial::Arg constant;
+		if (id == 0) return constant;
+		assert(pinnedSlot(id).pins > 0);
+		return pinnedSlot(id).monomial;
+	}
+
+	/**
+	 * Returns the number of live monomials, that is monomials that are still referenced.
+	 * Unreferenced monomials that were not collected yet are not counted.
+	 * This iterates over the whole pool and is meant for statistics only.
+	 */
+	std::size_t size() const;
+	/// Returns the number of monomials in the pool, including unreferenced monomials that were not collected yet.
+	std::size_t entries() const {
+		MONOMIAL_POOL_LOCK_GUARD;
 		return mPool.size();
 	}
 	std::size_t largestID() const {
 		return mIDs.largestID();
 	}
+
+	/// Returns the usage counters of the pool.
+	const pool::Counters& counters() const {
+		return mCounters;
+	}
+	std::size_t bucket_count() const {
+		MONOMIAL_POOL_LOCK_GUARD;
+		return mPool.bucket_count();
+	}
+	double load_factor() const {
+		MONOMIAL_POOL_LOCK_GUARD;
+		if (mPool.bucket_count() == 0) return 0;
+		return static_cast<double>(mPool.size()) / static_cast<double>(mPool.bucket_count());
+	}
+	/**
+	 * Estimates the memory used by the pool and the monomials within the pool.
+	 * @return Number of bytes.
+	 */
+	std::size_t memory_usage() const;
+	/**
+	 * Returns the referenced monomial with the largest total degree.
+	 * @return The largest monomial, nullptr if no monomial is referenced.
+	 */
+	Monomial::Arg largest() const;
 };
 
 inline std::ostream& operator<<(std::ostream& os, const MonomialPool& mp) {
-	os << "MonomialPool of size " << mp.size() << std::endl;
+	os << "MonomialPool of size " << mp.entries() << std::endl;
 	for (const auto& entry : mp.mPool) {
 		os << "\t" << entry << std::endl;
 	}
@@ -63,8 +63,8 @@ public:
     using PolyType = MultivariatePolynomial<Coeff, Ordering, Policies>;
     /// The type of the cache. Multivariate polynomials do not need a cache, we set it to something.
     using CACHE = std::vector<int>;
-	/// Type our terms vector.f
-	using TermsType = std::vector<Term<Coeff>>;
+	/// Type our terms vector, using the allocator given by the policies.
+	using TermsType = std::vector<Term<Coeff>, typename Policies::template term_allocator<Term<Coeff>>>;
 	
 	template<typename C, typename T>
 	using EnableIfNotSame = typename std::enable_if<!std::is_same<C,T>::value,T>::type;
@@ -106,7 +106,7 @@ public:
 	explicit MultivariatePolynomial(const Coeff& c);
 	explicit MultivariatePolynomial(Variable::Arg v);
 	explicit MultivariatePolynomial(const Term<Coeff>& t);
-	explicit MultivariatePolynomial(const std::shared_ptr<const Monomial>& m);
+	explicit MultivariatePolynomial(const Monomial::Arg& m);
 	explicit MultivariatePolynomial(const UnivariatePolynomial<MultivariatePolynomial<Coeff, Ordering,Policy>> &pol);
 	explicit MultivariatePolynomial(const UnivariatePolynomial<Coeff>& p);
 	template<class OtherPolicies, DisableIf<std::is_same<Policies,OtherPolicies>> = dummy>
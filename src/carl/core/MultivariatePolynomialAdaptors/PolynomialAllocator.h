@@ -7,10 +7,28 @@
 
 #pragma once
 
+#include "../../util/ArenaAllocator.h"
+
+#include <memory>
+
 namespace carl
 {
+/**
+ * Allocator policy that uses the standard allocator for the terms of a polynomial.
+ */
 struct NoAllocator
 {
-	
+	template<typename T>
+	using allocator = std::allocator<T>;
+};
+
+/**
+ * Allocator policy that takes the terms of a polynomial from the active ScopedArena or a thread-local slab pool.
+ * Intended for polynomials that are temporaries of a larger computation.
+ */
+struct ArenaPolynomialAllocator
+{
+	template<typename T>
+	using allocator = ArenaAllocator<T>;
 };
-}
\ No newline at end of file
+}
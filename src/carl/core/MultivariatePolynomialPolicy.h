@@ -29,6 +29,10 @@ namespace carl
 		
 		// Easy access.
 		static const bool has_reasons = ReasonsAdaptor::has_reasons;
+
+		/// Allocator used for the term storage.
+		template<typename T>
+		using term_allocator = typename Allocator::template allocator<T>;
     };
 	
 }
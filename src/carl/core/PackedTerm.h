@@ -0,0 +1,234 @@
+/**
+ * @file PackedTerm.h
+ * @ingroup multirp
+ */
+
+#pragma once
+
+#include "CompareResult.h"
+#include "Monomial.h"
+#include "MonomialOrdering.h"
+#include "MonomialPool.h"
+#include "Term.h"
+#include "../util/hash.h"
+
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace carl {
+
+/**
+ * Keeps the monomials of a collection of packed terms pinned in the MonomialPool (see MonomialPool::pin()).
+ * It is held by whatever owns the packed terms, for example a polynomial or a solver state, and every monomial is pinned once regardless of the number of terms referring to it.
+ * The monomials are released when this object is cleared or destroyed, hence packed terms must not outlive the MonomialPins they were created with.
+ */
+class MonomialPins {
+	/// Ids of the pinned monomials.
+	std::vector<std::uint32_t> mIds;
+	/// Ids of the pinned monomials for fast lookup.
+	std::unordered_set<std::uint32_t> mLookup;
+public:
+	MonomialPins() = default;
+	MonomialPins(const MonomialPins& pins): mIds(pins.mIds), mLookup(pins.mLookup) {
+		for (auto id: mIds) MonomialPool::getInstance().retain(id);
+	}
+	MonomialPins(MonomialPins&& pins) noexcept: mIds(std::move(pins.mIds)), mLookup(std::move(pins.mLookup)) {
+		pins.mIds.clear();
+		pins.mLookup.clear();
+	}
+	MonomialPins& operator=(MonomialPins pins) noexcept {
+		std::swap(mIds, pins.mIds);
+		std::swap(mLookup, pins.mLookup);
+		return *this;
+	}
+	~MonomialPins() {
+		clear();
+	}
+	/**
+	 * Pins the given monomial unless it is already pinned by this object.
+	 * @param m Monomial, may be nullptr for the constant monomial.
+	 * @return The id of the monomial, zero for the constant monomial.
+	 */
+	std::uint32_t pin(const Monomial::Arg& m) {
+		if (!m) return 0;
+		assert(m->id() <= std::numeric_limits<std::uint32_t>::max());
+		auto id = static_cast<std::uint32_t>(m->id());
+		if (mLookup.insert(id).second) {
+			MonomialPool::getInstance().pin(m);
+			mIds.push_back(id);
+		}
+		return id;
+	}
+	/// Releases all monomials, packed terms created with this object become invalid.
+	void clear() {
+		for (auto id: mIds) MonomialPool::getInstance().unpin(id);
+		mIds.clear();
+		mLookup.clear();
+	}
+	/// Number of pinned monomials.
+	std::size_t size() const {
+		return mIds.size();
+	}
+};
+
+/**
+ * Represents a single term like Term, but refers to the monomial by its id instead of a shared pointer.
+ *
+ * A packed term is a plain value: copying, assigning or destroying it never touches the MonomialPool or any reference count,
+ * and it is trivially copyable if the coefficient is, for example when using an inline number type like HybridRational.
+ * The monomial is kept alive by the MonomialPins given on construction, which belong to the owner of the packed terms,
+ * and can be retrieved from the pool-side table in constant time without locking.
+ * The total degree and the hash of the monomial are cached inline, hence comparisons of monomials with different degrees or ids never touch the monomial itself.
+ *
+ * Ids and total degrees are stored with 32 bits; constructing a packed term for a monomial exceeding this range is an error.
+ *
+ * PackedTerm is a standalone representation: MultivariatePolynomial still stores Term objects, packed terms are converted explicitly using PackedTerm(const Term&, MonomialPins&) and toTerm().
+ * @ingroup multirp
+ */
+template<typename Coefficient>
+class PackedTerm {
+private:
+	Coefficient mCoeff = constant_zero<Coefficient>::get();
+	/// Id of the monomial, zero for constant terms.
+	std::uint32_t mMonomial = 0;
+	/// Total degree of the monomial.
+	std::uint32_t mDegree = 0;
+	/// Hash of the monomial.
+	std::size_t mHash = 0;
+
+	void setMonomial(const Monomial::Arg& m, MonomialPins& pins) {
+		if (!m) return;
+		assert(m->tdeg() <= std::numeric_limits<std::uint32_t>::max());
+		mMonomial = pins.pin(m);
+		mDegree = static_cast<std::uint32_t>(m->tdeg());
+		mHash = m->hash();
+	}
+public:
+	/**
+	 * Default constructor. Constructs a term of value zero.
+	 */
+	PackedTerm() = default;
+	/**
+	 * Constructs a term of value \f$ c \f$.
+	 * @param c Coefficient.
+	 */
+	explicit PackedTerm(const Coefficient& c): mCoeff(c) {}
+	/**
+	 * Constructs a term of value \f$ c \cdot m \f$.
+	 * @param c Coefficient.
+	 * @param m Monomial pointer.
+	 * @param pins Keeps the monomial alive as long as the packed term is used.
+	 */
+	PackedTerm(const Coefficient& c, const Monomial::Arg& m, MonomialPins& pins): mCoeff(c) {
+		setMonomial(m, pins);
+	}
+	/**
+	 * Constructs a packed term from a term.
+	 * @param t Term.
+	 * @param pins Keeps the monomial alive as long as the packed term is used.
+	 */
+	PackedTerm(const Term<Coefficient>& t, MonomialPins& pins): PackedTerm(t.coeff(), t.monomial(), pins) {}
+
+	/**
+	 * Converts back to a term.
+	 * @return Term.
+	 */
+	Term<Coefficient> toTerm() const {
+		return Term<Coefficient>(mCoeff, monomial());
+	}
+
+	Coefficient& coeff() {
+		return mCoeff;
+	}
+	const Coefficient& coeff() const {
+		return mCoeff;
+	}
+	/**
+	 * Get the monomial from the pool-side table.
+	 * @return Monomial, nullptr for constant terms.
+	 */
+	const Monomial::Arg& monomial() const {
+		return MonomialPool::getInstance().pinned(mMonomial);
+	}
+	/// Id of the monomial, zero for constant terms.
+	std::uint32_t monomialId() const {
+		return mMonomial;
+	}
+	/// Cached total degree.
+	std::uint32_t tdeg() const {
+		return mDegree;
+	}
+	/// Cached hash of the monomial.
+	std::size_t monomialHash() const {
+		return mHash;
+	}
+	bool isConstant() const {
+		return mMonomial == 0;
+	}
+
+	/**
+	 * Checks whether the monomials of two terms are equal.
+	 * As monomials are pooled, this only compares the ids.
+	 */
+	static bool monomialEqual(const PackedTerm& lhs, const PackedTerm& rhs) {
+		return lhs.mMonomial == rhs.mMonomial;
+	}
+
+	/**
+	 * Compares the monomials of two terms with respect to the given monomial ordering.
+	 * Equal ids and, for degree orderings, different total degrees are resolved inline.
+	 */
+	template<MonomialOrderingFunction f, bool degreeOrdered>
+	static CompareResult compare(const PackedTerm& lhs, const PackedTerm& rhs) {
+		if (lhs.mMonomial == rhs.mMonomial) return CompareResult::EQUAL;
+		if (degreeOrdered) {
+			if (lhs.mDegree < rhs.mDegree) return CompareResult::LESS;
+			if (lhs.mDegree > rhs.mDegree) return CompareResult::GREATER;
+		}
+		return f(lhs.monomial(), rhs.monomial());
+	}
+};
+
+template<typename Coeff>
+inline bool isZero(const PackedTerm<Coeff>& term) {
+	return carl::isZero(term.coeff());
+}
+
+template<typename Coeff>
+inline bool operator==(const PackedTerm<Coeff>& lhs, const PackedTerm<Coeff>& rhs) {
+	return lhs.monomialId() == rhs.monomialId() && lhs.coeff() == rhs.coeff();
+}
+template<typename Coeff>
+inline bool operator!=(const PackedTerm<Coeff>& lhs, const PackedTerm<Coeff>& rhs) {
+	return !(lhs == rhs);
+}
+
+template<typename Coeff>
+std::ostream& operator<<(std::ostream& os, const PackedTerm<Coeff>& rhs) {
+	return os << rhs.toTerm();
+}
+
+} // namespace carl
+
+namespace std {
+
+/**
+ * Specialization of `std::hash` for a PackedTerm.
+ * Consistent with the hash of the corresponding Term.
+ */
+template<typename Coefficient>
+struct hash<carl::PackedTerm<Coefficient>> {
+	std::size_t operator()(const carl::PackedTerm<Coefficient>& term) const {
+		if (term.isConstant()) {
+			return carl::hash_all(term.coeff());
+		} else {
+			return carl::hash_all(term.coeff(), term.monomialHash());
+		}
+	}
+};
+} // namespace std
@@ -42,6 +42,11 @@ bool try_divide(const Term<Coeff>& t, Variable v, Term<Coeff>& res) {
 	return false;
 }
 
+template<typename Coeff>
+bool try_divide(const Term<Coeff>& t, const Term<Coeff>& divisor, Term<Coeff>& res) {
+	return t.divide(divisor, res);
+}
+
 /**
  * Divides the polynomial by the given coefficient.
  * Applies if the coefficients are from a field.
@@ -51,7 +56,7 @@ bool try_divide(const Term<Coeff>& t, Variable v, Term<Coeff>& res) {
 template<typename Coeff, typename Ordering, typename Policies>
 MultivariatePolynomial<Coeff,Ordering,Policies> divide(const MultivariatePolynomial<Coeff,Ordering,Policies>& p, const Coeff& divisor) {
 	static_assert(is_field<Coeff>::value);
-	std::vector<Term<Coeff>> new_coeffs;
+	typename MultivariatePolynomial<Coeff,Ordering,Policies>::TermsType new_coeffs;
 	for (const auto& t: p) {
 		new_coeffs.emplace_back(divide(t, divisor));
 	}
@@ -4,6 +4,7 @@
 
 #include "../MultivariatePolynomial.h"
 #include "../UnivariatePolynomial.h"
+#include "../../util/Instrumentation.h"
 
 namespace carl {
 
@@ -35,6 +36,7 @@ Coefficient evaluate(const Term<Coefficient>& t, const std::map<Variable, Coeffi
  */
 template<typename C, typename O, typename P, typename SubstitutionType>
 SubstitutionType evaluate(const MultivariatePolynomial<C,O,P>& p, const std::map<Variable, SubstitutionType>& substitutions) {
+	CARL_INSTRUMENT("evaluate", p);
 	if(carl::is_zero(p)) {
 		return constant_zero<SubstitutionType>::get();
 	} else {
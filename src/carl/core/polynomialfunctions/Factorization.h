@@ -6,6 +6,7 @@
 #include "../../converter/CoCoAAdaptor.h"
 #include "../../converter/OldGinacConverter.h"
 #include "../../util/Common.h"
+#include "../../util/Instrumentation.h"
 
 namespace carl {
 
@@ -53,6 +54,7 @@ namespace helper {
  */
 template<typename C, typename O, typename P>
 Factors<MultivariatePolynomial<C,O,P>> factorization(const MultivariatePolynomial<C,O,P>& p, bool includeConstants = true) {
+	CARL_INSTRUMENT("factorization", p);
 	if (p.totalDegree() == 0) {
 		if (includeConstants) {
 			return helper::trivialFactorization(p);
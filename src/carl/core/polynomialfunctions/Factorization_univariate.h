@@ -6,6 +6,7 @@
 
 #include "../logging.h"
 #include "../UnivariatePolynomial.h"
+#include "../../util/Instrumentation.h"
 
 namespace carl {
 
@@ -323,6 +324,7 @@ LinearFactorRemains:
 
 template<typename Coeff>
 FactorMap<Coeff> factorization(const UnivariatePolynomial<Coeff>& p) {
+	CARL_INSTRUMENT("factorization", p);
     CARL_LOG_TRACE("carl.core.upoly", "UnivFactor: " << p);
 	FactorMap<Coeff> result;
 	if(is_constant(p)) // Constant.
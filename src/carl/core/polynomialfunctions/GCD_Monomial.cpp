@@ -41,7 +41,7 @@ Monomial::Arg gcd(const Monomial::Arg& lhs, const Monomial::Arg& rhs) {
 		}
 	}
 		// Insert remaining part
-	std::shared_ptr<const Monomial> result;
+	Monomial::Arg result;
 	if (!newExps.empty()) {
 		result = createMonomial(std::move(newExps), expsum);
 	}
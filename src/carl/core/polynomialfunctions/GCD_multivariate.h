@@ -7,6 +7,7 @@
 
 #include "../../converter/CoCoAAdaptor.h"
 #include "../../converter/OldGinacConverter.h"
+#include "../../util/Instrumentation.h"
 
 namespace carl {
 
@@ -40,10 +41,27 @@ namespace gcd_detail {
 		}
 		return result;
 	}
+
+	/**
+	 * Computes the gcd by converting the coefficients to Target, for example to use a backend that only supports Target.
+	 */
+	template<typename Target, typename C, typename O, typename P>
+	MultivariatePolynomial<C,O,P> gcd_converted(const MultivariatePolynomial<C,O,P>& a, const MultivariatePolynomial<C,O,P>& b) {
+		auto to = [](const MultivariatePolynomial<C,O,P>& p) {
+			typename MultivariatePolynomial<Target,O,P>::TermsType terms;
+			for (const auto& t: p) terms.emplace_back(carl::convert<C,Target>(t.coeff()), t.monomial());
+			return MultivariatePolynomial<Target,O,P>(std::move(terms), false, p.isOrdered());
+		};
+		auto res = carl::gcd(to(a), to(b));
+		typename MultivariatePolynomial<C,O,P>::TermsType terms;
+		for (const auto& t: res) terms.emplace_back(carl::convert<Target,C>(t.coeff()), t.monomial());
+		return MultivariatePolynomial<C,O,P>(std::move(terms), false, res.isOrdered());
+	}
 }
 
 template<typename C, typename O, typename P>
 MultivariatePolynomial<C,O,P> gcd(const MultivariatePolynomial<C,O,P>& a, const MultivariatePolynomial<C,O,P>& b) {
+	CARL_INSTRUMENT("gcd", a, b);
 	CARL_LOG_DEBUG("carl.core.gcd", "gcd(" << a << ", " << b << ")");
 	assert(!isZero(a));
 	assert(!isZero(b));
@@ -60,6 +78,7 @@ MultivariatePolynomial<C,O,P> gcd(const MultivariatePolynomial<C,O,P>& a, const
 	}
 
 	auto s = overloaded {
+		[](const MultivariatePolynomial<HybridRational,O,P>& n1, const MultivariatePolynomial<HybridRational,O,P>& n2){ return gcd_detail::gcd_converted<mpq_class>(n1, n2); },
 	#if defined USE_GINAC
 		[](const MultivariatePolynomial<cln::cl_RA,O,P>& n1, const MultivariatePolynomial<cln::cl_RA,O,P>& n2){ return ginacGcd<MultivariatePolynomial<cln::cl_RA,O,P>>( n1, n2 ); },
 		[](const MultivariatePolynomial<cln::cl_I,O,P>& n1, const MultivariatePolynomial<cln::cl_I,O,P>& n2){ return ginacGcd<MultivariatePolynomial<cln::cl_I,O,P>>( n1, n2 ); },
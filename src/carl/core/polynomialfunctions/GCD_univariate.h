@@ -5,6 +5,7 @@
 
 #include "../UnivariatePolynomial.h"
 #include "../Variable.h"
+#include "../../util/Instrumentation.h"
 
 namespace carl {
 
@@ -102,6 +103,7 @@ UnivariatePolynomial<Coeff> extended_gcd(const UnivariatePolynomial<Coeff>& a, c
  */
 template<typename Coeff>
 UnivariatePolynomial<Coeff> gcd(const UnivariatePolynomial<Coeff>& a, const UnivariatePolynomial<Coeff>& b) {
+	CARL_INSTRUMENT("gcd", a, b);
 	// We want degree(b) <= degree(a).
 	assert(!carl::isZero(a));
 	assert(!carl::isZero(b));
@@ -8,6 +8,7 @@
 #include "PrimitivePart.h"
 #include "Remainder.h"
 #include "to_univariate_polynomial.h"
+#include "../../util/Instrumentation.h"
 
 #ifdef USE_LIBPOLY
 	#include "../../converter/LibpolyFunctions.h"
@@ -302,6 +303,7 @@ UnivariatePolynomial<Coeff> resultant(
 	const UnivariatePolynomial<Coeff>& p,
 	const UnivariatePolynomial<Coeff>& q,
 	SubresultantStrategy strategy) {
+	CARL_INSTRUMENT("resultant", p, q);
 	assert(p.mainVar() == q.mainVar());
 	if (carl::isZero(p) || carl::isZero(q)) return UnivariatePolynomial<Coeff>(p.mainVar());
 
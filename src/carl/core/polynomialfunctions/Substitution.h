@@ -5,6 +5,7 @@
 #include "Power.h"
 
 #include "../Monomial.h"
+#include "../../util/Instrumentation.h"
 
 namespace carl {
 
@@ -184,6 +185,7 @@ void substitute_inplace(MultivariatePolynomial<C,O,P>& p, Variable var, const Mu
 
 template<typename C, typename O, typename P>
 MultivariatePolynomial<C,O,P> substitute(const MultivariatePolynomial<C,O,P>& p, Variable var, const MultivariatePolynomial<C,O,P>& value) {
+	CARL_INSTRUMENT("substitute", p, value);
 	MultivariatePolynomial<C,O,P> result(p);
 	substitute_inplace(result, var, value);
 	return result;
@@ -192,6 +194,7 @@ MultivariatePolynomial<C,O,P> substitute(const MultivariatePolynomial<C,O,P>& p,
 template<typename C, typename O, typename P, typename S>
 MultivariatePolynomial<C,O,P> substitute(const MultivariatePolynomial<C,O,P>& p, const std::map<Variable,S>& substitutions) {
 	static_assert(!std::is_same<S, Term<C>>::value, "Terms are handled by a separate method.");
+	CARL_INSTRUMENT("substitute", p);
 	MultivariatePolynomial<C,O,P> result;
 	auto& tam = MultivariatePolynomial<C,O,P>::mTermAdditionManager;
 	auto id = tam.getId(p.nrTerms());
@@ -226,6 +229,7 @@ MultivariatePolynomial<C,O,P> substitute(const MultivariatePolynomial<C,O,P>& p,
 
 template<typename C, typename O, typename P>
 MultivariatePolynomial<C,O,P> substitute(const MultivariatePolynomial<C,O,P>& p, const std::map<Variable, MultivariatePolynomial<C,O,P>>& substitutions) {
+	CARL_INSTRUMENT("substitute", p);
 	MultivariatePolynomial<C,O,P> result(p);
 	if (is_constant(p) || substitutions.empty())
 	{
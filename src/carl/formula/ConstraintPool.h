@@ -59,6 +59,8 @@ private:
     mutable std::recursive_mutex mMutexPool;
 
     pool::RehashPolicy mRehashPolicy;
+    /// Usage counters.
+    pool::Counters mCounters;
     using underlying_set = boost::intrusive::unordered_set<ConstraintContent<Pol>>;
     std::unique_ptr<typename underlying_set::bucket_type[]> mPoolBuckets;
     /// The constraint pool.
@@ -87,6 +89,7 @@ private:
 			auto new_buckets = new typename underlying_set::bucket_type[rehash.second];
 			mPool.rehash(typename underlying_set::bucket_traits(new_buckets, rehash.second));
 			mPoolBuckets.reset(new_buckets);
+			mCounters.rehashes.inc();
 		}
 	}
 
@@ -175,6 +178,42 @@ public:
         }
     }
 
+    std::size_t size() const {
+        CONSTRAINT_POOL_LOCK_GUARD
+        return mPool.size();
+    }
+
+    /// Returns the usage counters of the pool.
+    const pool::Counters& counters() const {
+        return mCounters;
+    }
+    std::size_t bucket_count() const {
+        CONSTRAINT_POOL_LOCK_GUARD
+        return mPool.bucket_count();
+    }
+    double load_factor() const {
+        CONSTRAINT_POOL_LOCK_GUARD
+        if (mPool.bucket_count() == 0) return 0;
+        return static_cast<double>(mPool.size()) / static_cast<double>(mPool.bucket_count());
+    }
+
+    /**
+     * Estimates the memory used by the pool and the constraints within the pool.
+     * The coefficients and monomials of the left-hand sides are not included.
+     * @return Number of bytes.
+     */
+    std::size_t memory_usage() const;
+
+    /**
+     * Calls the given function for every constraint in the pool.
+     * @param f Function that is called with a const reference to every constraint content.
+     */
+    template<typename F>
+    void for_each(F&& f) const {
+        CONSTRAINT_POOL_LOCK_GUARD
+        for (const auto& c: mPool) f(c);
+    }
+
     /**
      * Prints all constraints in the constraint pool on the given stream.
      *
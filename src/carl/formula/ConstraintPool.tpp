@@ -65,6 +65,7 @@ std::shared_ptr<ConstraintContent<Pol>> ConstraintPool<Pol>::add(RawConstraint<P
 	if (constraintConsistent == 2) { // Constraint contains variables.
 		auto res = mPool.find(_constraint, content_hash(), content_equal());
 		if (res != mPool.end()) {
+			mCounters.hits.inc();
 			return res->mWeakPtr.lock();
 		} else {
 			_constraint.simplify();
@@ -80,8 +81,10 @@ std::shared_ptr<ConstraintContent<Pol>> ConstraintPool<Pol>::addToPool(RawConstr
 	typename underlying_set::insert_commit_data insert_data;
 	auto res = mPool.insert_check(_constraint, content_hash(), content_equal(), insert_data);
 	if (!res.second) {
+		mCounters.hits.inc();
 		return res.first->mWeakPtr.lock();
 	} else {
+		mCounters.misses.inc();
 		auto shared = std::shared_ptr<ConstraintContent<Pol>>(new ConstraintContent<Pol>(mIdAllocator, std::move(_constraint.mLhs), _constraint.mRelation, std::move(_constraint.mVariables), _constraint.mLhsDefiniteness, _constraint.is_consistent()));
 		++mIdAllocator;
 		shared.get()->mWeakPtr = shared;
@@ -91,6 +94,16 @@ std::shared_ptr<ConstraintContent<Pol>> ConstraintPool<Pol>::addToPool(RawConstr
 	}
 }
 
+template<typename Pol>
+std::size_t ConstraintPool<Pol>::memory_usage() const {
+	CONSTRAINT_POOL_LOCK_GUARD
+	std::size_t res = sizeof(ConstraintPool<Pol>) + mPool.bucket_count() * sizeof(typename underlying_set::bucket_type);
+	for (const auto& c: mPool) {
+		res += sizeof(ConstraintContent<Pol>) + c.mLhs.nrTerms() * sizeof(typename Pol::TermType);
+	}
+	return res;
+}
+
 template<typename Pol>
 void ConstraintPool<Pol>::print(std::ostream& _out) const {
 	CONSTRAINT_POOL_LOCK_GUARD
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include "../util/Pool.h"
 #include "../util/Singleton.h"
 #include "../core/VariablePool.h"
 #include "Formula.h"
@@ -39,6 +40,8 @@ namespace carl
             FormulaContent<Pol>* mpFalse;
             /// The formula pool.
             FastPointerSet<FormulaContent<Pol>> mPool;
+            /// Usage counters.
+            pool::Counters mCounters;
             /// Mutex to avoid multiple access to the pool
             mutable std::recursive_mutex mMutexPool;
             ///
@@ -78,9 +81,34 @@ namespace carl
 
         public:
             std::size_t size() const {
+                FORMULA_POOL_LOCK_GUARD
                 return mPool.size();
             }
 
+            /// Returns the usage counters of the pool.
+            const pool::Counters& counters() const {
+                return mCounters;
+            }
+            std::size_t bucket_count() const {
+                FORMULA_POOL_LOCK_GUARD
+                return mPool.bucket_count();
+            }
+            double load_factor() const {
+                FORMULA_POOL_LOCK_GUARD
+                return static_cast<double>(mPool.load_factor());
+            }
+            /**
+             * Estimates the memory used by the pool and the formulas within the pool.
+             * The subformulas and constraints are only counted as references.
+             * @return Number of bytes.
+             */
+            std::size_t memory_usage() const {
+                FORMULA_POOL_LOCK_GUARD
+                std::size_t res = sizeof(FormulaPool<Pol>) + mPool.bucket_count() * sizeof(void*);
+                res += mPool.size() * (sizeof(FormulaContent<Pol>) + 2 * sizeof(void*));
+                return res;
+            }
+
             void print() const
             {
                 std::cout << "Formula pool contains:" << std::endl;
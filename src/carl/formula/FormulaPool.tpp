@@ -47,9 +47,14 @@ namespace carl
     std::pair<typename FastPointerSet<FormulaContent<Pol>>::iterator,bool> FormulaPool<Pol>::insert( FormulaContent<Pol>* _element )
     {
 		CARL_LOG_DEBUG("carl.formula", "Inserting " << static_cast<const void*>(_element));
+        std::size_t buckets = mPool.bucket_count();
         auto iterBoolPair = mPool.insert( _element );
-        if( !iterBoolPair.second ) // Formula has already been generated.
+        if( mPool.bucket_count() != buckets ) mCounters.rehashes.inc();
+        if( iterBoolPair.second )
+            mCounters.misses.inc();
+        else // Formula has already been generated.
         {
+            mCounters.hits.inc();
 			CARL_LOG_DEBUG("carl.formula", "Deleting " << static_cast<const void*>(_element) << " as it was already part of the pool");
 	        delete _element;
         }
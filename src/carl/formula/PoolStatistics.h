@@ -0,0 +1,129 @@
+/**
+ * @file PoolStatistics.h
+ *
+ * Reports the sizes and usage of the pools via the carl statistics framework.
+ */
+
+#pragma once
+
+#include <carl-statistics/Statistics.h>
+
+#include "../core/MonomialPool.h"
+#include "../numbers/numbers.h"
+#include "Formula.h"
+#include "bitvector/BVConstraintPool.h"
+#include "bitvector/BVTermContent.h"
+#include "bitvector/BVTermPool.h"
+
+#include <cstdint>
+#include <string>
+
+namespace carl {
+
+/**
+ * Collects the state of the monomial, constraint, formula and bitvector pools.
+ * For every pool, this reports the number of live elements, an estimate of the used memory, the load factor of the hash table,
+ * the number of rehashes and the hits and misses of requests to the pool.
+ * Rehashes, hits and misses are the counters of the pools and always current, the sizes are gauges that are updated by collect().
+ * For the monomial pool, monomials_entries additionally counts unreferenced monomials that were not collected yet.
+ * Additionally, it reports the largest monomial and constraint and histograms of the number of terms and the coefficient bit-sizes of all constraints.
+ *
+ * The statistics are registered with the StatisticsCollector by calling pool_statistics().
+ */
+template<typename Pol>
+class PoolStatistics : public statistics::Statistics {
+	/// Gauges of the state of a single pool, they are updated by collect().
+	struct pool_gauges {
+		statistics::gauge size;
+		statistics::gauge bytes;
+		statistics::gauge buckets;
+	};
+	pool_gauges mMonomials;
+	pool_gauges mConstraints;
+	pool_gauges mFormulas;
+	pool_gauges mBVTerms;
+	pool_gauges mBVConstraints;
+	/// Number of entries of the monomial pool, including unreferenced monomials.
+	statistics::gauge mMonomialEntries;
+
+	template<typename Pool>
+	void register_pool(const std::string& prefix, const Pool& pool, const pool_gauges& gauges) {
+		Statistics::addMetric(prefix + "_size", gauges.size);
+		Statistics::addMetric(prefix + "_bytes", gauges.bytes);
+		Statistics::addMetric(prefix + "_buckets", gauges.buckets);
+		Statistics::addMetric(prefix + "_rehashes", pool.counters().rehashes);
+		Statistics::addMetric(prefix + "_hits", pool.counters().hits);
+		Statistics::addMetric(prefix + "_misses", pool.counters().misses);
+	}
+	template<typename Pool>
+	void add_pool(const std::string& prefix, const Pool& pool, pool_gauges& gauges) {
+		gauges.size.set(static_cast<std::int64_t>(pool.size()));
+		gauges.bytes.set(static_cast<std::int64_t>(pool.memory_usage()));
+		gauges.buckets.set(static_cast<std::int64_t>(pool.bucket_count()));
+		Statistics::addKeyValuePair(prefix + "_load_factor", pool.load_factor());
+		Statistics::addKeyValuePair(prefix + "_hit_rate", pool.counters().hit_rate());
+	}
+public:
+	/// Number of terms of the constraints in the pool.
+	statistics::histogram term_counts;
+	/// Bit-sizes of the coefficients of the constraints in the pool.
+	statistics::histogram coefficient_bits;
+
+	PoolStatistics() {
+		register_pool("monomials", MonomialPool::getInstance(), mMonomials);
+		Statistics::addMetric("monomials_entries", mMonomialEntries);
+		register_pool("constraints", ConstraintPool<Pol>::getInstance(), mConstraints);
+		register_pool("formulas", FormulaPool<Pol>::getInstance(), mFormulas);
+		register_pool("bvterms", BVTermPool::getInstance(), mBVTerms);
+		register_pool("bvconstraints", BVConstraintPool::getInstance(), mBVConstraints);
+	}
+
+	void collect() override {
+		const auto& monomials = MonomialPool::getInstance();
+		add_pool("monomials", monomials, mMonomials);
+		mMonomialEntries.set(static_cast<std::int64_t>(monomials.entries()));
+		auto largest = monomials.largest();
+		if (largest) {
+			Statistics::addKeyValuePair("monomials_largest_id", largest->id());
+			Statistics::addKeyValuePair("monomials_largest_degree", largest->tdeg());
+		}
+
+		const auto& constraints = ConstraintPool<Pol>::getInstance();
+		add_pool("constraints", constraints, mConstraints);
+		term_counts.clear();
+		coefficient_bits.clear();
+		const ConstraintContent<Pol>* largestConstraint = nullptr;
+		constraints.for_each([&](const ConstraintContent<Pol>& c) {
+			term_counts.add(c.lhs().nrTerms());
+			for (const auto& t: c.lhs()) {
+				coefficient_bits.add(carl::bitsize(t.coeff()));
+			}
+			if (largestConstraint == nullptr || c.lhs().nrTerms() > largestConstraint->lhs().nrTerms()) {
+				largestConstraint = &c;
+			}
+		});
+		if (largestConstraint != nullptr) {
+			Statistics::addKeyValuePair("constraints_largest_id", largestConstraint->id());
+			Statistics::addKeyValuePair("constraints_largest_terms", largestConstraint->lhs().nrTerms());
+		}
+		Statistics::addKeyValuePair("constraints_terms", term_counts);
+		Statistics::addKeyValuePair("constraints_coefficient_bits", coefficient_bits);
+
+		add_pool("formulas", FormulaPool<Pol>::getInstance(), mFormulas);
+		add_pool("bvterms", BVTermPool::getInstance(), mBVTerms);
+		add_pool("bvconstraints", BVConstraintPool::getInstance(), mBVConstraints);
+	}
+};
+
+/**
+ * Registers the pool statistics with the StatisticsCollector.
+ * @param name Name of the statistics object.
+ * @return The pool statistics.
+ */
+template<typename Pol>
+PoolStatistics<Pol>& pool_statistics(const std::string& name = "pools") {
+	static auto& stats = statistics::get<PoolStatistics<Pol>>(name);
+	return stats;
+}
+
+}
@@ -44,6 +44,8 @@ public:
 	}
 #endif
 	BVValue(std::size_t _width, const mpz_class& _value);
+	BVValue(std::size_t _width, const HybridInteger& _value)
+		: BVValue(_width, _value.toMpz()) {}
 
 	template<typename BlockInputIterator>
 	explicit BVValue(BlockInputIterator _first, BlockInputIterator _last)
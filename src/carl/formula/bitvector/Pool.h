@@ -8,6 +8,7 @@
 #pragma once
 
 #include "../../util/Common.h"
+#include "../../util/Pool.h"
 #include "../../util/Singleton.h"
 
 #include <mutex>
@@ -30,6 +31,8 @@ namespace carl
 		unsigned mIdAllocator = 1;
 		/// The formula pool.
 		FastPointerSet<Element> mPool;
+		/// Usage counters.
+		pool::Counters mCounters;
 		/// Mutex to avoid multiple access to the pool
 		mutable std::mutex mMutexPool;
 
@@ -77,6 +80,32 @@ namespace carl
 			std::cout << std::endl;
 		}
 
+		std::size_t size() const {
+			POOL_LOCK_GUARD
+			return mPool.size();
+		}
+
+		/// Returns the usage counters of the pool.
+		const pool::Counters& counters() const {
+			return mCounters;
+		}
+		std::size_t bucket_count() const {
+			POOL_LOCK_GUARD
+			return mPool.bucket_count();
+		}
+		double load_factor() const {
+			POOL_LOCK_GUARD
+			return static_cast<double>(mPool.load_factor());
+		}
+		/**
+		 * Estimates the memory used by the pool and the elements within the pool.
+		 * @return Number of bytes.
+		 */
+		std::size_t memory_usage() const {
+			POOL_LOCK_GUARD
+			return mPool.bucket_count() * sizeof(void*) + mPool.size() * (sizeof(Element) + 2 * sizeof(void*));
+		}
+
 		/**
 		 * Inserts the given element into the pool, if it does not yet occur in there.
 		 * @param _element The element to add to the pool.
@@ -88,13 +117,17 @@ namespace carl
 		std::pair<typename FastPointerSet<Element>::iterator, bool> insert(ElementPtr _element, bool _assertFreshness = false)
 		{
 			POOL_LOCK_GUARD
+			std::size_t buckets = mPool.bucket_count();
 			auto iterBoolPair = mPool.insert(_element);
 			assert(iterBoolPair.second || !_assertFreshness);
+			if(mPool.bucket_count() != buckets) mCounters.rehashes.inc();
 
 			if(iterBoolPair.second) { // Element has just been inserted
+				mCounters.misses.inc();
 				// Assign a new id
 				assignId(_element, mIdAllocator++); // id should be set here to avoid conflicts when multi-threading
 			} else {
+				mCounters.hits.inc();
 				// The argument can be deleted, return the already existent instance
 				delete _element;
 			}
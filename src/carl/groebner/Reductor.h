@@ -75,7 +75,7 @@ protected:
 private:
 	const Ideal<PolynomialInIdeal>& mIdeal;
 	Datastructure<Configuration<InputPolynomial>> mDatastruct;
-	std::vector<Term<Coeff>> mRemainder;
+	typename InputPolynomial::TermsType mRemainder;
 	bool mReductionOccured;
 	BitVector mReasons;
 public:
@@ -35,6 +35,7 @@
 #include "../Ideal.h"
 #include "../Reductor.h"
 #include "CriticalPairs.h"
+#include "../../util/Instrumentation.h"
 
 #include <list>
 #include <unordered_map>
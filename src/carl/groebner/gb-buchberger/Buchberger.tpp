@@ -39,6 +39,7 @@ namespace carl
 template<class Polynomial, template<typename> class AddingPolicy>
 void Buchberger<Polynomial, AddingPolicy>::calculate(const std::list<Polynomial>& scheduledForAdding)
 {
+	CARL_INSTRUMENT("buchberger", pGb->getGenerators(), scheduledForAdding);
 	CARL_LOG_INFO("carl.gb.buchberger", "Calculate gb");
 	for(unsigned i = 0; i < pGb->getGenerators().size(); ++i)
 	{
@@ -29,7 +29,7 @@ namespace carl {
             /// Stores the numerator
             Polynomial mNumerator;
             /// Stores the denominator, which is one, if mDenominator == nullptr
-            std::shared_ptr<const typename Polynomial::MonomType> mDenominator;
+            typename Polynomial::MonomType::Arg mDenominator;
 
 
             
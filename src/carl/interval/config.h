@@ -0,0 +1 @@
+/* #undef USE_MPFR_FLOAT */
@@ -33,7 +33,7 @@ struct ConstructorPrinter {
 		os << "Variable(" << v.id() << ")";
 	}
 	void operator()(std::ostream& os, const Monomial::Arg& m) {
-		os << "std::make_shared<const Monomial>(std::initializer_list<std::pair<Variable, exponent>>({";
+		os << "createMonomial(std::initializer_list<std::pair<Variable, exponent>>({";
 		bool first = true;
 		for (const auto& p: *m) {
 			if (!first) os << ", ";
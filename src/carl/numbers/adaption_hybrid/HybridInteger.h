@@ -0,0 +1,303 @@
+/**
+ * @file   adaption_hybrid/HybridInteger.h
+ * @ingroup hybrid
+ *
+ * @warning This file should never be included directly but only via numbers.h
+ */
+
+#pragma once
+
+#ifndef INCLUDED_FROM_NUMBERS_H
+static_assert(false, "This file may only be included indirectly by numbers.h");
+#endif
+
+#include "../../util/SFINAE.h"
+#include "../adaption_gmpxx/include.h"
+
+#include <cassert>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+namespace carl {
+
+/**
+ * An arbitrary precision integer that stores small values inline.
+ *
+ * Values in \f$(-2^{63}, 2^{63})\f$ are kept in a native integer, all other values are stored as a heap allocated mpz_class.
+ * The representation is canonical: a value is stored as mpz_class if and only if it does not fit the native integer.
+ * Hence two numbers in different representations are never equal.
+ * Arithmetic on two small values is checked for overflow and promoted to GMP only if necessary.
+ *
+ * We exclude the smallest native integer from the small range such that negation and abs() can never overflow.
+ */
+class HybridInteger {
+private:
+	/// Inline value, only valid if mBig is nullptr.
+	sint mSmall = 0;
+	/// Value that does not fit into mSmall.
+	mpz_class* mBig = nullptr;
+
+	template<typename T>
+	static constexpr bool isSmallValue(T n) {
+		if constexpr (std::is_signed<T>::value) {
+			return sizeof(T) < sizeof(sint) || (n > static_cast<T>(std::numeric_limits<sint>::min()) && n <= static_cast<T>(std::numeric_limits<sint>::max()));
+		} else {
+			return n <= static_cast<T>(std::numeric_limits<sint>::max());
+		}
+	}
+
+	void clearBig() {
+		delete mBig;
+		mBig = nullptr;
+	}
+
+public:
+	/// Checks whether the given GMP integer can be stored inline.
+	static bool fitsSmall(const mpz_class& n) {
+		return mpz_fits_slong_p(n.get_mpz_t()) && mpz_get_si(n.get_mpz_t()) != std::numeric_limits<sint>::min();
+	}
+
+	HybridInteger() = default;
+
+	template<typename T, EnableIf<std::is_integral<T>> = dummy>
+	HybridInteger(T n) { // NOLINT
+		if (isSmallValue(n)) {
+			mSmall = static_cast<sint>(n);
+		} else if constexpr (std::is_signed<T>::value) {
+			mBig = new mpz_class(static_cast<signed long>(n));
+		} else {
+			mBig = new mpz_class(static_cast<unsigned long>(n));
+		}
+	}
+
+	HybridInteger(const mpz_class& n) { // NOLINT
+		*this = n;
+	}
+
+	/// Parses the given string, as mpz_class does.
+	explicit HybridInteger(const std::string& s) {
+		*this = mpz_class(s);
+	}
+	explicit HybridInteger(const char* s): HybridInteger(std::string(s)) {}
+
+	HybridInteger(const HybridInteger& n): mSmall(n.mSmall) {
+		if (n.mBig != nullptr) mBig = new mpz_class(*n.mBig);
+	}
+
+	HybridInteger(HybridInteger&& n) noexcept: mSmall(n.mSmall), mBig(n.mBig) {
+		n.mBig = nullptr;
+	}
+
+	~HybridInteger() {
+		delete mBig;
+	}
+
+	HybridInteger& operator=(const HybridInteger& n) {
+		if (this == &n) return *this;
+		if (n.mBig == nullptr) {
+			clearBig();
+			mSmall = n.mSmall;
+		} else if (mBig == nullptr) {
+			mBig = new mpz_class(*n.mBig);
+		} else {
+			*mBig = *n.mBig;
+		}
+		return *this;
+	}
+
+	HybridInteger& operator=(HybridInteger&& n) noexcept {
+		if (this == &n) return *this;
+		delete mBig;
+		mSmall = n.mSmall;
+		mBig = n.mBig;
+		n.mBig = nullptr;
+		return *this;
+	}
+
+	template<typename T, EnableIf<std::is_integral<T>> = dummy>
+	HybridInteger& operator=(T n) {
+		return *this = HybridInteger(n);
+	}
+
+	HybridInteger& operator=(const mpz_class& n) {
+		if (fitsSmall(n)) {
+			clearBig();
+			mSmall = mpz_get_si(n.get_mpz_t());
+		} else if (mBig == nullptr) {
+			mBig = new mpz_class(n);
+		} else {
+			*mBig = n;
+		}
+		return *this;
+	}
+
+	HybridInteger& operator=(mpz_class&& n) {
+		if (fitsSmall(n)) {
+			clearBig();
+			mSmall = mpz_get_si(n.get_mpz_t());
+		} else if (mBig == nullptr) {
+			mBig = new mpz_class(std::move(n));
+		} else {
+			*mBig = std::move(n);
+		}
+		return *this;
+	}
+
+	/// Checks whether the value is stored inline.
+	bool isSmall() const {
+		return mBig == nullptr;
+	}
+	/// Returns the inline value. Asserts that the value is small.
+	sint small() const {
+		assert(isSmall());
+		return mSmall;
+	}
+	/// Returns the GMP value. Asserts that the value is not small.
+	const mpz_class& big() const {
+		assert(!isSmall());
+		return *mBig;
+	}
+	/// Returns the value as GMP integer, regardless of the representation.
+	mpz_class toMpz() const {
+		if (isSmall()) return mpz_class(static_cast<signed long>(mSmall));
+		return *mBig;
+	}
+	/// Returns the sign of the value.
+	int sgn() const {
+		if (isSmall()) return (mSmall > 0) - (mSmall < 0);
+		return mpz_sgn(mBig->get_mpz_t());
+	}
+
+	HybridInteger operator-() const {
+		if (isSmall()) {
+			HybridInteger res;
+			res.mSmall = -mSmall;
+			return res;
+		}
+		return HybridInteger(mpz_class(-*mBig));
+	}
+
+	HybridInteger& operator+=(const HybridInteger& rhs) {
+		sint res;
+		if (isSmall() && rhs.isSmall() && !__builtin_add_overflow(mSmall, rhs.mSmall, &res) && isSmallValue(res)) {
+			mSmall = res;
+			return *this;
+		}
+		return *this = mpz_class(toMpz() + rhs.toMpz());
+	}
+	HybridInteger& operator-=(const HybridInteger& rhs) {
+		sint res;
+		if (isSmall() && rhs.isSmall() && !__builtin_sub_overflow(mSmall, rhs.mSmall, &res) && isSmallValue(res)) {
+			mSmall = res;
+			return *this;
+		}
+		return *this = mpz_class(toMpz() - rhs.toMpz());
+	}
+	HybridInteger& operator*=(const HybridInteger& rhs) {
+		sint res;
+		if (isSmall() && rhs.isSmall() && !__builtin_mul_overflow(mSmall, rhs.mSmall, &res) && isSmallValue(res)) {
+			mSmall = res;
+			return *this;
+		}
+		return *this = mpz_class(toMpz() * rhs.toMpz());
+	}
+	/// Truncating division, as for native integers.
+	HybridInteger& operator/=(const HybridInteger& rhs) {
+		assert(rhs.sgn() != 0);
+		if (isSmall() && rhs.isSmall()) {
+			// Can not overflow as the smallest native integer is never small.
+			mSmall /= rhs.mSmall;
+			return *this;
+		}
+		mpz_class res;
+		mpz_tdiv_q(res.get_mpz_t(), toMpz().get_mpz_t(), rhs.toMpz().get_mpz_t());
+		return *this = std::move(res);
+	}
+	/// Remainder of the truncating division, as for native integers.
+	HybridInteger& operator%=(const HybridInteger& rhs) {
+		assert(rhs.sgn() != 0);
+		if (isSmall() && rhs.isSmall()) {
+			mSmall %= rhs.mSmall;
+			return *this;
+		}
+		mpz_class res;
+		mpz_tdiv_r(res.get_mpz_t(), toMpz().get_mpz_t(), rhs.toMpz().get_mpz_t());
+		return *this = std::move(res);
+	}
+	HybridInteger& operator++() {
+		return *this += HybridInteger(1);
+	}
+	HybridInteger& operator--() {
+		return *this -= HybridInteger(1);
+	}
+};
+
+inline HybridInteger operator+(const HybridInteger& lhs, const HybridInteger& rhs) {
+	HybridInteger res(lhs);
+	res += rhs;
+	return res;
+}
+inline HybridInteger operator-(const HybridInteger& lhs, const HybridInteger& rhs) {
+	HybridInteger res(lhs);
+	res -= rhs;
+	return res;
+}
+inline HybridInteger operator*(const HybridInteger& lhs, const HybridInteger& rhs) {
+	HybridInteger res(lhs);
+	res *= rhs;
+	return res;
+}
+inline HybridInteger operator/(const HybridInteger& lhs, const HybridInteger& rhs) {
+	HybridInteger res(lhs);
+	res /= rhs;
+	return res;
+}
+inline HybridInteger operator%(const HybridInteger& lhs, const HybridInteger& rhs) {
+	HybridInteger res(lhs);
+	res %= rhs;
+	return res;
+}
+
+/**
+ * Compares two numbers.
+ * @return A negative number if lhs < rhs, zero if lhs = rhs and a positive number otherwise.
+ */
+inline int compare(const HybridInteger& lhs, const HybridInteger& rhs) {
+	if (lhs.isSmall() && rhs.isSmall()) {
+		return (lhs.small() > rhs.small()) - (lhs.small() < rhs.small());
+	}
+	// A big number is larger than any small number iff it is positive.
+	if (lhs.isSmall()) return -rhs.sgn();
+	if (rhs.isSmall()) return lhs.sgn();
+	return cmp(lhs.big(), rhs.big());
+}
+
+inline bool operator==(const HybridInteger& lhs, const HybridInteger& rhs) {
+	if (lhs.isSmall() != rhs.isSmall()) return false;
+	if (lhs.isSmall()) return lhs.small() == rhs.small();
+	return lhs.big() == rhs.big();
+}
+inline bool operator!=(const HybridInteger& lhs, const HybridInteger& rhs) {
+	return !(lhs == rhs);
+}
+inline bool operator<(const HybridInteger& lhs, const HybridInteger& rhs) {
+	return compare(lhs, rhs) < 0;
+}
+inline bool operator<=(const HybridInteger& lhs, const HybridInteger& rhs) {
+	return compare(lhs, rhs) <= 0;
+}
+inline bool operator>(const HybridInteger& lhs, const HybridInteger& rhs) {
+	return compare(lhs, rhs) > 0;
+}
+inline bool operator>=(const HybridInteger& lhs, const HybridInteger& rhs) {
+	return compare(lhs, rhs) >= 0;
+}
+
+inline std::ostream& operator<<(std::ostream& os, const HybridInteger& n) {
+	if (n.isSmall()) return os << n.small();
+	return os << n.big();
+}
+
+}
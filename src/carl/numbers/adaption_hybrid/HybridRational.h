@@ -0,0 +1,367 @@
+/**
+ * @file   adaption_hybrid/HybridRational.h
+ * @ingroup hybrid
+ *
+ * @warning This file should never be included directly but only via numbers.h
+ */
+
+#pragma once
+
+#ifndef INCLUDED_FROM_NUMBERS_H
+static_assert(false, "This file may only be included indirectly by numbers.h");
+#endif
+
+#include "HybridInteger.h"
+
+#include <numeric>
+
+namespace carl {
+
+/**
+ * An arbitrary precision rational that stores small fractions inline.
+ *
+ * A fraction whose numerator and denominator both fit into a native integer (see HybridInteger) is stored as a canceled pair of native integers with positive denominator.
+ * All other values are stored as a heap allocated mpq_class.
+ * As for HybridInteger, the representation is canonical.
+ *
+ * Arithmetic on small fractions uses overflow checked native operations and only falls back to GMP if some intermediate result overflows.
+ * Multiplication cancels crosswise before multiplying, hence the result is canceled without computing another gcd.
+ */
+class HybridRational {
+private:
+	/// Inline numerator, only valid if mBig is nullptr.
+	sint mNum = 0;
+	/// Inline denominator, only valid if mBig is nullptr. Always positive and coprime to mNum.
+	sint mDen = 1;
+	/// Value that does not fit into mNum / mDen.
+	mpq_class* mBig = nullptr;
+
+	void clearBig() {
+		delete mBig;
+		mBig = nullptr;
+	}
+
+	static bool isSmallValue(sint n) {
+		return n != std::numeric_limits<sint>::min();
+	}
+
+	static sint gcd(sint a, sint b) {
+		return std::gcd(a, b);
+	}
+
+	/// Sets this to n / d, where d is positive and n and d are coprime.
+	void setCanceled(sint n, sint d) {
+		assert(d > 0);
+		clearBig();
+		mNum = n;
+		mDen = d;
+	}
+
+	/// Sets this to n / d for arbitrary n and positive d.
+	void setSmall(sint n, sint d) {
+		sint g = gcd(n, d);
+		if (g > 1) {
+			n /= g;
+			d /= g;
+		}
+		setCanceled(n, d);
+	}
+
+public:
+	/// Checks whether the given GMP rational can be stored inline.
+	static bool fitsSmall(const mpq_class& n) {
+		return HybridInteger::fitsSmall(n.get_num()) && HybridInteger::fitsSmall(n.get_den());
+	}
+
+	HybridRational() = default;
+
+	template<typename T, EnableIf<std::is_integral<T>> = dummy>
+	HybridRational(T n) { // NOLINT
+		*this = HybridInteger(n);
+	}
+
+	HybridRational(const HybridInteger& n) { // NOLINT
+		*this = n;
+	}
+
+	HybridRational(const mpz_class& n) { // NOLINT
+		*this = HybridInteger(n);
+	}
+
+	HybridRational(const mpq_class& n) { // NOLINT
+		*this = n;
+	}
+
+	/// Constructs the fraction n / d. Asserts that d is not zero.
+	HybridRational(const HybridInteger& n, const HybridInteger& d) {
+		assert(d.sgn() != 0);
+		if (n.isSmall() && d.isSmall()) {
+			// Negation can not overflow for small values.
+			if (d.small() < 0) setSmall(-n.small(), -d.small());
+			else setSmall(n.small(), d.small());
+		} else {
+			mpq_class res(n.toMpz(), d.toMpz());
+			res.canonicalize();
+			*this = std::move(res);
+		}
+	}
+
+	/// Parses the given string, as mpq_class does.
+	explicit HybridRational(const std::string& s) {
+		mpq_class res(s);
+		res.canonicalize();
+		*this = std::move(res);
+	}
+	explicit HybridRational(const char* s): HybridRational(std::string(s)) {}
+
+	HybridRational(const HybridRational& n): mNum(n.mNum), mDen(n.mDen) {
+		if (n.mBig != nullptr) mBig = new mpq_class(*n.mBig);
+	}
+
+	HybridRational(HybridRational&& n) noexcept: mNum(n.mNum), mDen(n.mDen), mBig(n.mBig) {
+		n.mBig = nullptr;
+	}
+
+	~HybridRational() {
+		delete mBig;
+	}
+
+	HybridRational& operator=(const HybridRational& n) {
+		if (this == &n) return *this;
+		if (n.mBig == nullptr) {
+			setCanceled(n.mNum, n.mDen);
+		} else if (mBig == nullptr) {
+			mBig = new mpq_class(*n.mBig);
+		} else {
+			*mBig = *n.mBig;
+		}
+		return *this;
+	}
+
+	HybridRational& operator=(HybridRational&& n) noexcept {
+		if (this == &n) return *this;
+		delete mBig;
+		mNum = n.mNum;
+		mDen = n.mDen;
+		mBig = n.mBig;
+		n.mBig = nullptr;
+		return *this;
+	}
+
+	template<typename T, EnableIf<std::is_integral<T>> = dummy>
+	HybridRational& operator=(T n) {
+		return *this = HybridRational(n);
+	}
+
+	HybridRational& operator=(const HybridInteger& n) {
+		if (n.isSmall()) {
+			setCanceled(n.small(), 1);
+		} else {
+			*this = mpq_class(n.big());
+		}
+		return *this;
+	}
+
+	HybridRational& operator=(const mpq_class& n) {
+		return *this = mpq_class(n);
+	}
+
+	HybridRational& operator=(mpq_class&& n) {
+		if (fitsSmall(n)) {
+			setCanceled(mpz_get_si(n.get_num_mpz_t()), mpz_get_si(n.get_den_mpz_t()));
+		} else if (mBig == nullptr) {
+			mBig = new mpq_class(std::move(n));
+		} else {
+			*mBig = std::move(n);
+		}
+		return *this;
+	}
+
+	/// Checks whether the value is stored inline.
+	bool isSmall() const {
+		return mBig == nullptr;
+	}
+	/// Returns the inline numerator. Asserts that the value is small.
+	sint smallNum() const {
+		assert(isSmall());
+		return mNum;
+	}
+	/// Returns the inline denominator. Asserts that the value is small.
+	sint smallDen() const {
+		assert(isSmall());
+		return mDen;
+	}
+	/// Returns the GMP value. Asserts that the value is not small.
+	const mpq_class& big() const {
+		assert(!isSmall());
+		return *mBig;
+	}
+	/// Returns the value as GMP rational, regardless of the representation.
+	mpq_class toMpq() const {
+		if (isSmall()) {
+			mpq_class res;
+			mpz_set_si(res.get_num_mpz_t(), mNum);
+			mpz_set_si(res.get_den_mpz_t(), mDen);
+			return res;
+		}
+		return *mBig;
+	}
+	/// Returns the numerator.
+	HybridInteger num() const {
+		if (isSmall()) return HybridInteger(mNum);
+		return HybridInteger(mpz_class(mBig->get_num()));
+	}
+	/// Returns the denominator.
+	HybridInteger den() const {
+		if (isSmall()) return HybridInteger(mDen);
+		return HybridInteger(mpz_class(mBig->get_den()));
+	}
+	/// Returns the sign of the value.
+	int sgn() const {
+		if (isSmall()) return (mNum > 0) - (mNum < 0);
+		return mpq_sgn(mBig->get_mpq_t());
+	}
+
+	HybridRational operator-() const {
+		if (isSmall()) {
+			HybridRational res;
+			res.setCanceled(-mNum, mDen);
+			return res;
+		}
+		return HybridRational(mpq_class(-*mBig));
+	}
+
+	HybridRational& operator+=(const HybridRational& rhs) {
+		if (isSmall() && rhs.isSmall()) {
+			sint n;
+			if (mDen == rhs.mDen) {
+				if (!__builtin_add_overflow(mNum, rhs.mNum, &n) && isSmallValue(n)) {
+					if (mDen == 1) mNum = n;
+					else setSmall(n, mDen);
+					return *this;
+				}
+			} else {
+				// a/b + c/d = (a*(d/g) + c*(b/g)) / (b*(d/g)) with g = gcd(b,d)
+				sint g = gcd(mDen, rhs.mDen);
+				sint l, r, d;
+				if (!__builtin_mul_overflow(mNum, rhs.mDen / g, &l)
+					&& !__builtin_mul_overflow(rhs.mNum, mDen / g, &r)
+					&& !__builtin_add_overflow(l, r, &n) && isSmallValue(n)
+					&& !__builtin_mul_overflow(mDen, rhs.mDen / g, &d)
+				) {
+					setSmall(n, d);
+					return *this;
+				}
+			}
+		}
+		return *this = mpq_class(toMpq() + rhs.toMpq());
+	}
+	HybridRational& operator-=(const HybridRational& rhs) {
+		if (isSmall() && rhs.isSmall()) {
+			// Negation can not overflow for small values.
+			HybridRational neg;
+			neg.setCanceled(-rhs.mNum, rhs.mDen);
+			return *this += neg;
+		}
+		return *this = mpq_class(toMpq() - rhs.toMpq());
+	}
+	HybridRational& operator*=(const HybridRational& rhs) {
+		if (isSmall() && rhs.isSmall()) {
+			// (a/b) * (c/d) = ((a/g1)*(c/g2)) / ((b/g2)*(d/g1)) with g1 = gcd(a,d), g2 = gcd(c,b)
+			sint g1 = gcd(mNum, rhs.mDen);
+			sint g2 = gcd(rhs.mNum, mDen);
+			if (g1 == 0) g1 = 1;
+			if (g2 == 0) g2 = 1;
+			sint n, d;
+			if (!__builtin_mul_overflow(mNum / g1, rhs.mNum / g2, &n) && isSmallValue(n)
+				&& !__builtin_mul_overflow(mDen / g2, rhs.mDen / g1, &d)
+			) {
+				if (n == 0) setCanceled(0, 1);
+				else setCanceled(n, d);
+				return *this;
+			}
+		}
+		return *this = mpq_class(toMpq() * rhs.toMpq());
+	}
+	HybridRational& operator/=(const HybridRational& rhs) {
+		assert(rhs.sgn() != 0);
+		if (rhs.isSmall()) {
+			// Multiply with the reciprocal, negation can not overflow for small values.
+			HybridRational inv;
+			if (rhs.mNum < 0) inv.setCanceled(-rhs.mDen, -rhs.mNum);
+			else inv.setCanceled(rhs.mDen, rhs.mNum);
+			return *this *= inv;
+		}
+		mpq_class res;
+		mpq_div(res.get_mpq_t(), toMpq().get_mpq_t(), rhs.big().get_mpq_t());
+		return *this = std::move(res);
+	}
+};
+
+inline HybridRational operator+(const HybridRational& lhs, const HybridRational& rhs) {
+	HybridRational res(lhs);
+	res += rhs;
+	return res;
+}
+inline HybridRational operator-(const HybridRational& lhs, const HybridRational& rhs) {
+	HybridRational res(lhs);
+	res -= rhs;
+	return res;
+}
+inline HybridRational operator*(const HybridRational& lhs, const HybridRational& rhs) {
+	HybridRational res(lhs);
+	res *= rhs;
+	return res;
+}
+inline HybridRational operator/(const HybridRational& lhs, const HybridRational& rhs) {
+	HybridRational res(lhs);
+	res /= rhs;
+	return res;
+}
+
+/**
+ * Compares two numbers.
+ * @return A negative number if lhs < rhs, zero if lhs = rhs and a positive number otherwise.
+ */
+inline int compare(const HybridRational& lhs, const HybridRational& rhs) {
+	if (lhs.isSmall() && rhs.isSmall()) {
+		if (lhs.smallDen() == rhs.smallDen()) {
+			return (lhs.smallNum() > rhs.smallNum()) - (lhs.smallNum() < rhs.smallNum());
+		}
+		sint l, r;
+		if (!__builtin_mul_overflow(lhs.smallNum(), rhs.smallDen(), &l) && !__builtin_mul_overflow(rhs.smallNum(), lhs.smallDen(), &r)) {
+			return (l > r) - (l < r);
+		}
+	}
+	return cmp(lhs.toMpq(), rhs.toMpq());
+}
+
+inline bool operator==(const HybridRational& lhs, const HybridRational& rhs) {
+	if (lhs.isSmall() != rhs.isSmall()) return false;
+	if (lhs.isSmall()) return lhs.smallNum() == rhs.smallNum() && lhs.smallDen() == rhs.smallDen();
+	return lhs.big() == rhs.big();
+}
+inline bool operator!=(const HybridRational& lhs, const HybridRational& rhs) {
+	return !(lhs == rhs);
+}
+inline bool operator<(const HybridRational& lhs, const HybridRational& rhs) {
+	return compare(lhs, rhs) < 0;
+}
+inline bool operator<=(const HybridRational& lhs, const HybridRational& rhs) {
+	return compare(lhs, rhs) <= 0;
+}
+inline bool operator>(const HybridRational& lhs, const HybridRational& rhs) {
+	return compare(lhs, rhs) > 0;
+}
+inline bool operator>=(const HybridRational& lhs, const HybridRational& rhs) {
+	return compare(lhs, rhs) >= 0;
+}
+
+inline std::ostream& operator<<(std::ostream& os, const HybridRational& n) {
+	if (!n.isSmall()) return os << n.big();
+	os << n.smallNum();
+	if (n.smallDen() != 1) os << "/" << n.smallDen();
+	return os;
+}
+
+}
@@ -0,0 +1,44 @@
+/** 
+ * @file    adaption_hybrid/hash.h
+ * @ingroup hybrid
+ *
+ * The hash values are consistent with the gmpxx hashes, i.e. a hybrid number hashes to the same value as the respective gmpxx number.
+ */
+
+#pragma once
+
+#ifndef INCLUDED_FROM_NUMBERS_H
+static_assert(false, "This file may only be included indirectly by numbers.h");
+#endif
+
+#include "../../util/hash.h"
+#include "../adaption_gmpxx/hash.h"
+#include "HybridRational.h"
+
+#include <cstddef>
+#include <functional>
+
+namespace std {
+
+template<> 
+struct hash<carl::HybridInteger> {
+	std::size_t operator()(const carl::HybridInteger& z) const {
+		if (z.isSmall()) {
+			// mpz_get_ui returns the absolute value modulo 2^64.
+			return static_cast<std::size_t>(z.small() < 0 ? -z.small() : z.small());
+		}
+		return std::hash<mpz_class>()(z.big());
+	}
+};
+
+template<>
+struct hash<carl::HybridRational> {
+	std::size_t operator()(const carl::HybridRational& q) const {
+		if (q.isSmall()) {
+			return carl::hash_all(carl::HybridInteger(q.smallNum()), carl::HybridInteger(q.smallDen()));
+		}
+		return std::hash<mpq_class>()(q.big());
+	}
+};
+
+}
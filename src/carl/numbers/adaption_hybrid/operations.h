@@ -0,0 +1,535 @@
+/**
+ * @file   adaption_hybrid/operations.h
+ * @ingroup hybrid
+ *
+ * Operations on HybridInteger and HybridRational.
+ * All operations work on the native representation if possible and fall back to the respective gmpxx implementation otherwise.
+ *
+ * @warning This file should never be included directly but only via numbers.h
+ */
+
+#pragma once
+
+#ifndef INCLUDED_FROM_NUMBERS_H
+static_assert(false, "This file may only be included indirectly by numbers.h");
+#endif
+
+#include "../adaption_gmpxx/operations.h"
+#include "HybridRational.h"
+#include "typetraits.h"
+
+#include <cstdlib>
+#include <string>
+#include <utility>
+
+namespace carl {
+
+/**
+ * Informational functions
+ *
+ * The following functions return informations about the given numbers.
+ */
+inline bool isZero(const HybridInteger& n) {
+	return n.isSmall() && n.small() == 0;
+}
+
+inline bool isZero(const HybridRational& n) {
+	return n.isSmall() && n.smallNum() == 0;
+}
+
+inline bool is_zero(const HybridInteger& n) {
+	return isZero(n);
+}
+
+inline bool is_zero(const HybridRational& n) {
+	return isZero(n);
+}
+
+inline bool isOne(const HybridInteger& n) {
+	return n.isSmall() && n.small() == 1;
+}
+
+inline bool isOne(const HybridRational& n) {
+	return n.isSmall() && n.smallNum() == 1 && n.smallDen() == 1;
+}
+
+inline bool is_one(const HybridInteger& n) {
+	return isOne(n);
+}
+
+inline bool is_one(const HybridRational& n) {
+	return isOne(n);
+}
+
+inline bool isPositive(const HybridInteger& n) {
+	return n.sgn() > 0;
+}
+
+inline bool isPositive(const HybridRational& n) {
+	return n.sgn() > 0;
+}
+
+inline bool isNegative(const HybridInteger& n) {
+	return n.sgn() < 0;
+}
+
+inline bool isNegative(const HybridRational& n) {
+	return n.sgn() < 0;
+}
+
+inline HybridInteger getNum(const HybridRational& n) {
+	return n.num();
+}
+
+inline HybridInteger getNum(const HybridInteger& n) {
+	return n;
+}
+
+inline HybridInteger getDenom(const HybridRational& n) {
+	return n.den();
+}
+
+inline HybridInteger getDenom(const HybridInteger& n) {
+	return n;
+}
+
+inline bool isInteger(const HybridRational& n) {
+	if (n.isSmall()) return n.smallDen() == 1;
+	return carl::isInteger(n.big());
+}
+
+inline bool isInteger(const HybridInteger& /*unused*/) {
+	return true;
+}
+
+/**
+ * Get the bit size of the representation of a integer.
+ * @param n An integer.
+ * @return Bit size of n.
+ */
+inline std::size_t bitsize(const HybridInteger& n) {
+	if (n.isSmall()) {
+		if (n.small() == 0) return 1;
+		return static_cast<std::size_t>(64 - __builtin_clzll(static_cast<unsigned long long>(std::llabs(n.small()))));
+	}
+	return carl::bitsize(n.big());
+}
+/**
+ * Get the bit size of the representation of a fraction.
+ * @param n A fraction.
+ * @return Bit size of n.
+ */
+inline std::size_t bitsize(const HybridRational& n) {
+	if (n.isSmall()) return bitsize(HybridInteger(n.smallNum())) + bitsize(HybridInteger(n.smallDen()));
+	return carl::bitsize(n.big());
+}
+
+/**
+ * Conversion functions
+ *
+ * The following function convert types to other types.
+ */
+
+inline double toDouble(const HybridRational& n) {
+	if (n.isSmall()) {
+		if (n.smallDen() == 1) return static_cast<double>(n.smallNum());
+		return n.toMpq().get_d();
+	}
+	return n.big().get_d();
+}
+inline double toDouble(const HybridInteger& n) {
+	if (n.isSmall()) return static_cast<double>(n.small());
+	return n.big().get_d();
+}
+
+template<typename Integer>
+inline Integer toInt(const HybridInteger& n);
+
+template<>
+inline sint toInt<sint>(const HybridInteger& n) {
+	if (n.isSmall()) return n.small();
+	return toInt<sint>(n.big());
+}
+template<>
+inline uint toInt<uint>(const HybridInteger& n) {
+	if (n.isSmall()) {
+		assert(n.small() >= 0);
+		return static_cast<uint>(n.small());
+	}
+	return toInt<uint>(n.big());
+}
+
+template<typename Integer>
+inline Integer toInt(const HybridRational& n);
+
+/**
+ * Convert a fraction to an integer.
+ * This method assert, that the given fraction is an integer, i.e. that the denominator is one.
+ * @param n A fraction.
+ * @return An integer.
+ */
+template<>
+inline HybridInteger toInt<HybridInteger>(const HybridRational& n) {
+	assert(isInteger(n));
+	return getNum(n);
+}
+template<>
+inline sint toInt<sint>(const HybridRational& n) {
+	return toInt<sint>(toInt<HybridInteger>(n));
+}
+template<>
+inline uint toInt<uint>(const HybridRational& n) {
+	return toInt<uint>(toInt<HybridInteger>(n));
+}
+
+template<>
+inline HybridInteger fromInt(const uint& n) {
+	return HybridInteger(n);
+}
+template<>
+inline HybridInteger fromInt(const sint& n) {
+	return HybridInteger(n);
+}
+template<>
+inline HybridRational fromInt(const uint& n) {
+	return HybridRational(n);
+}
+template<>
+inline HybridRational fromInt(const sint& n) {
+	return HybridRational(n);
+}
+
+template<>
+inline HybridRational rationalize<HybridRational>(float n) {
+	return HybridRational(rationalize<mpq_class>(n));
+}
+
+template<>
+inline HybridRational rationalize<HybridRational>(double n) {
+	return HybridRational(rationalize<mpq_class>(n));
+}
+
+template<>
+inline HybridRational rationalize<HybridRational>(int n) {
+	return HybridRational(n);
+}
+
+template<>
+inline HybridRational rationalize<HybridRational>(uint n) {
+	return HybridRational(n);
+}
+
+template<>
+inline HybridRational rationalize<HybridRational>(sint n) {
+	return HybridRational(n);
+}
+
+template<>
+inline HybridInteger parse<HybridInteger>(const std::string& n) {
+	return HybridInteger(parse<mpz_class>(n));
+}
+
+template<>
+inline bool try_parse<HybridInteger>(const std::string& n, HybridInteger& res) {
+	mpz_class tmp;
+	if (!try_parse<mpz_class>(n, tmp)) return false;
+	res = std::move(tmp);
+	return true;
+}
+
+template<>
+inline HybridRational parse<HybridRational>(const std::string& n) {
+	return HybridRational(parse<mpq_class>(n));
+}
+
+template<>
+inline bool try_parse<HybridRational>(const std::string& n, HybridRational& res) {
+	mpq_class tmp;
+	if (!try_parse<mpq_class>(n, tmp)) return false;
+	res = std::move(tmp);
+	return true;
+}
+
+/**
+ * Basic Operators
+ *
+ * The following functions implement simple operations on the given numbers.
+ */
+
+inline HybridInteger abs(const HybridInteger& n) {
+	return isNegative(n) ? HybridInteger(-n) : n;
+}
+
+inline HybridRational abs(const HybridRational& n) {
+	return isNegative(n) ? HybridRational(-n) : n;
+}
+
+inline HybridInteger floor(const HybridRational& n) {
+	if (n.isSmall()) {
+		sint q = n.smallNum() / n.smallDen();
+		if (n.smallNum() % n.smallDen() < 0) --q;
+		return HybridInteger(q);
+	}
+	return HybridInteger(carl::floor(n.big()));
+}
+
+inline HybridInteger floor(const HybridInteger& n) {
+	return n;
+}
+
+inline HybridInteger ceil(const HybridRational& n) {
+	if (n.isSmall()) {
+		sint q = n.smallNum() / n.smallDen();
+		if (n.smallNum() % n.smallDen() > 0) ++q;
+		return HybridInteger(q);
+	}
+	return HybridInteger(carl::ceil(n.big()));
+}
+
+inline HybridInteger ceil(const HybridInteger& n) {
+	return n;
+}
+
+inline HybridInteger round(const HybridRational& n) {
+	if (n.isSmall()) {
+		// Rounds half up, as round(const mpq_class&).
+		sint q = n.smallNum() / n.smallDen();
+		sint r = n.smallNum() % n.smallDen();
+		if (r < 0) {
+			--q;
+			r += n.smallDen();
+		}
+		if (r >= n.smallDen() - r) ++q;
+		return HybridInteger(q);
+	}
+	return HybridInteger(carl::round(n.big()));
+}
+
+inline HybridInteger round(const HybridInteger& n) {
+	return n;
+}
+
+inline HybridInteger gcd(const HybridInteger& a, const HybridInteger& b) {
+	if (a.isSmall() && b.isSmall()) return HybridInteger(std::gcd(a.small(), b.small()));
+	return HybridInteger(carl::gcd(a.toMpz(), b.toMpz()));
+}
+
+inline HybridInteger lcm(const HybridInteger& a, const HybridInteger& b) {
+	if (isZero(a) || isZero(b)) return HybridInteger(0);
+	if (a.isSmall() && b.isSmall()) {
+		sint g = std::gcd(a.small(), b.small());
+		sint res;
+		if (!__builtin_mul_overflow(std::llabs(a.small()) / g, std::llabs(b.small()), &res)) return HybridInteger(res);
+	}
+	return HybridInteger(carl::lcm(a.toMpz(), b.toMpz()));
+}
+
+/**
+ * Calculate the greatest common divisor of two fractions.
+ * As for mpq_class, this is the gcd of the numerators divided by the lcm of the denominators.
+ */
+inline HybridRational gcd(const HybridRational& a, const HybridRational& b) {
+	return HybridRational(gcd(a.num(), b.num()), lcm(a.den(), b.den()));
+}
+
+/**
+ * Calculate the least common multiple of two fractions.
+ * As for mpq_class, this is the lcm of the numerators divided by the gcd of the denominators.
+ */
+inline HybridRational lcm(const HybridRational& a, const HybridRational& b) {
+	return HybridRational(lcm(a.num(), b.num()), gcd(a.den(), b.den()));
+}
+
+/**
+ * Calculate the greatest common divisor of two integers.
+ * Stores the result in the first argument.
+ * @param a First argument.
+ * @param b Second argument.
+ * @return Updated a.
+ */
+inline HybridInteger& gcd_assign(HybridInteger& a, const HybridInteger& b) {
+	a = carl::gcd(a, b);
+	return a;
+}
+
+/**
+ * Calculate the greatest common divisor of two fractions.
+ * Stores the result in the first argument.
+ * @param a First argument.
+ * @param b Second argument.
+ * @return Updated a.
+ */
+inline HybridRational& gcd_assign(HybridRational& a, const HybridRational& b) {
+	a = carl::gcd(a, b);
+	return a;
+}
+
+inline HybridRational log(const HybridRational& n) {
+	return carl::rationalize<HybridRational>(std::log(toDouble(n)));
+}
+inline HybridRational log10(const HybridRational& n) {
+	return carl::rationalize<HybridRational>(std::log10(toDouble(n)));
+}
+
+inline HybridRational sin(const HybridRational& n) {
+	return carl::rationalize<HybridRational>(std::sin(toDouble(n)));
+}
+
+inline HybridRational cos(const HybridRational& n) {
+	return carl::rationalize<HybridRational>(std::cos(toDouble(n)));
+}
+
+/**
+ * Calculate the square root of a fraction if possible.
+ *
+ * @param a The fraction to calculate the square root for.
+ * @param b A reference to the rational, in which the result is stored.
+ * @return true, if the number to calculate the square root for is a square;
+ *         false, otherwise.
+ */
+inline bool sqrt_exact(const HybridRational& a, HybridRational& b) {
+	mpq_class res;
+	if (!carl::sqrt_exact(a.toMpq(), res)) return false;
+	b = std::move(res);
+	return true;
+}
+
+inline HybridRational sqrt(const HybridRational& a) {
+	return HybridRational(carl::sqrt(a.toMpq()));
+}
+
+inline std::pair<HybridRational,HybridRational> sqrt_safe(const HybridRational& a) {
+	auto res = carl::sqrt_safe(a.toMpq());
+	return std::make_pair(HybridRational(res.first), HybridRational(res.second));
+}
+
+/**
+ * Calculate the nth root of a fraction.
+ * The precise result is contained in the resulting interval.
+ */
+inline std::pair<HybridRational,HybridRational> root_safe(const HybridRational& a, uint n) {
+	auto res = carl::root_safe(a.toMpq(), n);
+	return std::make_pair(HybridRational(res.first), HybridRational(res.second));
+}
+
+inline std::pair<HybridRational,HybridRational> sqrt_fast(const HybridRational& a) {
+	auto res = carl::sqrt_fast(a.toMpq());
+	return std::make_pair(HybridRational(res.first), HybridRational(res.second));
+}
+
+inline HybridInteger mod(const HybridInteger& n, const HybridInteger& m) {
+	return n % m;
+}
+
+inline HybridInteger remainder(const HybridInteger& n, const HybridInteger& m) {
+	return mod(n, m);
+}
+
+inline HybridInteger quotient(const HybridInteger& n, const HybridInteger& d) {
+	return n / d;
+}
+
+inline HybridRational quotient(const HybridRational& n, const HybridRational& d) {
+	return n / d;
+}
+
+inline void divide(const HybridInteger& dividend, const HybridInteger& divisor, HybridInteger& quotient, HybridInteger& remainder) {
+	if (dividend.isSmall() && divisor.isSmall()) {
+		// Floor division, as mpz_divmod.
+		sint q = dividend.small() / divisor.small();
+		sint r = dividend.small() % divisor.small();
+		if (r != 0 && ((r < 0) != (divisor.small() < 0))) {
+			--q;
+			r += divisor.small();
+		}
+		quotient = q;
+		remainder = r;
+		return;
+	}
+	mpz_class q;
+	mpz_class r;
+	carl::divide(dividend.toMpz(), divisor.toMpz(), q, r);
+	quotient = std::move(q);
+	remainder = std::move(r);
+}
+
+/**
+ * Divide two fractions.
+ * @param a First argument.
+ * @param b Second argument.
+ * @return \f$ a / b \f$.
+ */
+inline HybridRational div(const HybridRational& a, const HybridRational& b) {
+	return a / b;
+}
+
+/**
+ * Divide two integers.
+ * Asserts that the remainder is zero.
+ * @param a First argument.
+ * @param b Second argument.
+ * @return \f$ a / b \f$.
+ */
+inline HybridInteger div(const HybridInteger& a, const HybridInteger& b) {
+	assert(isZero(carl::mod(a, b)));
+	return a / b;
+}
+
+/**
+ * Divide two integers.
+ * Asserts that the remainder is zero.
+ * Stores the result in the first argument.
+ * @param a First argument.
+ * @param b Second argument.
+ * @return Updated a.
+ */
+inline HybridInteger& div_assign(HybridInteger& a, const HybridInteger& b) {
+	return a /= b;
+}
+
+/**
+ * Divide two fractions.
+ * Stores the result in the first argument.
+ * @param a First argument.
+ * @param b Second argument.
+ * @return Updated a.
+ */
+inline HybridRational& div_assign(HybridRational& a, const HybridRational& b) {
+	return a /= b;
+}
+
+inline HybridRational reciprocal(const HybridRational& a) {
+	return HybridRational(a.den(), a.num());
+}
+
+template<>
+inline HybridInteger pow(const HybridInteger& basis, std::size_t exp) {
+	HybridInteger res(1);
+	HybridInteger mult = basis;
+	for (std::size_t e = exp; e > 0; e /= 2) {
+		if (e & static_cast<std::size_t>(1)) {
+			res *= mult;
+		}
+		if (e > 1) mult *= mult;
+	}
+	return res;
+}
+
+template<>
+inline HybridRational pow(const HybridRational& basis, std::size_t exp) {
+	// Numerator and denominator stay coprime, hence no cancellation is needed.
+	HybridInteger num = pow(basis.num(), exp);
+	HybridInteger den = pow(basis.den(), exp);
+	if (num.isSmall() && den.isSmall()) return HybridRational(num, den);
+	return HybridRational(mpq_class(num.toMpz(), den.toMpz()));
+}
+
+inline std::string toString(const HybridRational& _number, bool _infix=true) {
+	return toString(_number.toMpq(), _infix);
+}
+
+inline std::string toString(const HybridInteger& _number, bool _infix=true) {
+	return toString(_number.toMpz(), _infix);
+}
+
+}
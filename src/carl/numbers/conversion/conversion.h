@@ -11,5 +11,6 @@ namespace carl {
 }
 
 #include "cln_gmp.h"
+#include "hybrid_gmp.h"
 #include "generic.h"
 #include "native.h"
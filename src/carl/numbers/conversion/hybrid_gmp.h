@@ -0,0 +1,46 @@
+#pragma once
+
+namespace carl {
+
+	template<>
+	inline HybridRational convert<HybridInteger, HybridRational>(const HybridInteger& n) {
+		return HybridRational(n);
+	}
+
+	template<>
+	inline HybridInteger convert<HybridRational, HybridInteger>(const HybridRational& n) {
+		assert(carl::isInteger(n));
+		return carl::getNum(n);
+	}
+
+	template<>
+	inline mpz_class convert<HybridInteger, mpz_class>(const HybridInteger& n) {
+		return n.toMpz();
+	}
+
+	template<>
+	inline HybridInteger convert<mpz_class, HybridInteger>(const mpz_class& n) {
+		return HybridInteger(n);
+	}
+
+	template<>
+	inline mpq_class convert<HybridRational, mpq_class>(const HybridRational& n) {
+		return n.toMpq();
+	}
+
+	template<>
+	inline HybridRational convert<mpq_class, HybridRational>(const mpq_class& n) {
+		return HybridRational(n);
+	}
+
+	template<>
+	inline double convert<HybridRational, double>(const HybridRational& n) {
+		return carl::toDouble(n);
+	}
+
+	template<>
+	inline HybridRational convert<double, HybridRational>(const double& n) {
+		return carl::rationalize<HybridRational>(n);
+	}
+
+}
@@ -33,6 +33,10 @@ namespace carl {
 #include "adaption_gmpxx/operations.h"
 #include "adaption_gmpxx/typetraits.h"
 
+#include "adaption_hybrid/hash.h"
+#include "adaption_hybrid/operations.h"
+#include "adaption_hybrid/typetraits.h"
+
 
 #ifdef USE_CLN_NUMBERS
 #include "adaption_cln/include.h"
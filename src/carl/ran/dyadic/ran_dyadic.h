@@ -0,0 +1,645 @@
+#pragma once
+
+/**
+ * @file ran_dyadic.h
+ * This file contains real_algebraic_number_dyadic, a representation of real algebraic numbers by an isolating interval whose bounds are dyadic numbers m/2^k.
+ * The defining polynomial is kept primitive over the integers.
+ * Refinement by bisection thus only ever increases the exponent by one, and signs are evaluated using integer arithmetic only.
+ */
+
+#include <carl/core/UnivariatePolynomial.h>
+#include <carl/core/polynomialfunctions/Derivative.h>
+#include <carl/core/polynomialfunctions/GCD.h>
+#include <carl/core/polynomialfunctions/Representation.h>
+#include <carl/core/polynomialfunctions/RootCounting.h>
+#include <carl/core/polynomialfunctions/SquareFreePart.h>
+#include <carl/core/polynomialfunctions/to_univariate_polynomial.h>
+
+#include <carl/interval/Interval.h>
+#include <carl/interval/sampling.h>
+
+#include "../ran_common.h"
+#include "../ran_operations.h"
+#include "../ran_operations_number.h"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace carl {
+
+namespace ran::dyadic {
+	/// Computes n * 2^k.
+	inline mpz_class mul_2exp(const mpz_class& n, std::size_t k) {
+		return n << static_cast<mp_bitcnt_t>(k);
+	}
+#ifdef USE_CLN_NUMBERS
+	inline cln::cl_I mul_2exp(const cln::cl_I& n, std::size_t k) {
+		return cln::ash(n, static_cast<cln::sintC>(k));
+	}
+#endif
+	/// Computes floor(n / 2^k).
+	inline mpz_class floor_div_2exp(const mpz_class& n, std::size_t k) {
+		mpz_class res;
+		mpz_fdiv_q_2exp(res.get_mpz_t(), n.get_mpz_t(), static_cast<mp_bitcnt_t>(k));
+		return res;
+	}
+#ifdef USE_CLN_NUMBERS
+	inline cln::cl_I floor_div_2exp(const cln::cl_I& n, std::size_t k) {
+		return cln::ash(n, -static_cast<cln::sintC>(k));
+	}
+#endif
+
+	/// Returns k if the rational n has the denominator 2^k.
+	template<typename Number>
+	std::optional<std::size_t> dyadic_exponent(const Number& n) {
+		using Integer = typename IntegralType<Number>::type;
+		const Integer& den = carl::getDenom(n);
+		std::size_t k = carl::bitsize(den) - 1;
+		if (mul_2exp(Integer(1), k) == den) return k;
+		return std::nullopt;
+	}
+
+	/// Computes m / 2^k.
+	template<typename Number, typename Integer>
+	Number to_rational(const Integer& m, std::size_t k) {
+		return Number(m) / Number(mul_2exp(Integer(1), k));
+	}
+
+	/// Compares a / 2^i and b / 2^j.
+	template<typename Integer>
+	Sign compare(const Integer& a, std::size_t i, const Integer& b, std::size_t j) {
+		if (i < j) return carl::sgn(Integer(mul_2exp(a, j - i) - b));
+		return carl::sgn(Integer(a - mul_2exp(b, i - j)));
+	}
+
+	/// Compares m / 2^k and the rational r.
+	template<typename Integer, typename Number>
+	Sign compare(const Integer& m, std::size_t k, const Number& r) {
+		return carl::sgn(Integer(m * carl::getDenom(r) - mul_2exp(Integer(carl::getNum(r)), k)));
+	}
+
+	/**
+	 * Computes the sign of p(m / 2^k) for an integer polynomial p, given by its coefficients.
+	 * Uses Horner's scheme on 2^(kn) * p(m / 2^k), hence only integer arithmetic is needed.
+	 */
+	template<typename Integer>
+	Sign sign_at(const std::vector<Integer>& coeffs, const Integer& m, std::size_t k) {
+		assert(!coeffs.empty());
+		std::size_t n = coeffs.size() - 1;
+		Integer res = coeffs[n];
+		for (std::size_t i = n; i > 0; --i) {
+			res = res * m + mul_2exp(coeffs[i - 1], k * (n - i + 1));
+		}
+		return carl::sgn(res);
+	}
+
+	/**
+	 * Computes the sign of an integer polynomial p on the closed interval [lower / 2^k, upper / 2^k], if it is the same on the whole interval.
+	 * Uses Horner's scheme with interval arithmetic on 2^(kn) * p(x), hence only integer arithmetic is needed.
+	 * @return The sign, or std::nullopt if the enclosure of the values contains zero.
+	 */
+	template<typename Integer>
+	std::optional<Sign> sign_on(const std::vector<Integer>& coeffs, const Integer& lower, const Integer& upper, std::size_t k) {
+		assert(!coeffs.empty());
+		std::size_t n = coeffs.size() - 1;
+		Integer lo = coeffs[n];
+		Integer hi = coeffs[n];
+		for (std::size_t i = n; i > 0; --i) {
+			Integer a = lo * lower;
+			Integer b = lo * upper;
+			Integer c = hi * lower;
+			Integer d = hi * upper;
+			Integer shift = mul_2exp(coeffs[i - 1], k * (n - i + 1));
+			lo = std::min({a, b, c, d}) + shift;
+			hi = std::max({a, b, c, d}) + shift;
+		}
+		if (lo > 0) return Sign::POSITIVE;
+		if (hi < 0) return Sign::NEGATIVE;
+		return std::nullopt;
+	}
+
+	/**
+	 * Computes the sign of p(r) for an integer polynomial p and a rational r.
+	 * Uses Horner's scheme on denom(r)^n * p(r).
+	 */
+	template<typename Integer, typename Number>
+	Sign sign_at(const std::vector<Integer>& coeffs, const Number& r) {
+		assert(!coeffs.empty());
+		const Integer& num = carl::getNum(r);
+		const Integer& den = carl::getDenom(r);
+		std::size_t n = coeffs.size() - 1;
+		Integer res = coeffs[n];
+		Integer scale = 1;
+		for (std::size_t i = n; i > 0; --i) {
+			scale *= den;
+			res = res * num + coeffs[i - 1] * scale;
+		}
+		return carl::sgn(res);
+	}
+}
+
+/**
+ * Represents a real algebraic number by a square-free integer polynomial and an open isolating interval with dyadic bounds.
+ * Numbers that turn out to be rational are stored explicitly.
+ *
+ * The isolating interval never contains an integer, thus floor and ceil are read off the bounds.
+ * As for real_algebraic_number_interval, all copies of a number share their content, hence refining one copy refines all of them.
+ */
+template<typename Number>
+class real_algebraic_number_dyadic {
+	using Integer = typename IntegralType<Number>::type;
+	using Polynomial = UnivariatePolynomial<Number>;
+	static const Variable auxVariable;
+
+	template<typename Num>
+	friend bool compare(const real_algebraic_number_dyadic<Num>&, const real_algebraic_number_dyadic<Num>&, const Relation);
+
+	template<typename Num>
+	friend bool compare(const real_algebraic_number_dyadic<Num>&, const Num&, const Relation);
+
+	template<typename Num>
+	friend Num sample_between(const real_algebraic_number_dyadic<Num>& lower, const Num& upper);
+
+	template<typename Num>
+	friend Num sample_between(const Num& lower, const real_algebraic_number_dyadic<Num>& upper);
+
+private:
+	struct content {
+		/// Coefficients of the defining polynomial, primitive with positive leading coefficient. Empty if the number is numeric.
+		std::vector<Integer> coefficients;
+		/// The isolating interval is (lower / 2^exponent, upper / 2^exponent).
+		Integer lower;
+		Integer upper;
+		std::size_t exponent = 0;
+		/// Sign of the polynomial at the lower bound.
+		Sign lower_sign = Sign::ZERO;
+		/// The value, if the number is numeric.
+		std::optional<Number> value;
+
+		explicit content(const Number& n): value(n) {}
+		content(std::vector<Integer>&& c): coefficients(std::move(c)) {}
+
+		void set_value(const Number& n) {
+			value = n;
+			coefficients.clear();
+		}
+		/// Brings the bounds to the exponent k, which must not be smaller than the current one.
+		void scale_to(std::size_t k) {
+			assert(k >= exponent);
+			lower = ran::dyadic::mul_2exp(lower, k - exponent);
+			upper = ran::dyadic::mul_2exp(upper, k - exponent);
+			exponent = k;
+		}
+	};
+
+	mutable std::shared_ptr<content> m_content;
+
+	static std::vector<Integer> primitive_coefficients(const Polynomial& p) {
+		auto ip = p.coprimeCoefficients();
+		std::vector<Integer> res(ip.coefficients().begin(), ip.coefficients().end());
+		if (res.back() < 0) {
+			for (auto& c: res) c = -c;
+		}
+		return res;
+	}
+
+	Number lower_int() const {
+		return ran::dyadic::to_rational<Number>(m_content->lower, m_content->exponent);
+	}
+	Number upper_int() const {
+		return ran::dyadic::to_rational<Number>(m_content->upper, m_content->exponent);
+	}
+
+	/**
+	 * Replaces the rational bounds of an isolating interval by dyadic bounds, by bisecting at dyadic points close to the rational bounds.
+	 * If a dyadic root is hit, the number becomes numeric.
+	 */
+	void set_interval(const Interval<Number>& i) const {
+		assert(i.lowerBoundType() == BoundType::STRICT && i.upperBoundType() == BoundType::STRICT);
+		Number lower = i.lower();
+		Number upper = i.upper();
+		m_content->lower_sign = ran::dyadic::sign_at(m_content->coefficients, lower);
+		assert(m_content->lower_sign != Sign::ZERO);
+		auto lk = ran::dyadic::dyadic_exponent(lower);
+		auto uk = ran::dyadic::dyadic_exponent(upper);
+		while (!lk || !uk) {
+			// choose k such that 2^-k is at most half of the interval width
+			std::size_t k = carl::bitsize(Integer(carl::ceil(Number(2) / (upper - lower))));
+			Integer scale = ran::dyadic::mul_2exp(Integer(1), k);
+			Integer m = lk ? Integer(carl::ceil(upper * Number(scale)) - 1) : Integer(carl::floor(lower * Number(scale)) + 1);
+			Number pivot = ran::dyadic::to_rational<Number>(m, k);
+			assert(lower < pivot && pivot < upper);
+			Sign s = ran::dyadic::sign_at(m_content->coefficients, m, k);
+			if (s == Sign::ZERO) {
+				m_content->set_value(pivot);
+				return;
+			} else if (s == m_content->lower_sign) {
+				lower = pivot;
+				lk = k;
+			} else {
+				upper = pivot;
+				uk = k;
+			}
+		}
+		std::size_t k = std::max(*lk, *uk);
+		m_content->lower = ran::dyadic::mul_2exp(Integer(carl::getNum(lower)), k - *lk);
+		m_content->upper = ran::dyadic::mul_2exp(Integer(carl::getNum(upper)), k - *uk);
+		m_content->exponent = k;
+	}
+
+	/**
+	 * Refines the interval using the dyadic pivot m / 2^k, if it lies within the interval.
+	 * Returns the sign of "number - pivot" or std::nullopt if the pivot is not within the interval.
+	 */
+	std::optional<Sign> refine_using(const Integer& m, std::size_t k) const {
+		if (is_numeric()) return std::nullopt;
+		auto& c = *m_content;
+		if (ran::dyadic::compare(m, k, c.lower, c.exponent) != Sign::POSITIVE) return std::nullopt;
+		if (ran::dyadic::compare(m, k, c.upper, c.exponent) != Sign::NEGATIVE) return std::nullopt;
+		Sign s = ran::dyadic::sign_at(c.coefficients, m, k);
+		if (s == Sign::ZERO) {
+			c.set_value(ran::dyadic::to_rational<Number>(m, k));
+			return Sign::ZERO;
+		}
+		Integer pivot = m;
+		if (k > c.exponent) {
+			c.scale_to(k);
+		} else {
+			pivot = ran::dyadic::mul_2exp(m, c.exponent - k);
+		}
+		if (s == c.lower_sign) {
+			c.lower = pivot;
+			return Sign::POSITIVE;
+		} else {
+			c.upper = pivot;
+			return Sign::NEGATIVE;
+		}
+	}
+
+	/// Refines until the interval does not contain any integer.
+	void refine_to_integrality() const {
+		while (!is_numeric()) {
+			const auto& c = *m_content;
+			Integer below = ran::dyadic::floor_div_2exp(c.lower, c.exponent) + 1;
+			if (ran::dyadic::compare(below, 0, c.upper, c.exponent) != Sign::NEGATIVE) break;
+			refine_using(below, 0);
+		}
+	}
+
+	/// Returns the sign of the polynomial at the rational r, relative to the sign at the lower bound.
+	Sign compare_internal(const Number& r) const {
+		assert(!is_numeric());
+		const auto& c = *m_content;
+		if (ran::dyadic::compare(c.lower, c.exponent, r) != Sign::NEGATIVE) return Sign::POSITIVE;
+		if (ran::dyadic::compare(c.upper, c.exponent, r) != Sign::POSITIVE) return Sign::NEGATIVE;
+		Sign s = ran::dyadic::sign_at(m_content->coefficients, r);
+		if (s == Sign::ZERO) {
+			m_content->set_value(r);
+			return Sign::ZERO;
+		}
+		Sign res = (s == m_content->lower_sign) ? Sign::POSITIVE : Sign::NEGATIVE;
+		// r is not dyadic in general, hence we bisect until the interval excludes r to answer repeated queries from the bounds.
+		// The bounds are compared to r directly, thus no rational is constructed while bisecting.
+		while (!is_numeric()
+			&& ran::dyadic::compare(c.lower, c.exponent, r) == Sign::NEGATIVE
+			&& ran::dyadic::compare(c.upper, c.exponent, r) == Sign::POSITIVE) {
+			refine();
+		}
+		return res;
+	}
+
+	/// Number of bisections sgn(const Polynomial&) performs before it resorts to Sturm sequences.
+	static constexpr std::size_t sign_bisections = 8;
+
+	void set_polynomial(const Polynomial& p) const {
+		assert(!is_numeric());
+		m_content->coefficients = primitive_coefficients(p);
+		m_content->lower_sign = ran::dyadic::sign_at(m_content->coefficients, m_content->lower, m_content->exponent);
+	}
+
+public:
+	/// Bisects the isolating interval.
+	void refine() const {
+		if (is_numeric()) return;
+		refine_using(m_content->lower + m_content->upper, m_content->exponent + 1);
+	}
+
+	real_algebraic_number_dyadic()
+		: m_content(std::make_shared<content>(Number(0))) {}
+
+	real_algebraic_number_dyadic(const Number& n)
+		: m_content(std::make_shared<content>(n)) {}
+
+	real_algebraic_number_dyadic(const Polynomial& p, const Interval<Number>& i)
+		: m_content(std::make_shared<content>(primitive_coefficients(p))) {
+		CARL_LOG_DEBUG("carl.ran.dyadic", "Creating (" << p << "," << i << ")");
+		assert(!carl::isZero(p) && p.degree() > 0);
+		assert(i.isOpenInterval() || i.isPointInterval());
+		if (i.isPointInterval()) {
+			m_content->set_value(i.lower());
+		} else if (p.degree() == 1) {
+			m_content->set_value(Number(-p.coefficients()[0] / p.coefficients()[1]));
+		} else {
+			set_interval(i);
+			if (!is_numeric()) refine_using(Integer(0), 0);
+			refine_to_integrality();
+		}
+	}
+
+	real_algebraic_number_dyadic(const real_algebraic_number_dyadic& ran) = default;
+	real_algebraic_number_dyadic(real_algebraic_number_dyadic&& ran) = default;
+
+	real_algebraic_number_dyadic& operator=(const real_algebraic_number_dyadic& n) = default;
+	real_algebraic_number_dyadic& operator=(real_algebraic_number_dyadic&& n) = default;
+
+	static real_algebraic_number_dyadic<Number> create_safe(const Polynomial& p, const Interval<Number>& i) {
+		return real_algebraic_number_dyadic<Number>(carl::squareFreePart(p), i);
+	}
+
+	bool is_zero() const {
+		return is_numeric() && carl::isZero(value());
+	}
+	bool is_integral() const {
+		return is_numeric() && carl::isInteger(value());
+	}
+	Number integer_below() const {
+		if (is_numeric()) return carl::floor(value());
+		return Number(ran::dyadic::floor_div_2exp(m_content->lower, m_content->exponent));
+	}
+	bool is_numeric() const {
+		return m_content->value.has_value();
+	}
+
+	Polynomial polynomial() const {
+		assert(!is_numeric());
+		std::vector<Number> coeffs(m_content->coefficients.begin(), m_content->coefficients.end());
+		return Polynomial(auxVariable, std::move(coeffs));
+	}
+	Interval<Number> interval() const {
+		assert(!is_numeric());
+		return Interval<Number>(lower_int(), BoundType::STRICT, upper_int(), BoundType::STRICT);
+	}
+	/// Returns the bounds of the isolating interval as numerators and their common exponent.
+	std::tuple<const Integer&, const Integer&, std::size_t> dyadic_interval() const {
+		assert(!is_numeric());
+		return { m_content->lower, m_content->upper, m_content->exponent };
+	}
+
+	const Number& value() const {
+		assert(is_numeric());
+		return *m_content->value;
+	}
+
+	real_algebraic_number_dyadic<Number> abs() const {
+		if (sgn() != Sign::NEGATIVE) return *this;
+		if (is_numeric()) return real_algebraic_number_dyadic<Number>(carl::abs(value()));
+		real_algebraic_number_dyadic<Number> res(*this);
+		auto c = std::make_shared<content>(*m_content);
+		for (std::size_t i = 1; i < c->coefficients.size(); i += 2) {
+			c->coefficients[i] = -c->coefficients[i];
+		}
+		if (c->coefficients.back() < 0) {
+			for (auto& coeff: c->coefficients) coeff = -coeff;
+		}
+		std::swap(c->lower, c->upper);
+		c->lower = -c->lower;
+		c->upper = -c->upper;
+		c->lower_sign = ran::dyadic::sign_at(c->coefficients, c->lower, c->exponent);
+		res.m_content = c;
+		return res;
+	}
+
+	std::size_t size() const {
+		if (is_numeric()) return carl::bitsize(value());
+		return carl::bitsize(m_content->lower) + carl::bitsize(m_content->upper) + m_content->exponent + m_content->coefficients.size() - 1;
+	}
+
+	Sign sgn() const {
+		if (is_numeric()) return carl::sgn(value());
+		// the interval does not contain zero
+		return (m_content->lower >= 0) ? Sign::POSITIVE : Sign::NEGATIVE;
+	}
+
+	/**
+	 * Returns the sign of p at this number.
+	 * The sign is usually read off an interval evaluation of p on the isolating interval, which is bisected a few times if necessary.
+	 * Only if this fails, for example because p vanishes at this number, it is computed exactly using Sturm sequences.
+	 */
+	Sign sgn(const Polynomial& p) const {
+		if (is_numeric()) return carl::sgn(carl::evaluate(p, value()));
+		if (carl::isZero(p)) return Sign::ZERO;
+		auto ip = p.coprimeCoefficientsSignPreserving();
+		std::vector<Integer> coeffs(ip.coefficients().begin(), ip.coefficients().end());
+		for (std::size_t i = 0; !is_numeric(); ++i) {
+			auto s = ran::dyadic::sign_on(coeffs, m_content->lower, m_content->upper, m_content->exponent);
+			if (s) return *s;
+			if (i == sign_bisections) break;
+			refine();
+		}
+		if (is_numeric()) return carl::sgn(carl::evaluate(p, value()));
+		Polynomial poly = polynomial();
+		Polynomial tmp = carl::replace_main_variable(p, auxVariable);
+		if (poly == tmp) return Sign::ZERO;
+		auto seq = carl::sturm_sequence(poly, carl::derivative(poly) * tmp);
+		int variations = carl::count_real_roots(seq, interval());
+		assert((variations == -1) || (variations == 0) || (variations == 1));
+		switch (variations) {
+		case -1:
+			return Sign::NEGATIVE;
+		case 1:
+			return Sign::POSITIVE;
+		default:
+			return Sign::ZERO;
+		}
+	}
+
+	/**
+	 * Narrows the isolating interval using another isolating interval of this number, for example one obtained by refining a copy in another representation.
+	 * Rational bounds are replaced by dyadic bounds within i. The interval is only replaced if i is smaller.
+	 */
+	void refine_to(const Interval<Number>& i) const {
+		if (is_numeric()) return;
+		if (i.isPointInterval()) {
+			m_content->set_value(i.lower());
+			return;
+		}
+		assert(i.isOpenInterval());
+		if (i.diameter() >= interval().diameter()) return;
+		set_interval(i);
+		refine_to_integrality();
+	}
+
+	bool contained_in(const Interval<Number>& i) const {
+		if (i.lowerBoundType() != BoundType::INFTY) {
+			Sign s = is_numeric() ? carl::sgn(value() - i.lower()) : compare_internal(i.lower());
+			if (s == Sign::NEGATIVE) return false;
+			if (s == Sign::ZERO && i.lowerBoundType() == BoundType::STRICT) return false;
+		}
+		if (i.upperBoundType() != BoundType::INFTY) {
+			Sign s = is_numeric() ? carl::sgn(value() - i.upper()) : compare_internal(i.upper());
+			if (s == Sign::POSITIVE) return false;
+			if (s == Sign::ZERO && i.upperBoundType() == BoundType::STRICT) return false;
+		}
+		return true;
+	}
+};
+
+template<typename Number>
+Number branching_point(const real_algebraic_number_dyadic<Number>& n) {
+	if (n.is_numeric()) return n.value();
+	return carl::sample(n.interval());
+}
+
+template<typename Number>
+Number sample_above(const real_algebraic_number_dyadic<Number>& n) {
+	if (n.is_numeric()) return carl::floor(n.value()) + 1;
+	return carl::floor(n.interval().upper()) + 1;
+}
+template<typename Number>
+Number sample_below(const real_algebraic_number_dyadic<Number>& n) {
+	if (n.is_numeric()) return carl::ceil(n.value()) - 1;
+	return carl::ceil(n.interval().lower()) - 1;
+}
+template<typename Number>
+Number sample_between(const real_algebraic_number_dyadic<Number>& lower, const real_algebraic_number_dyadic<Number>& upper) {
+	// comparing refines the intervals until they are disjoint
+	[[maybe_unused]] bool less = lower < upper;
+	assert(less);
+	if (lower.is_numeric()) {
+		return sample_between(lower.value(), upper);
+	} else if (upper.is_numeric()) {
+		return sample_between(lower, upper.value());
+	} else {
+		return sample(Interval<Number>(lower.interval().upper(), upper.interval().lower()), true);
+	}
+}
+template<typename Number>
+Number sample_between(const real_algebraic_number_dyadic<Number>& lower, const Number& upper) {
+	assert(lower < upper);
+	while (!lower.is_numeric() && ran::dyadic::compare(lower.m_content->upper, lower.m_content->exponent, upper) != Sign::NEGATIVE) {
+		lower.refine();
+	}
+	if (lower.is_numeric()) {
+		return sample_between(lower.value(), upper);
+	} else {
+		return sample(Interval<Number>(lower.upper_int(), BoundType::WEAK, upper, BoundType::STRICT), false);
+	}
+}
+template<typename Number>
+Number sample_between(const Number& lower, const real_algebraic_number_dyadic<Number>& upper) {
+	assert(lower < upper);
+	while (!upper.is_numeric() && ran::dyadic::compare(upper.m_content->lower, upper.m_content->exponent, lower) != Sign::POSITIVE) {
+		upper.refine();
+	}
+	if (upper.is_numeric()) {
+		return sample_between(lower, upper.value());
+	} else {
+		return sample(Interval<Number>(lower, BoundType::STRICT, upper.lower_int(), BoundType::WEAK), false);
+	}
+}
+template<typename Number>
+Number floor(const real_algebraic_number_dyadic<Number>& n) {
+	if (n.is_numeric()) return carl::floor(n.value());
+	return carl::floor(n.interval().lower());
+}
+template<typename Number>
+Number ceil(const real_algebraic_number_dyadic<Number>& n) {
+	if (n.is_numeric()) return carl::ceil(n.value());
+	return carl::ceil(n.interval().upper());
+}
+
+template<typename Number>
+bool compare(const real_algebraic_number_dyadic<Number>& lhs, const real_algebraic_number_dyadic<Number>& rhs, const Relation relation) {
+	CARL_LOG_DEBUG("carl.ran.dyadic", "Compare " << lhs << " " << relation << " " << rhs);
+	if (lhs.m_content.get() == rhs.m_content.get()) {
+		return evaluate(Sign::ZERO, relation);
+	}
+	if (lhs.is_numeric()) {
+		return compare(rhs, lhs.value(), inverse(relation));
+	}
+	if (rhs.is_numeric()) {
+		return compare(lhs, rhs.value(), relation);
+	}
+
+	// refine both intervals using the bounds of the other, all pivots are dyadic
+	auto& l = *lhs.m_content;
+	auto& r = *rhs.m_content;
+	lhs.refine_using(r.lower, r.exponent);
+	if (!rhs.is_numeric()) lhs.refine_using(r.upper, r.exponent);
+	if (!lhs.is_numeric()) rhs.refine_using(l.lower, l.exponent);
+	if (!lhs.is_numeric() && !rhs.is_numeric()) rhs.refine_using(l.upper, l.exponent);
+	if (lhs.is_numeric() || rhs.is_numeric()) {
+		return compare(lhs, rhs, relation);
+	}
+
+	// now: intervals are either equal or disjoint
+	auto equal_intervals = [&l, &r]() {
+		return ran::dyadic::compare(l.lower, l.exponent, r.lower, r.exponent) == Sign::ZERO
+			&& ran::dyadic::compare(l.upper, l.exponent, r.upper, r.exponent) == Sign::ZERO;
+	};
+	if (equal_intervals()) {
+		if (l.coefficients == r.coefficients) {
+			return evaluate(Sign::ZERO, relation);
+		}
+		auto g = carl::gcd(lhs.polynomial(), rhs.polynomial());
+		if (g.degree() > 0) {
+			auto gc = real_algebraic_number_dyadic<Number>::primitive_coefficients(g);
+			if (ran::dyadic::sign_at(gc, l.lower, l.exponent) != ran::dyadic::sign_at(gc, l.upper, l.exponent)) {
+				CARL_LOG_TRACE("carl.ran.dyadic", "gcd(lhs,rhs) has a zero in the common interval");
+				lhs.set_polynomial(g);
+				rhs.set_polynomial(g);
+				return evaluate(Sign::ZERO, relation);
+			}
+		}
+		if (relation == Relation::EQ) return false;
+		if (relation == Relation::NEQ) return true;
+		while (equal_intervals()) {
+			lhs.refine();
+			rhs.refine();
+			if (lhs.is_numeric() || rhs.is_numeric()) {
+				return compare(lhs, rhs, relation);
+			}
+		}
+	}
+	// now: intervals are disjoint
+	if (ran::dyadic::compare(l.upper, l.exponent, r.lower, r.exponent) != Sign::POSITIVE) {
+		return evaluate(Sign::NEGATIVE, relation);
+	}
+	assert(ran::dyadic::compare(l.lower, l.exponent, r.upper, r.exponent) != Sign::NEGATIVE);
+	return evaluate(Sign::POSITIVE, relation);
+}
+
+template<typename Number>
+bool compare(const real_algebraic_number_dyadic<Number>& lhs, const Number& rhs, const Relation relation) {
+	if (lhs.is_numeric()) {
+		return evaluate(lhs.value(), relation, rhs);
+	}
+	return evaluate(lhs.compare_internal(rhs), relation);
+}
+
+template<typename Num>
+std::ostream& operator<<(std::ostream& os, const real_algebraic_number_dyadic<Num>& ran) {
+	if (!ran.is_numeric()) {
+		return os << "(DR " << ran.interval() << ", " << ran.polynomial() << ")";
+	} else {
+		return os << "(NR " << ran.value() << ")";
+	}
+}
+
+template<typename Number>
+const Variable real_algebraic_number_dyadic<Number>::auxVariable = freshRealVariable("__r");
+
+template<typename Number>
+struct is_ran<real_algebraic_number_dyadic<Number>>: std::true_type {};
+}
+
+namespace std {
+template<typename Number>
+struct hash<carl::real_algebraic_number_dyadic<Number>> {
+	std::size_t operator()(const carl::real_algebraic_number_dyadic<Number>& n) const {
+		return carl::hash_all(n.integer_below());
+	}
+};
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+/**
+ * @file ran_dyadic_evaluation.h
+ * Evaluation of polynomials and constraints over dyadic real algebraic numbers.
+ * Signs of polynomials that depend on a single irrational number are computed on the dyadic representation.
+ * Otherwise, the algebraic substitution is shared with real_algebraic_number_interval: the numbers are converted, evaluated there and converted back,
+ * and the refinements of the converted numbers are written back to the dyadic numbers.
+ */
+
+#include "ran_dyadic.h"
+#include "../interval/ran_interval.h"
+#include "../interval/ran_interval_evaluation.h"
+
+namespace carl {
+
+namespace ran::dyadic {
+	/// Converts a dyadic real algebraic number to the interval representation.
+	template<typename Number>
+	real_algebraic_number_interval<Number> to_interval(const real_algebraic_number_dyadic<Number>& n) {
+		if (n.is_numeric()) return real_algebraic_number_interval<Number>(n.value());
+		return real_algebraic_number_interval<Number>(n.polynomial(), n.interval());
+	}
+
+	/// Converts a real algebraic number in the interval representation to the dyadic representation.
+	template<typename Number>
+	real_algebraic_number_dyadic<Number> from_interval(const real_algebraic_number_interval<Number>& n) {
+		if (n.is_numeric()) return real_algebraic_number_dyadic<Number>(n.value());
+		return real_algebraic_number_dyadic<Number>(n.polynomial(), n.interval());
+	}
+
+	template<typename Number>
+	ran_assignment_t<real_algebraic_number_interval<Number>> to_interval(const ran_assignment_t<real_algebraic_number_dyadic<Number>>& m) {
+		ran_assignment_t<real_algebraic_number_interval<Number>> res;
+		for (const auto& [var, value]: m) {
+			res.emplace(var, to_interval(value));
+		}
+		return res;
+	}
+
+	/// Writes the refinements of the converted numbers back to the dyadic numbers they were converted from.
+	template<typename Number>
+	void refine_from(const ran_assignment_t<real_algebraic_number_dyadic<Number>>& m, const ran_assignment_t<real_algebraic_number_interval<Number>>& converted) {
+		for (const auto& [var, value]: converted) {
+			const auto& n = m.at(var);
+			if (value.is_numeric()) n.refine_to(Interval<Number>(value.value()));
+			else n.refine_to(value.interval());
+		}
+	}
+
+	/**
+	 * Computes the sign of p on the given assignment, if p depends on at most one irrational number after substituting the numeric values.
+	 * The sign is computed by real_algebraic_number_dyadic::sgn(), which refines the number in place.
+	 * @return The sign, or std::nullopt if p depends on several irrational numbers or on unassigned variables.
+	 */
+	template<typename Number>
+	std::optional<Sign> sign_univariate(MultivariatePolynomial<Number> p, const ran_assignment_t<real_algebraic_number_dyadic<Number>>& m) {
+		std::optional<Variable> irrational;
+		for (const auto& [var, value]: m) {
+			if (!p.has(var)) continue;
+			if (value.is_numeric()) {
+				substitute_inplace(p, var, MultivariatePolynomial<Number>(value.value()));
+			} else if (irrational) {
+				return std::nullopt;
+			} else {
+				irrational = var;
+			}
+		}
+		if (p.isNumber()) return carl::sgn(p.constantPart());
+		if (!irrational || !p.isUnivariate()) return std::nullopt;
+		return m.at(*irrational).sgn(carl::to_univariate_polynomial(p));
+	}
+}
+
+/**
+ * Evaluate the given polynomial with the given values for the variables.
+ * Returns std::nullopt if some unassigned variables are still contained in p after plugging in m.
+ */
+template<typename Number>
+std::optional<real_algebraic_number_dyadic<Number>> evaluate(const MultivariatePolynomial<Number>& p, const ran::ran_assignment_t<real_algebraic_number_dyadic<Number>>& m, bool refine_model = true) {
+	CARL_LOG_DEBUG("carl.ran.dyadic", "Evaluating " << p << " on " << m);
+	auto converted = ran::dyadic::to_interval(m);
+	auto res = evaluate(p, converted, refine_model);
+	ran::dyadic::refine_from(m, converted);
+	if (!res) return std::nullopt;
+	return ran::dyadic::from_interval(*res);
+}
+
+template<typename Number, typename Poly>
+boost::tribool evaluate(const Constraint<Poly>& c, const ran::ran_assignment_t<real_algebraic_number_dyadic<Number>>& m, bool refine_model = true, bool use_root_bounds = true) {
+	CARL_LOG_DEBUG("carl.ran.dyadic", "Evaluating " << c << " on " << m);
+	if (c.lhs().isConstant()) {
+		return carl::evaluate(c.lhs().constantPart(), c.relation());
+	}
+	if (auto s = ran::dyadic::sign_univariate(MultivariatePolynomial<Number>(c.lhs()), m)) {
+		return carl::evaluate(*s, c.relation());
+	}
+	auto converted = ran::dyadic::to_interval(m);
+	auto res = evaluate(c, converted, refine_model, use_root_bounds);
+	ran::dyadic::refine_from(m, converted);
+	return res;
+}
+
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+/**
+ * @file ran_dyadic_real_roots.h
+ * Real root isolation for dyadic real algebraic numbers.
+ * The roots are isolated by the interval backend and the isolating intervals are then made dyadic.
+ * Refinements of the assigned numbers made while isolating are written back to the dyadic numbers.
+ */
+
+#include "ran_dyadic.h"
+#include "ran_dyadic_evaluation.h"
+#include "../interval/ran_interval_real_roots.h"
+
+#include "../real_roots_common.h"
+
+namespace carl::ran::dyadic {
+
+namespace detail {
+	template<typename Number>
+	real_roots_result<real_algebraic_number_dyadic<Number>> from_interval(const real_roots_result<real_algebraic_number_interval<Number>>& res) {
+		if (res.is_nullified()) {
+			return real_roots_result<real_algebraic_number_dyadic<Number>>::nullified_response();
+		} else if (res.is_non_univariate()) {
+			return real_roots_result<real_algebraic_number_dyadic<Number>>::non_univariate_response();
+		}
+		std::vector<real_algebraic_number_dyadic<Number>> roots;
+		for (const auto& r: res.roots()) {
+			roots.emplace_back(ran::dyadic::from_interval(r));
+		}
+		return real_roots_result<real_algebraic_number_dyadic<Number>>::roots_response(std::move(roots));
+	}
+}
+
+/**
+ * Find all real roots of a univariate 'polynomial' with numeric coefficients within a given 'interval'.
+ * The roots are sorted in ascending order.
+ */
+template<typename Coeff, typename Number = typename UnderlyingNumberType<Coeff>::type, EnableIf<std::is_same<Coeff, Number>> = dummy>
+real_roots_result<real_algebraic_number_dyadic<Number>> real_roots(
+		const UnivariatePolynomial<Coeff>& polynomial,
+		const Interval<Number>& interval = Interval<Number>::unboundedInterval()
+) {
+	return detail::from_interval(carl::ran::interval::real_roots(polynomial, interval));
+}
+
+/**
+ * Find all real roots of a univariate 'polynomial' with non-numeric coefficients within a given 'interval'.
+ * However, all coefficients must be types that contain numeric numbers that are retrievable by using .constantPart();
+ * The roots are sorted in ascending order.
+ */
+template<typename Coeff, typename Number = typename UnderlyingNumberType<Coeff>::type, DisableIf<std::is_same<Coeff, Number>> = dummy>
+real_roots_result<real_algebraic_number_dyadic<Number>> real_roots(
+		const UnivariatePolynomial<Coeff>& polynomial,
+		const Interval<Number>& interval = Interval<Number>::unboundedInterval()
+) {
+	return detail::from_interval(carl::ran::interval::real_roots(polynomial, interval));
+}
+
+/**
+ * Find all real roots of a polynomial 'poly' with respect to the assignment 'varToRANMap' within a given 'interval'.
+ * The roots are sorted in ascending order.
+ * Returns a real_roots_result indicating whether the roots could be isolated or the polynomial
+ * was not univariate or is nullified.
+ */
+template<typename Coeff, typename Number>
+real_roots_result<real_algebraic_number_dyadic<Number>> real_roots(
+		const UnivariatePolynomial<Coeff>& poly,
+		const ran::ran_assignment_t<real_algebraic_number_dyadic<Number>>& varToRANMap,
+		const Interval<Number>& interval = Interval<Number>::unboundedInterval()
+) {
+	auto converted = ran::dyadic::to_interval(varToRANMap);
+	auto res = detail::from_interval(carl::ran::interval::real_roots(poly, converted, interval));
+	ran::dyadic::refine_from(varToRANMap, converted);
+	return res;
+}
+
+}
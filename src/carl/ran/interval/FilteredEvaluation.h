@@ -0,0 +1,130 @@
+#pragma once
+
+/**
+ * @file FilteredEvaluation.h
+ * This file contains a filter for sign queries on real algebraic numbers.
+ * It evaluates polynomials over the isolating intervals using floating point interval arithmetic with outward rounding,
+ * starting with native doubles and, if available, continuing with mpfr floats of increasing precision.
+ * Only if the sign can not be decided this way, the caller has to fall back to exact arithmetic.
+ */
+
+#include <carl/core/MultivariatePolynomial.h>
+#include <carl/core/Relation.h>
+#include <carl/interval/Interval.h>
+#include <carl/interval/IntervalEvaluation.h>
+#include <carl/interval/evaluate.h>
+
+#include <boost/logic/tribool.hpp>
+
+#include <limits>
+#include <map>
+
+namespace carl::ran::interval {
+
+namespace detail_filtered_evaluation {
+	/// Converts the interval to a double interval that contains it.
+	template<typename Number>
+	Interval<double> to_double(const Interval<Number>& i) {
+		return Interval<double>(i.lower(), i.lowerBoundType(), i.upper(), i.upperBoundType());
+	}
+
+	/**
+	 * Evaluates p with native double interval arithmetic.
+	 * Coefficients and bounds are rounded outwards, hence the result contains the exact result.
+	 */
+	template<typename Number>
+	Interval<double> evaluate_double(const MultivariatePolynomial<Number>& p, const std::map<Variable, Interval<Number>>& map) {
+		std::map<Variable, Interval<double>> dmap;
+		for (const auto& [var, i]: map) {
+			dmap.emplace(var, to_double(i));
+		}
+		return IntervalEvaluation::evaluate(p, dmap);
+	}
+
+#ifdef USE_MPFR_FLOAT
+	/// Sets the default precision of mpfr floats, which is used for the results of interval operations, and restores it on destruction.
+	class mpfr_precision_guard {
+		precision_t mOld;
+	public:
+		explicit mpfr_precision_guard(precision_t prec): mOld(FLOAT_T<mpfr_t>::defaultPrecision()) {
+			FLOAT_T<mpfr_t>::setDefaultPrecision(prec);
+		}
+		~mpfr_precision_guard() {
+			FLOAT_T<mpfr_t>::setDefaultPrecision(mOld);
+		}
+		mpfr_precision_guard(const mpfr_precision_guard&) = delete;
+		mpfr_precision_guard& operator=(const mpfr_precision_guard&) = delete;
+	};
+
+	/// Rounds a rational to an mpfr float of the given precision in the given direction.
+	inline FLOAT_T<mpfr_t> to_mpfr(const mpq_class& n, CARL_RND rnd, precision_t prec) {
+		mpfr_t tmp;
+		mpfr_init2(tmp, prec);
+		mpfr_set_q(tmp, n.get_mpq_t(), convRnd<mpfr_ptr>()(rnd));
+		FLOAT_T<mpfr_t> res(tmp);
+		mpfr_clear(tmp);
+		return res;
+	}
+
+	/// Converts the interval to an mpfr interval of the given precision that contains it.
+	inline Interval<FLOAT_T<mpfr_t>> to_mpfr(const Interval<mpq_class>& i, precision_t prec) {
+		return Interval<FLOAT_T<mpfr_t>>(
+			to_mpfr(i.lower(), CARL_RND::D, prec), i.lowerBoundType(),
+			to_mpfr(i.upper(), CARL_RND::U, prec), i.upperBoundType()
+		);
+	}
+
+	/**
+	 * Evaluates p with mpfr interval arithmetic of the given precision.
+	 * Coefficients and bounds are rounded outwards, hence the result contains the exact result.
+	 */
+	inline Interval<FLOAT_T<mpfr_t>> evaluate_mpfr(const MultivariatePolynomial<mpq_class>& p, const std::map<Variable, Interval<mpq_class>>& map, precision_t prec) {
+		mpfr_precision_guard guard(prec);
+		std::map<Variable, Interval<FLOAT_T<mpfr_t>>> fmap;
+		for (const auto& [var, i]: map) {
+			fmap.emplace(var, to_mpfr(i, prec));
+		}
+		Interval<FLOAT_T<mpfr_t>> res(FLOAT_T<mpfr_t>(0));
+		for (const auto& t: p) {
+			Interval<FLOAT_T<mpfr_t>> term(to_mpfr(t.coeff(), CARL_RND::D, prec), BoundType::WEAK, to_mpfr(t.coeff(), CARL_RND::U, prec), BoundType::WEAK);
+			if (t.monomial()) {
+				term *= IntervalEvaluation::evaluate(*t.monomial(), fmap);
+			}
+			res += term;
+		}
+		return res;
+	}
+#endif
+}
+
+/**
+ * Tries to decide whether p ~ 0 holds for all values from the given intervals, where ~ is the given relation.
+ * The polynomial is evaluated using interval arithmetic with native doubles first.
+ * If the result is indeterminate and mpfr is available, the evaluation is repeated with increasing precision as long as this narrows the resulting interval.
+ * @return The result or boost::indeterminate if floating point arithmetic can not decide the relation.
+ */
+template<typename Number>
+boost::tribool evaluate_filtered(const MultivariatePolynomial<Number>& p, Relation rel, const std::map<Variable, Interval<Number>>& map) {
+	auto dres = detail_filtered_evaluation::evaluate_double(p, map);
+	CARL_LOG_TRACE("carl.ran.evaluation", "Double interval evaluation of " << p << " results in " << dres);
+	boost::tribool res = carl::evaluate(dres, rel);
+	if (!indeterminate(res)) return res;
+#ifdef USE_MPFR_FLOAT
+	if constexpr (std::is_same<Number, mpq_class>::value) {
+		double width = dres.isUnbounded() ? std::numeric_limits<double>::infinity() : dres.diameter();
+		for (precision_t prec = 128; prec <= 512; prec *= 2) {
+			auto fres = detail_filtered_evaluation::evaluate_mpfr(p, map, prec);
+			CARL_LOG_TRACE("carl.ran.evaluation", "Interval evaluation of " << p << " with precision " << prec << " results in " << fres);
+			res = carl::evaluate(fres, rel);
+			if (!indeterminate(res)) return res;
+			// Stop if the rounding errors do not dominate the width of the result.
+			double fwidth = fres.isUnbounded() ? std::numeric_limits<double>::infinity() : fres.diameter().toDouble();
+			if (fwidth * 2 > width) break;
+			width = fwidth;
+		}
+	}
+#endif
+	return boost::indeterminate;
+}
+
+}
@@ -0,0 +1,252 @@
+#pragma once
+
+/**
+ * @file LiftingContext.h
+ * This file contains carl::ran::interval::LiftingContext which isolates real roots over a sample point that is built incrementally.
+ */
+
+#include "internal.h"
+#include "ran_interval_real_roots.h"
+
+#include <carl/core/polynomialfunctions/Substitution.h>
+#include <carl/core/polynomialfunctions/to_univariate_polynomial.h>
+
+#include <map>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace carl::ran::interval {
+
+/**
+ * Isolates real roots of polynomials over a sample point that is extended one variable at a time, as done in the lifting phase of a CAD.
+ *
+ * The context stores one level per assigned variable. Every level holds
+ * - the field extensions up to this variable, extended incrementally from the previous level,
+ * - the term this variable is replaced with, if the value can be expressed in the previous extension, or its minimal polynomial otherwise,
+ * - the polynomials after replacing all variables up to this level by their terms and
+ * - the results of the algebraic substitution for the current prefix.
+ * Hence, isolating the roots of the same polynomial over different sample points with a common prefix reuses all work done on that prefix.
+ *
+ * Use extend() to assign one more variable and retract() to go back to a shorter prefix.
+ *
+ * The caches of a level keep two generations: whenever a level is popped, the caches of all remaining levels start a new generation
+ * and entries that were not used since the previous pop are dropped.
+ * Thus the caches hold the polynomials of the last two sibling cells and do not grow with the number of sample points.
+ */
+template<typename Number>
+class LiftingContext {
+public:
+	using RAN = real_algebraic_number_interval<Number>;
+	using Poly = MultivariatePolynomial<Number>;
+	using UPoly = UnivariatePolynomial<Poly>;
+	using Result = real_roots_result<RAN>;
+private:
+	/**
+	 * A map that forgets entries that were not used during the last generation.
+	 * Entries of the previous generation are moved to the current one when they are used, references to entries stay valid until the next generation starts.
+	 */
+	template<typename Key, typename Value>
+	class GenerationalCache {
+		std::map<Key, Value> mCurrent;
+		std::map<Key, Value> mPrevious;
+	public:
+		const Value* find(const Key& key) {
+			auto it = mCurrent.find(key);
+			if (it != mCurrent.end()) return &it->second;
+			auto node = mPrevious.extract(key);
+			if (node.empty()) return nullptr;
+			return &mCurrent.insert(std::move(node)).position->second;
+		}
+		const Value& emplace(Key key, Value value) {
+			return mCurrent.emplace(std::move(key), std::move(value)).first->second;
+		}
+		/// Starts a new generation, dropping all entries that were not used during the last one.
+		void age() {
+			mPrevious = std::move(mCurrent);
+			mCurrent.clear();
+		}
+		std::size_t size() const {
+			return mCurrent.size() + mPrevious.size();
+		}
+	};
+
+	struct Level {
+		/// The assigned variable.
+		Variable variable;
+		/// Field extensions including this level.
+		FieldExtensions<Number, Poly> extensions;
+		/// Term to replace the variable with, if the value lies in the field extension of the previous levels.
+		std::optional<Poly> term;
+		/// Minimal polynomials of all non-trivial field extensions up to this level.
+		std::vector<UPoly> definitions;
+		/// Polynomials after replacing all variables up to this level by their terms.
+		GenerationalCache<Poly, Poly> substituted;
+		/// Results of the algebraic substitution, indexed by the substituted polynomial and its main variable.
+		GenerationalCache<std::pair<Poly, Variable>, std::optional<UnivariatePolynomial<Number>>> univariate;
+
+		Level(Variable v, const FieldExtensions<Number, Poly>& fe, const std::vector<UPoly>& defs):
+			variable(v), extensions(fe), definitions(defs)
+		{}
+	};
+
+	/// The assignment of the current prefix.
+	ran_assignment_t<RAN> mAssignment;
+	/// Field extensions of the empty prefix.
+	FieldExtensions<Number, Poly> mBaseExtensions;
+	/// One level for every assigned variable.
+	std::vector<Level> mLevels;
+
+	/// Replaces the variables of the levels up to (and including) the given one by their terms.
+	const Poly& substituted(std::size_t level, const Poly& p) {
+		auto& lvl = mLevels[level];
+		if (const Poly* cached = lvl.substituted.find(p)) return *cached;
+		Poly res = (level == 0) ? p : substituted(level - 1, p);
+		if (lvl.term && res.has(lvl.variable)) {
+			res = carl::substitute(res, lvl.variable, *lvl.term);
+		}
+		return lvl.substituted.emplace(p, std::move(res));
+	}
+
+public:
+	/// Returns the number of assigned variables.
+	std::size_t level() const {
+		return mLevels.size();
+	}
+	/// Returns the assignment of the current prefix.
+	const auto& assignment() const {
+		return mAssignment;
+	}
+	/// Returns the number of cached entries over all levels.
+	std::size_t cache_size() const {
+		std::size_t res = 0;
+		for (const auto& lvl: mLevels) res += lvl.substituted.size() + lvl.univariate.size();
+		return res;
+	}
+
+	/**
+	 * Extends the current prefix by assigning a value to another variable.
+	 * The field extension is computed from the field extension of the current prefix.
+	 */
+	void extend(Variable v, const RAN& r) {
+		assert(mAssignment.find(v) == mAssignment.end());
+		CARL_LOG_DEBUG("carl.ran.lifting", "Extending " << mAssignment << " by " << v << " -> " << r);
+		if (mLevels.empty()) {
+			mLevels.emplace_back(v, mBaseExtensions, std::vector<UPoly>());
+		} else {
+			Level next(v, mLevels.back().extensions, mLevels.back().definitions);
+			mLevels.emplace_back(std::move(next));
+		}
+		auto& lvl = mLevels.back();
+		auto res = lvl.extensions.extend(v, r);
+		if (res.first) {
+			CARL_LOG_DEBUG("carl.ran.lifting", v << " is replaced by " << res.second);
+			lvl.term = res.second;
+		} else {
+			CARL_LOG_DEBUG("carl.ran.lifting", v << " is defined by " << res.second);
+			lvl.definitions.emplace_back(carl::to_univariate_polynomial(res.second, v));
+		}
+		mAssignment.emplace(v, r);
+	}
+
+	/**
+	 * Removes the last assigned variable from the current prefix.
+	 * The caches of the shorter prefixes start a new generation, see the class documentation.
+	 */
+	void retract() {
+		assert(!mLevels.empty());
+		mAssignment.erase(mLevels.back().variable);
+		mLevels.pop_back();
+		for (auto& lvl: mLevels) {
+			lvl.substituted.age();
+			lvl.univariate.age();
+		}
+	}
+
+	/**
+	 * Removes assigned variables until only the given number of variables is assigned.
+	 */
+	void retract(std::size_t level) {
+		while (mLevels.size() > level) retract();
+	}
+
+	/**
+	 * Substitutes the current prefix into the polynomial.
+	 * The result is a univariate polynomial in the main variable of p whose roots contain the roots of p over the current prefix.
+	 * @return The univariate polynomial or std::nullopt if p contains variables that are not assigned.
+	 */
+	std::optional<UnivariatePolynomial<Number>> substitute(const UPoly& p) {
+		assert(mAssignment.find(p.mainVar()) == mAssignment.end());
+		Poly sp = mLevels.empty() ? Poly(p) : substituted(mLevels.size() - 1, Poly(p));
+		if (mLevels.empty() || mLevels.back().definitions.empty()) {
+			UPoly up = carl::to_univariate_polynomial(sp, p.mainVar());
+			if (!up.isUnivariate()) return std::nullopt;
+			return up.toNumberCoefficients();
+		}
+		auto& lvl = mLevels.back();
+		auto key = std::make_pair(sp, p.mainVar());
+		if (const auto* cached = lvl.univariate.find(key)) return *cached;
+		auto res = algebraic_substitution(carl::to_univariate_polynomial(sp, p.mainVar()), lvl.definitions);
+		lvl.univariate.emplace(std::move(key), res);
+		return res;
+	}
+
+	/**
+	 * Isolates the real roots of the polynomial over the current prefix.
+	 * This is equivalent to carl::ran::interval::real_roots(p, assignment(), interval).
+	 */
+	Result real_roots(const UPoly& p, const Interval<Number>& interval = Interval<Number>::unboundedInterval()) {
+		CARL_LOG_FUNC("carl.ran.lifting", p << " in " << p.mainVar() << ", " << mAssignment << ", " << interval);
+		assert(mAssignment.count(p.mainVar()) == 0);
+
+		if (carl::isZero(p)) {
+			CARL_LOG_TRACE("carl.ran.lifting", "poly is 0 -> nullified");
+			return Result::nullified_response();
+		}
+		if (p.isNumber()) {
+			CARL_LOG_TRACE("carl.ran.lifting", "poly is constant but not zero -> no root");
+			return Result::no_roots_response();
+		}
+		for (Variable v: carl::variables(p)) {
+			if (v == p.mainVar()) continue;
+			if (mAssignment.count(v) == 0) {
+				CARL_LOG_TRACE("carl.ran.lifting", "poly still contains unassigned variable " << v << " -> non-univariate");
+				return Result::non_univariate_response();
+			}
+		}
+
+		Poly sp = mLevels.empty() ? Poly(p) : substituted(mLevels.size() - 1, Poly(p));
+		if (carl::isZero(sp)) {
+			CARL_LOG_TRACE("carl.ran.lifting", "poly is 0 after substituting the terms -> nullified");
+			return Result::nullified_response();
+		}
+		auto evaledpoly = substitute(p);
+		if (!evaledpoly) {
+			CARL_LOG_TRACE("carl.ran.lifting", "poly still contains unassigned variable -> non-univariate");
+			return Result::non_univariate_response();
+		}
+		if (carl::isZero(*evaledpoly)) {
+			CARL_LOG_TRACE("carl.ran.lifting", "got zero polynomial -> nullified");
+			return Result::nullified_response();
+		}
+		auto res = carl::ran::interval::real_roots(*evaledpoly, interval);
+		if (mLevels.empty() || mLevels.back().definitions.empty()) {
+			return res;
+		}
+
+		Constraint<Poly> cons(sp, Relation::EQ);
+		ran_assignment_t<RAN> ass = mAssignment;
+		std::vector<RAN> roots;
+		for (const auto& r: res.roots()) {
+			ass[p.mainVar()] = r;
+			if (evaluate(cons, ass)) {
+				roots.emplace_back(r);
+			} else {
+				CARL_LOG_TRACE("carl.ran.lifting", "Purging spurious root " << r);
+			}
+		}
+		return Result::roots_response(std::move(roots));
+	}
+};
+
+}
@@ -298,7 +298,7 @@ public:
 	}
 
 	/// Compute and sort the roots of mPolynomial within mInterval.
-	std::vector<RealAlgebraicNumber<Number>> get_roots() {
+	std::vector<real_algebraic_number_interval<Number>> get_roots() {
 		if (simplify_by_factorization) {
 			auto factors = carl::factorization(mPolynomial);
 			CARL_LOG_DEBUG("carl.ran.realroots", "Factorized " << mPolynomial << " to " << factors);
@@ -18,8 +18,14 @@
 #include "../ran_operations_number.h"
 
 #include <list>
+#include <memory>
 #include <boost/logic/tribool.hpp>
 
+#ifdef THREAD_SAFE
+#include <mutex>
+#include <vector>
+#endif
+
 namespace carl {
 
 template<typename Number>
@@ -64,50 +70,124 @@ class real_algebraic_number_interval {
 	friend Num ceil(const real_algebraic_number_interval<Num>& n);
 
 private:
+	/**
+	 * The content is shared by all copies of a number, hence refining one copy refines all of them.
+	 * If THREAD_SAFE is set, all accesses are synchronized using a per-content mutex.
+	 * As the interval is only ever narrowed, a refinement made by one thread is valid for all threads.
+	 * Snapshots share the polynomial and the interval instead of copying them, see snapshot_int().
+	 */
 	struct content {
-		std::optional<Polynomial> polynomial;
-		Interval<Number> interval;
+		/// Never modified once it is published, hence it may be handed out while another polynomial is published.
+		std::shared_ptr<const Polynomial> polynomial;
+		/// Only modified in place if no snapshot refers to it, see interval_for_update().
+		std::shared_ptr<Interval<Number>> interval;
 		/// Sign of polynomial at interval.lower()
 		Sign lower_sign;
+#ifdef THREAD_SAFE
+		/// Replaced polynomials, kept alive for the references handed out by polynomial().
+		/// Every replacement is a proper factor of its predecessor, hence there are fewer of them than its degree.
+		std::vector<std::shared_ptr<const Polynomial>> retired;
+		/// The linear polynomial handed out by polynomial() once the number is numeric.
+		std::shared_ptr<const Polynomial> point_polynomial;
+		std::mutex mutex;
+#endif
 
 		content(const Interval<Number>& i)
-			: polynomial(std::nullopt), interval(i), lower_sign(Sign::ZERO) {}
+			: polynomial(nullptr), interval(std::make_shared<Interval<Number>>(i)), lower_sign(Sign::ZERO) {}
 		content(Polynomial&& p, const Interval<Number>& i)
-			: polynomial(std::move(p)), interval(i), lower_sign(Sign::ZERO) {}
+			: polynomial(std::make_shared<const Polynomial>(std::move(p))), interval(std::make_shared<Interval<Number>>(i)), lower_sign(Sign::ZERO) {}
 		content(const Polynomial& p, const Interval<Number>& i)
-			: polynomial(p), interval(i), lower_sign(Sign::ZERO) {}
+			: polynomial(std::make_shared<const Polynomial>(p)), interval(std::make_shared<Interval<Number>>(i)), lower_sign(Sign::ZERO) {}
+		void publish_polynomial(std::shared_ptr<const Polynomial> p) {
+#ifdef THREAD_SAFE
+			if (polynomial) retired.emplace_back(std::move(polynomial));
+#endif
+			polynomial = std::move(p);
+		}
 		void simplify_to_point() {
-			assert(interval.isPointInterval());
-			polynomial = std::nullopt;
+			assert(interval->isPointInterval());
+			publish_polynomial(nullptr);
 			lower_sign = Sign::ZERO;
 		}
 	};
 
 	mutable std::shared_ptr<content> m_content;
 
+#ifdef THREAD_SAFE
+	#define RAN_INTERVAL_LOCK_GUARD std::lock_guard<std::mutex> lock(m_content->mutex);
+	/// The interval is returned by value, as other threads may refine it at any time.
+	using interval_ref = Interval<Number>;
+	/// A consistent view of the content, taken while holding the lock.
+	/// It shares the interval and the polynomial, which are not modified while the snapshot refers to them.
+	struct snapshot {
+		std::shared_ptr<const Interval<Number>> interval_ptr;
+		std::shared_ptr<const Polynomial> polynomial;
+		Sign lower_sign;
+		const Interval<Number>& interval = *interval_ptr;
+	};
+#else
+	#define RAN_INTERVAL_LOCK_GUARD
+	using interval_ref = const Interval<Number>&;
+	struct snapshot {
+		const Interval<Number>& interval;
+		const std::shared_ptr<const Polynomial>& polynomial;
+		Sign lower_sign;
+	};
+#endif
+
+	/**
+	 * Returns the interval and the polynomial as of the same point in time.
+	 * All checks on both of them must use the same snapshot, as another thread may refine the number or make it numeric in between.
+	 */
+	snapshot snapshot_int() const {
+		RAN_INTERVAL_LOCK_GUARD
+#ifdef THREAD_SAFE
+		return snapshot{ m_content->interval, m_content->polynomial, m_content->lower_sign };
+#else
+		return snapshot{ *m_content->interval, m_content->polynomial, m_content->lower_sign };
+#endif
+	}
+
+	/**
+	 * Returns the interval to narrow it, the lock must be held.
+	 * If a snapshot still refers to the interval, it is replaced by a copy that is narrowed instead.
+	 */
+	Interval<Number>& interval_for_update() const {
+		if (m_content->interval.use_count() > 1) {
+			m_content->interval = std::make_shared<Interval<Number>>(*m_content->interval);
+		}
+		return *m_content->interval;
+	}
+
 	static Polynomial replaceVariable(const Polynomial& p) {
 		return carl::replace_main_variable(p, auxVariable);
 	}
 
 	bool is_consistent() const {
-		if (interval_int().isPointInterval()) {
-			return !m_content->polynomial && m_content->lower_sign == Sign::ZERO;
+		auto s = snapshot_int();
+		if (s.interval.isPointInterval()) {
+			return !s.polynomial && s.lower_sign == Sign::ZERO;
 		} else {
-			if (interval_int().contains(0) || interval_int().containsInteger()) {
+			if (s.interval.contains(0) || s.interval.containsInteger()) {
 				CARL_LOG_DEBUG("carl.ran.ir", "Interval contains 0 or integer");
 				return false;
 			}
-			if (polynomial_int().normalized() != carl::squareFreePart(polynomial_int()).normalized()) {
-				CARL_LOG_DEBUG("carl.ran.ir", "Poly is not square free: " << polynomial_int());
+			if (!s.polynomial) {
+				CARL_LOG_DEBUG("carl.ran.ir", "Interval is not a point but there is no polynomial");
+				return false;
+			}
+			const auto& poly = *s.polynomial;
+			if (poly.normalized() != carl::squareFreePart(poly).normalized()) {
+				CARL_LOG_DEBUG("carl.ran.ir", "Poly is not square free: " << poly);
 				return false;
 			}
-			auto lsgn = carl::sgn(carl::evaluate(polynomial_int(), interval_int().lower()));
-			auto usgn = carl::sgn(carl::evaluate(polynomial_int(), interval_int().upper()));
+			auto lsgn = carl::sgn(carl::evaluate(poly, s.interval.lower()));
+			auto usgn = carl::sgn(carl::evaluate(poly, s.interval.upper()));
 			if (lsgn == Sign::ZERO || usgn == Sign::ZERO || lsgn == usgn) {
 				CARL_LOG_DEBUG("carl.ran.ir", "Interval does not define a zero");
 				return false;
 			}
-			if (m_content->lower_sign != lsgn) {
+			if (s.lower_sign != lsgn) {
 				CARL_LOG_DEBUG("carl.ran.ir", "Lower sign does not match");
 				return false;
 			}
@@ -115,69 +195,108 @@ private:
 		}
 	}
 
+	/**
+	 * Replaces the polynomial by a factor p that has the same root in the interval.
+	 * As the interval is only ever narrowed towards the root, the sign of p at the lower bound does not change by concurrent refinements.
+	 */
 	void set_polynomial(const Polynomial& p, Sign lower_sign) const {
-		assert(!interval_int().isPointInterval());
-		polynomial_int() = replaceVariable(p);
-		m_content->lower_sign = lower_sign;
+		{
+			RAN_INTERVAL_LOCK_GUARD
+			// Another thread may have made the number numeric in the meantime.
+			if (m_content->interval->isPointInterval()) return;
+			m_content->publish_polynomial(std::make_shared<const Polynomial>(replaceVariable(p)));
+			m_content->lower_sign = lower_sign;
+		}
 		assert(is_consistent());
 	}
 
 	/**
-	 * Returns the sign of "interval_int() - pivot":
+	 * Returns the sign of "RAN - pivot":
 	 * Returns ZERO if pivot is equal to RAN.
 	 * Returns POSITIVE if pivot is less than RAN resp. the new lower bound.
 	 * Returns NEGATIVE if pivot is greater than RAN resp. the new upper bound.
 	 */
 	Sign refine_internal(const Number& pivot) const {
 		// assert(is_consistent());
-		assert(interval_int().contains(pivot));
-		assert(!interval_int().isPointInterval());
-		auto psgn = carl::sgn(carl::evaluate(polynomial_int(), pivot));
+		RAN_INTERVAL_LOCK_GUARD
+		const auto& interval = *m_content->interval;
+#ifdef THREAD_SAFE
+		// Another thread may have refined the interval since the pivot was chosen.
+		if (interval.isPointInterval() || !interval.contains(pivot)) {
+			if (interval.isPointInterval() && interval.lower() == pivot) return Sign::ZERO;
+			return (pivot <= interval.lower()) ? Sign::POSITIVE : Sign::NEGATIVE;
+		}
+#endif
+		assert(interval.contains(pivot));
+		assert(!interval.isPointInterval());
+		auto psgn = carl::sgn(carl::evaluate(*m_content->polynomial, pivot));
 		if (psgn == Sign::ZERO) {
-			interval_int() = Interval<Number>(pivot, pivot);
+			interval_for_update() = Interval<Number>(pivot, pivot);
 			m_content->simplify_to_point();
 			return Sign::ZERO;
 		}
 		if (psgn == m_content->lower_sign) {
-			interval_int().setLower(pivot);
-			assert(interval_int().isConsistent());
+			interval_for_update().setLower(pivot);
+			assert(m_content->interval->isConsistent());
 			return Sign::POSITIVE;
 		} else {
-			interval_int().setUpper(pivot);
-			assert(interval_int().isConsistent());
+			interval_for_update().setUpper(pivot);
+			assert(m_content->interval->isConsistent());
 			return Sign::NEGATIVE;
 		}
 	}
 
 public: // TODO should be private
 	void refine() const {
-		if (is_numeric()) return;
-		Number pivot = carl::sample(interval_int());
+		Number pivot;
+		{
+			auto s = snapshot_int();
+			if (s.interval.isPointInterval()) return;
+			pivot = carl::sample(s.interval);
+		}
 		refine_internal(pivot);
 	}
 
 private:
 	std::optional<Sign> refine_using(const Number& pivot) const {
-		if (interval_int().contains(pivot)) {
-			if (is_numeric()) return Sign::ZERO;
-			else return refine_internal(pivot);
+		{
+			// The snapshot is released before refining, so that the interval can be narrowed in place.
+			auto s = snapshot_int();
+			if (!s.interval.contains(pivot)) return std::nullopt;
+			if (s.interval.isPointInterval()) return Sign::ZERO;
 		}
-		return std::nullopt;
+		return refine_internal(pivot);
 	}
 
 	/// Refines until the number is either numeric or the interval does not contain any integer.
 	void refine_to_integrality() const {
-		while (!interval_int().isPointInterval() && interval_int().containsInteger()) {
+		while (true) {
+			{
+				auto s = snapshot_int();
+				if (s.interval.isPointInterval() || !s.interval.containsInteger()) return;
+			}
 			refine();
 		}
 	}
 
-	auto& polynomial_int() const {
+	/**
+	 * Returns the defining polynomial.
+	 * If THREAD_SAFE is set, the number may become numeric concurrently, in which case the linear polynomial with this root is returned.
+	 * The reference stays valid while this number exists, as published polynomials are never modified or released.
+	 */
+	const Polynomial& polynomial_int() const {
+		RAN_INTERVAL_LOCK_GUARD
+#ifdef THREAD_SAFE
+		if (!m_content->polynomial) {
+			assert(m_content->interval->isPointInterval());
+			if (!m_content->point_polynomial) {
+				m_content->point_polynomial = std::make_shared<const Polynomial>(Polynomial(auxVariable, {-m_content->interval->lower(), constant_one<Number>::get()}));
+			}
+			return *m_content->point_polynomial;
+		}
+#endif
 		return *(m_content->polynomial);
 	}
-	auto& interval_int() const {
-		return m_content->interval;
-	}
 
 public:
 	real_algebraic_number_interval()
@@ -189,19 +308,22 @@ public:
 	real_algebraic_number_interval(const Polynomial& p, const Interval<Number>& i)
 		: m_content(std::make_shared<content>(replaceVariable(p), i)) {
 		CARL_LOG_DEBUG("carl.ran.ir", "Creating (" << p << "," << i << ")");
-		assert(!carl::isZero(polynomial_int()) && polynomial_int().degree() > 0);
-		assert(interval_int().isOpenInterval() || interval_int().isPointInterval());
-		// assert(interval_int().isPointInterval() || count_real_roots(sturm_sequence(), interval_int()) == 1);
-		if (interval_int().isPointInterval()) {
+		// The content is not shared yet, hence it can be accessed without synchronization.
+		const auto& poly = *(m_content->polynomial);
+		auto& interval = *(m_content->interval);
+		assert(!carl::isZero(poly) && poly.degree() > 0);
+		assert(interval.isOpenInterval() || interval.isPointInterval());
+		// assert(interval.isPointInterval() || count_real_roots(sturm_sequence(), interval) == 1);
+		if (interval.isPointInterval()) {
 			m_content->simplify_to_point();
-		} else if (polynomial_int().degree() == 1) {
-			Number a = polynomial_int().coefficients()[1];
-			Number b = polynomial_int().coefficients()[0];
-			interval_int() = Interval<Number>(Number(-b / a));
+		} else if (poly.degree() == 1) {
+			Number a = poly.coefficients()[1];
+			Number b = poly.coefficients()[0];
+			interval = Interval<Number>(Number(-b / a));
 			m_content->simplify_to_point();
 		} else {
-			m_content->lower_sign = carl::sgn(carl::evaluate(polynomial_int(), interval_int().lower()));
-			if (interval_int().contains(0)) refine_using(0);
+			m_content->lower_sign = carl::sgn(carl::evaluate(poly, interval.lower()));
+			if (interval.contains(0)) refine_using(0);
 			refine_to_integrality();
 		}
 		assert(is_consistent());
@@ -218,70 +340,85 @@ public:
 	}
 
 	bool is_zero() const {
-		return carl::isZero(interval_int());
+		RAN_INTERVAL_LOCK_GUARD
+		return carl::isZero(*m_content->interval);
 	}
 	bool is_integral() const {
-		return interval_int().isPointInterval() && carl::isInteger(interval_int().lower());
+		RAN_INTERVAL_LOCK_GUARD
+		return m_content->interval->isPointInterval() && carl::isInteger(m_content->interval->lower());
 	}
 	Number integer_below() const {
-		return carl::floor(interval_int().lower());
+		RAN_INTERVAL_LOCK_GUARD
+		return carl::floor(m_content->interval->lower());
 	}
 	bool is_numeric() const {
-		return interval_int().isPointInterval();
+		RAN_INTERVAL_LOCK_GUARD
+		return m_content->interval->isPointInterval();
 	}
 
-	const auto& polynomial() const {
+	const Polynomial& polynomial() const {
+#ifndef THREAD_SAFE
 		assert(!is_numeric());
-		return *(m_content->polynomial);
+#endif
+		return polynomial_int();
 	}
-	const auto& interval() const {
+	interval_ref interval() const {
 		assert(!is_numeric());
-		return m_content->interval;
+		RAN_INTERVAL_LOCK_GUARD
+		return *m_content->interval;
 	}
 
+	/// Once a number is numeric, its content is never modified again and can be accessed without synchronization.
 	const auto& value() const {
 		assert(is_numeric());
-		return interval_int().lower();
+		return m_content->interval->lower();
 	}
 
 	real_algebraic_number_interval<Number> abs() const {
-		assert(!interval_int().contains(constant_zero<Number>::get()) || interval_int().isPointInterval());
-		if (interval_int().isSemiPositive()) {
+		auto s = snapshot_int();
+		assert(!s.interval.contains(constant_zero<Number>::get()) || s.interval.isPointInterval());
+		if (s.interval.isSemiPositive()) {
 			return *this;
 		}
 		else {
-			if (is_numeric()) {
-				return real_algebraic_number_interval<Number>(carl::abs(value()));
+			if (s.interval.isPointInterval()) {
+				return real_algebraic_number_interval<Number>(carl::abs(s.interval.lower()));
 			} else {
-				return real_algebraic_number_interval<Number>(polynomial_int().negateVariable(), interval_int().abs());
+				return real_algebraic_number_interval<Number>(s.polynomial->negateVariable(), s.interval.abs());
 			}
 		}
 	}
 
 	std::size_t size() const {
-		if (is_numeric()) {
-			return carl::bitsize(interval_int().lower()) + carl::bitsize(interval_int().upper());
+		auto s = snapshot_int();
+		if (s.interval.isPointInterval()) {
+			return carl::bitsize(s.interval.lower()) + carl::bitsize(s.interval.upper());
 		} else {
-			return carl::bitsize(interval_int().lower()) + carl::bitsize(interval_int().upper()) + polynomial_int().degree();
+			return carl::bitsize(s.interval.lower()) + carl::bitsize(s.interval.upper()) + s.polynomial->degree();
 		}
 	}
 
 	Sign sgn() const {
-		if (interval_int().isPointInterval()) return carl::sgn(interval_int().lower());
-		assert(!interval_int().contains(constant_zero<Number>::get()));
-		if (interval_int().isSemiPositive())
+		auto s = snapshot_int();
+		const auto& interval = s.interval;
+		if (interval.isPointInterval()) return carl::sgn(interval.lower());
+		assert(!interval.contains(constant_zero<Number>::get()));
+		if (interval.isSemiPositive())
 			return Sign::POSITIVE;
 		else {
-			assert(interval_int().isSemiNegative());
+			assert(interval.isSemiNegative());
 			return Sign::NEGATIVE;
 		}
 	}
 
 	Sign sgn(const Polynomial& p) const {
+		auto s = snapshot_int();
+		if (s.interval.isPointInterval()) return carl::sgn(carl::evaluate(p, s.interval.lower()));
+		const auto& poly = *s.polynomial;
 		Polynomial tmp = replaceVariable(p);
-		if (polynomial_int() == tmp) return Sign::ZERO;
-		auto seq = carl::sturm_sequence(polynomial_int(), derivative(polynomial_int()) * tmp);
-		int variations = carl::count_real_roots(seq, interval_int());
+		if (poly == tmp) return Sign::ZERO;
+		auto seq = carl::sturm_sequence(poly, derivative(poly) * tmp);
+		int variations = carl::count_real_roots(seq, s.interval);
 		assert((variations == -1) || (variations == 0) || (variations == 1));
 		switch (variations) {
 		case -1:
@@ -297,75 +434,71 @@ public:
 	}
 
 	bool contained_in(const Interval<Number>& i) const {
-		if (!is_numeric() && interval_int().contains(i.lower())) {
-			refine_internal(i.lower());
-		}
-		if (!is_numeric() && interval_int().contains(i.upper())) {
-			refine_internal(i.upper());
-		}
-		return i.contains(interval_int());
+		refine_using(i.lower());
+		refine_using(i.upper());
+		return i.contains(snapshot_int().interval);
 	}
 };
 
 template<typename Number>
 Number branching_point(const real_algebraic_number_interval<Number>& n) {
-	return carl::sample(n.interval_int());
+	return carl::sample(n.snapshot_int().interval);
 }
 
 template<typename Number>
 Number sample_above(const real_algebraic_number_interval<Number>& n) {
-	return carl::floor(n.interval_int().upper()) + 1;
+	return carl::floor(n.snapshot_int().interval.upper()) + 1;
 }
 template<typename Number>
 Number sample_below(const real_algebraic_number_interval<Number>& n) {
-	return carl::ceil(n.interval_int().lower()) - 1;
+	return carl::ceil(n.snapshot_int().interval.lower()) - 1;
 }
 template<typename Number>
 Number sample_between(const real_algebraic_number_interval<Number>& lower, const real_algebraic_number_interval<Number>& upper) {
-	lower.refine_using(upper.interval_int().lower());
-	upper.refine_using(lower.interval_int().upper());
-	assert(lower.interval_int().upper() <= upper.interval_int().lower());
+	lower.refine_using(upper.snapshot_int().interval.lower());
+	upper.refine_using(lower.snapshot_int().interval.upper());
+	assert(lower.snapshot_int().interval.upper() <= upper.snapshot_int().interval.lower());
 	if (lower.is_numeric()) {
 		return sample_between(lower.value(), upper);
 	} else if (upper.is_numeric()) {
 		return sample_between(lower, upper.value());
 	} else {
-		return sample(Interval<Number>(lower.interval_int().upper(), upper.interval_int().lower()), true);
+		return sample(Interval<Number>(lower.snapshot_int().interval.upper(), upper.snapshot_int().interval.lower()), true);
 	}
 }
 template<typename Number>
 Number sample_between(const real_algebraic_number_interval<Number>& lower, const Number& upper) {
 	lower.refine_using(upper);
-	assert(lower.interval_int().upper() <= upper);
+	assert(lower.snapshot_int().interval.upper() <= upper);
 	assert(lower < upper);
-	while (lower.interval_int().upper() == upper)
+	while (lower.snapshot_int().interval.upper() == upper)
 		lower.refine();
 	if (lower.is_numeric()) {
 		return sample_between(lower.value(), upper);
 	} else {
-		return sample(Interval<Number>(lower.interval_int().upper(), BoundType::WEAK, upper, BoundType::STRICT), false);
+		return sample(Interval<Number>(lower.snapshot_int().interval.upper(), BoundType::WEAK, upper, BoundType::STRICT), false);
 	}
 }
 template<typename Number>
 Number sample_between(const Number& lower, const real_algebraic_number_interval<Number>& upper) {
 	upper.refine_using(lower);
-	assert(lower <= upper.interval_int().lower());
+	assert(lower <= upper.snapshot_int().interval.lower());
 	assert(lower < upper);
-	while (lower == upper.interval_int().lower())
+	while (lower == upper.snapshot_int().interval.lower())
 		upper.refine();
 	if (upper.is_numeric()) {
 		return sample_between(lower, upper.value());
 	} else {
-		return sample(Interval<Number>(lower, BoundType::STRICT, upper.interval_int().lower(), BoundType::WEAK), false);
+		return sample(Interval<Number>(lower, BoundType::STRICT, upper.snapshot_int().interval.lower(), BoundType::WEAK), false);
 	}
 }
 template<typename Number>
 Number floor(const real_algebraic_number_interval<Number>& n) {
-	return carl::floor(n.interval_int().lower());
+	return carl::floor(n.snapshot_int().interval.lower());
 }
 template<typename Number>
 Number ceil(const real_algebraic_number_interval<Number>& n) {
-	return carl::ceil(n.interval_int().upper());
+	return carl::ceil(n.snapshot_int().interval.upper());
 }
 
 template<typename Number>
@@ -377,65 +510,67 @@ bool compare(const real_algebraic_number_interval<Number>& lhs, const real_algeb
 		return evaluate(Sign::ZERO, relation);
 	}
 
-	if (lhs.interval_int().isPointInterval() && rhs.interval_int().isPointInterval()) {
-		CARL_LOG_TRACE("carl.ran", "Point interval comparison");
-		return evaluate(lhs.interval_int().lower(), relation, rhs.interval_int().lower());
-	}
-
-	if (carl::set_have_intersection(lhs.interval_int(), rhs.interval_int())) {
-		CARL_LOG_TRACE("carl.ran", "Intervals " << lhs.interval_int() << " and " << rhs.interval_int() << " do intersect");
-		auto intersection = carl::set_intersection(lhs.interval_int(), rhs.interval_int());
-		assert(!intersection.isEmpty());
-		lhs.refine_using(intersection.lower());
-		rhs.refine_using(intersection.lower());
-		if (!intersection.isPointInterval()) {
-			lhs.refine_using(intersection.upper());
-			rhs.refine_using(intersection.upper());
-		}
-	}
-	// now: intervals are either equal or disjoint
-	assert(!carl::set_have_intersection(lhs.interval_int(), rhs.interval_int()) || lhs.interval_int() == rhs.interval_int());
-	if (lhs.interval_int() == rhs.interval_int()) {
-		CARL_LOG_TRACE("carl.ran", "Intervals " << lhs.interval_int() << " and " << rhs.interval_int() << " are equal");
-		if (lhs.is_numeric()) {
-			CARL_LOG_TRACE("carl.ran", "Interval " << lhs.interval_int() << " is a point interval");
-			return evaluate(Sign::ZERO, relation);
-		}
-		if (lhs.polynomial_int() == rhs.polynomial_int()) {
-			CARL_LOG_TRACE("carl.ran", "Polynomials " << lhs.polynomial_int() << " and " << rhs.polynomial_int() << " are equal");
-			return evaluate(Sign::ZERO, relation);
+	// Every iteration works on one snapshot of each number, as other threads may refine them at any time.
+	// The snapshots are released before refining, so that the intervals can be narrowed in place.
+	while (true) {
+		std::optional<Interval<Number>> intersection;
+		{
+			auto l = lhs.snapshot_int();
+			auto r = rhs.snapshot_int();
+			if (l.interval.isPointInterval() && r.interval.isPointInterval()) {
+				CARL_LOG_TRACE("carl.ran", "Point interval comparison");
+				return evaluate(l.interval.lower(), relation, r.interval.lower());
+			}
+			if (!carl::set_have_intersection(l.interval, r.interval)) {
+				CARL_LOG_TRACE("carl.ran", "Intervals " << l.interval << " and " << r.interval << " are disjoint");
+				if (l.interval.upper() <= r.interval.lower()) {
+					return evaluate(Sign::NEGATIVE, relation);
+				}
+				assert(l.interval.lower() >= r.interval.upper());
+				return evaluate(Sign::POSITIVE, relation);
+			}
+			if (l.interval != r.interval) {
+				CARL_LOG_TRACE("carl.ran", "Intervals " << l.interval << " and " << r.interval << " do intersect");
+				intersection = carl::set_intersection(l.interval, r.interval);
+				assert(!intersection->isEmpty());
+			} else {
+				CARL_LOG_TRACE("carl.ran", "Intervals " << l.interval << " and " << r.interval << " are equal");
+				// The intervals are equal, but not both points, hence none of them is a point.
+				assert(l.polynomial && r.polynomial);
+				if (*l.polynomial == *r.polynomial) {
+					CARL_LOG_TRACE("carl.ran", "Polynomials " << *l.polynomial << " and " << *r.polynomial << " are equal");
+					return evaluate(Sign::ZERO, relation);
+				}
+				auto g = carl::gcd(*l.polynomial, *r.polynomial);
+				auto lsgn = carl::sgn(carl::evaluate(g, l.interval.lower()));
+				auto usgn = carl::sgn(carl::evaluate(g, l.interval.upper()));
+				if (lsgn != usgn) {
+					CARL_LOG_TRACE("carl.ran", "gcd(lhs,rhs) has a zero in the common interval");
+					lhs.set_polynomial(g, lsgn);
+					rhs.set_polynomial(g, lsgn);
+					return evaluate(Sign::ZERO, relation);
+				}
+				CARL_LOG_TRACE("carl.ran", "gcd(lhs,rhs) has no zero in the common interval");
+				if (relation == Relation::EQ) return false;
+				if (relation == Relation::NEQ) return true;
+			}
 		}
-		auto g = carl::gcd(lhs.polynomial_int(), rhs.polynomial_int());
-		auto lsgn = carl::sgn(carl::evaluate(g, lhs.interval_int().lower()));
-		auto usgn = carl::sgn(carl::evaluate(g, lhs.interval_int().upper()));
-		if (lsgn != usgn) {
-			CARL_LOG_TRACE("carl.ran", "gcd(lhs,rhs) has a zero in the common interval");
-			lhs.set_polynomial(g, lsgn);
-			rhs.set_polynomial(g, lsgn);
-			return evaluate(Sign::ZERO, relation);
-		} else {
-			CARL_LOG_TRACE("carl.ran", "gcd(lhs,rhs) has no zero in the common interval");
-			if (relation == Relation::EQ) return false;
-			if (relation == Relation::NEQ) return true;
-			CARL_LOG_TRACE("carl.ran", "Refine until intervals become disjoint");
-			while (lhs.interval_int() == rhs.interval_int()) {
-				lhs.refine();
-				rhs.refine();
+		if (intersection) {
+			// Afterwards, the intervals are either equal or disjoint.
+			lhs.refine_using(intersection->lower());
+			rhs.refine_using(intersection->lower());
+			if (!intersection->isPointInterval()) {
+				lhs.refine_using(intersection->upper());
+				rhs.refine_using(intersection->upper());
 			}
+			continue;
 		}
+		CARL_LOG_TRACE("carl.ran", "Refine until intervals become disjoint");
+		do {
+			lhs.refine();
+			rhs.refine();
+		} while (lhs.snapshot_int().interval == rhs.snapshot_int().interval);
 	}
-	// now: intervals are disjoint
-	CARL_LOG_TRACE("carl.ran", "Intervals " << lhs.interval_int() << " and " << rhs.interval_int() << " are disjoint");
-	assert(!carl::set_have_intersection(lhs.interval_int(), rhs.interval_int()));
-	if (lhs.interval_int().upper() <= rhs.interval_int().lower()) {
-		return relation == Relation::LESS || relation == Relation::LEQ;
-	}
-	if (lhs.interval_int().lower() >= rhs.interval_int().upper()) {
-		return relation == Relation::GREATER || relation == Relation::GEQ;
-	}
-
-	assert(false);
-	return false;
 }
 
 template<typename Number>
@@ -449,9 +584,9 @@ bool compare(const real_algebraic_number_interval<Number>& lhs, const Number& rh
 		else if (relation == Relation::NEQ)
 			return true;
 		else if (relation == Relation::LESS || relation == Relation::LEQ)
-			return lhs.interval_int().upper() <= rhs;
+			return lhs.snapshot_int().interval.upper() <= rhs;
 		else if (relation == Relation::GREATER || relation == Relation::GEQ)
-			return lhs.interval_int().lower() >= rhs;
+			return lhs.snapshot_int().interval.lower() >= rhs;
 	}
 	assert(false);
 	return false;
@@ -471,6 +606,8 @@ std::ostream& operator<<(std::ostream& os, const real_algebraic_number_interval<
 template<typename Number>
 const Variable real_algebraic_number_interval<Number>::auxVariable = freshRealVariable("__r");
 
+#undef RAN_INTERVAL_LOCK_GUARD
+
 template<typename Number>
 struct is_ran<real_algebraic_number_interval<Number>>: std::true_type {};
 }
@@ -7,6 +7,7 @@
 
 #include "ran_interval.h"
 #include "AlgebraicSubstitution.h"
+#include "FilteredEvaluation.h"
 
 #include <boost/logic/tribool_io.hpp>
 
@@ -26,45 +27,68 @@ template<typename Number>
 std::optional<real_algebraic_number_interval<Number>> evaluate(MultivariatePolynomial<Number> p, const ran::ran_assignment_t<real_algebraic_number_interval<Number>>& m, bool refine_model = true) {
 	CARL_LOG_DEBUG("carl.ran.evaluation", "Evaluating " << p << " on " << m);
 	
+	auto substitute_numeric = [&p, &m]() {
+		for (const auto& [var, ran] : m) {
+			if (p.has(var) && ran.is_numeric()) {
+				CARL_LOG_TRACE("carl.ran.evaluation", "Substitute " << var << " = " << ran);
+				substitute_inplace(p, var, MultivariatePolynomial<Number>(ran.value()));
+			}
+		}
+	};
+	auto interval_map = [&p, &m]() {
+		std::map<Variable, Interval<Number>> res;
+		for (const auto& [var, ran] : m) {
+			if (p.has(var)) {
+				assert(!ran.is_numeric());
+				res.emplace(var, ran.interval());
+			}
+		}
+		return res;
+	};
+
 	CARL_LOG_TRACE("carl.ran.evaluation", "Substitute rationals");
-	for (const auto& [var, ran] : m) {
-		if (!p.has(var)) continue;
-		if (refine_model) {
+	substitute_numeric();
+	if (p.isNumber()) {
+		CARL_LOG_DEBUG("carl.ran.evaluation", "Returning " << p.constantPart());
+		return real_algebraic_number_interval<Number>(p.constantPart());
+	}
+
+	// Try the floating point filter on the current intervals before refining them exactly.
+	std::map<Variable, Interval<Number>> var_to_interval = interval_map();
+	boost::tribool nonzero = ran::interval::evaluate_filtered(p, Relation::NEQ, var_to_interval);
+	if (refine_model && indeterminate(nonzero)) {
+		for (const auto& [var, ran] : m) {
+			if (!p.has(var)) continue;
 			CARL_LOG_TRACE("carl.ran.evaluation", "Refine " << var << " = " << ran);
 			static Number min_width = Number(1) / (Number(1048576)); // 1/2^20, taken from libpoly
 			while (!ran.is_numeric() && ran.interval().diameter() > min_width) {
 				ran.refine();
 			}
 		}
-		if (ran.is_numeric()) {
-			CARL_LOG_TRACE("carl.ran.evaluation", "Substitute " << var << " = " << ran);
-			substitute_inplace(p, var, MultivariatePolynomial<Number>(ran.value()));
-		} 
+		substitute_numeric();
+		if (p.isNumber()) {
+			CARL_LOG_DEBUG("carl.ran.evaluation", "Returning " << p.constantPart());
+			return real_algebraic_number_interval<Number>(p.constantPart());
+		}
+		var_to_interval = interval_map();
+		nonzero = ran::interval::evaluate_filtered(p, Relation::NEQ, var_to_interval);
+	}
+	if (!nonzero) {
+		CARL_LOG_DEBUG("carl.ran.evaluation", "Filter shows that the result is zero");
+		return real_algebraic_number_interval<Number>();
 	}
-    if (p.isNumber()) {
-		CARL_LOG_DEBUG("carl.ran.evaluation", "Returning " << p.constantPart());
-        return real_algebraic_number_interval<Number>(p.constantPart());
-    }
 
 	CARL_LOG_TRACE("carl.ran.evaluation", "Remaing polynomial: " << p);
-
-	CARL_LOG_TRACE("carl.ran.evaluation", "Create interval map");
-	std::map<Variable, Interval<Number>> var_to_interval;
-	for (const auto& [var, ran] : m) {
-		if (p.has(var)) {
-			assert(!ran.is_numeric());
-			var_to_interval.emplace(var, ran.interval());
-		}
-	}
 	CARL_LOG_TRACE("carl.ran.evaluation", "Interval map: " << var_to_interval);
 
-    assert(!var_to_interval.empty());
+	assert(!var_to_interval.empty());
 	if (var_to_interval.size() == 1) {
 		CARL_LOG_TRACE("carl.ran.evaluation", "Single interval");
 		auto poly = carl::to_univariate_polynomial(p);
 		assert(poly.mainVar() == var_to_interval.begin()->first);
 		CARL_LOG_TRACE("carl.ran.evaluation", "Consider univariate poly " << poly);
-		if (m.at(var_to_interval.begin()->first).sgn(poly) == Sign::ZERO) {
+		// The exact sign computation is only needed if floating point interval arithmetic can not show that p is nonzero.
+		if (indeterminate(nonzero) && m.at(var_to_interval.begin()->first).sgn(poly) == Sign::ZERO) {
 			CARL_LOG_DEBUG("carl.ran.evaluation", "Returning " << real_algebraic_number_interval<Number>());
 			return real_algebraic_number_interval<Number>();
 		}
@@ -148,18 +172,50 @@ boost::tribool evaluate(const Constraint<Poly>& c, const ran::ran_assignment_t<r
 
 		CARL_LOG_TRACE("carl.ran.evaluation", "p = " << p);
 
-		for (const auto& [var, ran] : m) {
-			if (!p.has(var)) continue;
-			if (refine_model) {
-				static Number min_width = Number(1) / (Number(1048576)); // 1/2^20, taken from libpoly
+		auto substitute_numeric = [&p, &m]() {
+			for (const auto& [var, ran] : m) {
+				if (p.has(var) && ran.is_numeric()) {
+					substitute_inplace(p, var, MultivariatePolynomial<Number>(ran.value()));
+					CARL_LOG_TRACE("carl.ran.evaluation", "Substituting numeric value p["<<ran.value()<<"/"<<var<<"] = " << p);
+				}
+			}
+		};
+		auto interval_map = [&p, &m]() {
+			std::map<Variable, Interval<Number>> res;
+			for (const auto& [var, ran] : m) {
+				if (p.has(var)) {
+					assert(!ran.is_numeric());
+					res.emplace(var, ran.interval());
+				}
+			}
+			return res;
+		};
+
+		substitute_numeric();
+		if (p.isNumber()) {
+			CARL_LOG_DEBUG("carl.ran.evaluation", "Left hand side is constant");
+			return carl::evaluate(p.constantPart(), c.relation());
+		}
+		// Try the floating point filter on the current intervals before refining them exactly.
+		{
+			auto filtered = ran::interval::evaluate_filtered(p, c.relation(), interval_map());
+			if (!indeterminate(filtered)) {
+				CARL_LOG_DEBUG("carl.ran.evaluation", "Result obtained by floating point interval evaluation without refinement");
+				return (bool)filtered;
+			}
+		}
+
+		bool refined = false;
+		if (refine_model) {
+			static Number min_width = Number(1) / (Number(1048576)); // 1/2^20, taken from libpoly
+			for (const auto& [var, ran] : m) {
+				if (!p.has(var)) continue;
 				while (!ran.is_numeric() && ran.interval().diameter() > min_width) {
 					ran.refine();
+					refined = true;
 				}
 			}
-			if (ran.is_numeric()) {
-				substitute_inplace(p, var, MultivariatePolynomial<Number>(ran.value()));
-				CARL_LOG_TRACE("carl.ran.evaluation", "Substituting numeric value p["<<ran.value()<<"/"<<var<<"] = " << p);
-			}
+			substitute_numeric();
 		}
 		
 		if (p.isNumber()) {
@@ -174,11 +230,13 @@ boost::tribool evaluate(const Constraint<Poly>& c, const ran::ran_assignment_t<r
 		p = constr.lhs(); // Constraint simplifies polynomial
 		CARL_LOG_TRACE("carl.ran.evaluation", "p = " << p << " (after simplification)");
 
-		std::map<Variable, Interval<Number>> var_to_interval;
-		for (const auto& [var, ran] : m) {
-			if (p.has(var)) {
-				assert(!ran.is_numeric());
-				var_to_interval.emplace(var, ran.interval());
+		std::map<Variable, Interval<Number>> var_to_interval = interval_map();
+
+		if (refined) {
+			auto filtered = ran::interval::evaluate_filtered(p, constr.relation(), var_to_interval);
+			if (!indeterminate(filtered)) {
+				CARL_LOG_DEBUG("carl.ran.evaluation", "Result obtained by floating point interval evaluation");
+				return (bool)filtered;
 			}
 		}
 
@@ -279,6 +337,11 @@ boost::tribool evaluate(const Constraint<Poly>& c, const ran::ran_assignment_t<r
 					var_to_interval[var] = ran.interval();
 				}
 			}
+			auto filtered = ran::interval::evaluate_filtered(p, constr.relation(), var_to_interval);
+			if (!indeterminate(filtered)) {
+				CARL_LOG_DEBUG("carl.ran.evaluation", "Got result by floating point interval evaluation");
+				return (bool)filtered;
+			}
 			interval = IntervalEvaluation::evaluate(p, var_to_interval);
 			auto int_res = carl::evaluate(interval, constr.relation());
 			if (!indeterminate(int_res)) {
@@ -5,6 +5,7 @@
 #include <carl/core/logging.h>
 #include <carl/core/Sign.h>
 #include <carl/core/UnivariatePolynomial.h>
+#include <carl/util/Instrumentation.h>
 
 #include "RealRootIsolation.h"
 
@@ -23,6 +24,7 @@ real_roots_result<real_algebraic_number_interval<Number>> real_roots(
 		const UnivariatePolynomial<Coeff>& polynomial,
 		const Interval<Number>& interval = Interval<Number>::unboundedInterval()
 ) {
+	CARL_INSTRUMENT("real_roots", polynomial);
 	if (carl::isZero(polynomial)) {
 		return real_roots_result<real_algebraic_number_interval<Number>>::nullified_response();
 	}
@@ -0,0 +1,197 @@
+#pragma once
+
+/**
+ * @file ran_interval_real_roots_batch.h
+ * This file contains real_roots_batch which isolates the roots of a set of polynomials at once.
+ * The polynomials are first split into a coprime basis, such that every root is isolated only once and roots of different basis elements are known to be distinct.
+ * Common roots are thus detected by gcd computations instead of refining the isolating intervals.
+ */
+
+#include <carl/config.h>
+
+#include "LiftingContext.h"
+#include "ran_interval_real_roots.h"
+
+#include <carl/core/polynomialfunctions/Division.h>
+#include <carl/core/polynomialfunctions/GCD.h>
+#include <carl/core/polynomialfunctions/SquareFreePart.h>
+
+#include <algorithm>
+#include <vector>
+
+#ifdef THREAD_SAFE
+#include <thread>
+#endif
+
+namespace carl::ran::interval {
+
+/**
+ * A root of a set of polynomials.
+ * It stores the indices of all polynomials from the input that vanish at this root.
+ */
+template<typename Number>
+struct indexed_root {
+	real_algebraic_number_interval<Number> value;
+	std::vector<std::size_t> polynomials;
+};
+
+namespace detail_real_roots_batch {
+	/// Whether roots are isolated in parallel by default, which requires carl to be built with THREAD_SAFE.
+#ifdef THREAD_SAFE
+	constexpr bool parallel_by_default = true;
+#else
+	constexpr bool parallel_by_default = false;
+#endif
+
+	/// A square-free element of a coprime basis, together with the indices of the input polynomials that it divides.
+	template<typename Number>
+	struct basis_element {
+		UnivariatePolynomial<Number> polynomial;
+		std::vector<std::size_t> indices;
+	};
+
+	/**
+	 * Computes a coprime basis of the square-free parts of the given polynomials.
+	 * The roots of every input polynomial are the union of the roots of the basis elements that list its index.
+	 * Polynomials are added one after another: each basis element is split into its gcd with the new polynomial and the remaining cofactor.
+	 */
+	template<typename Number>
+	std::vector<basis_element<Number>> coprime_basis(const std::vector<std::pair<std::size_t, UnivariatePolynomial<Number>>>& polys) {
+		std::vector<basis_element<Number>> basis;
+		for (const auto& [index, poly]: polys) {
+			auto cur = carl::squareFreePart(poly);
+			std::size_t size = basis.size();
+			for (std::size_t b = 0; b < size && !cur.isConstant(); ++b) {
+				auto g = carl::gcd(cur, basis[b].polynomial);
+				if (g.isConstant()) continue;
+				auto cofactor = carl::divide(basis[b].polynomial, g).quotient;
+				cur = carl::divide(cur, g).quotient;
+				if (!cofactor.isConstant()) {
+					basis.push_back(basis_element<Number>{ cofactor, basis[b].indices });
+				}
+				basis[b].polynomial = g;
+				basis[b].indices.emplace_back(index);
+			}
+			if (!cur.isConstant()) {
+				basis.push_back(basis_element<Number>{ cur, { index } });
+			}
+		}
+		CARL_LOG_DEBUG("carl.ran.realroots", "Coprime basis of " << polys.size() << " polynomials has " << basis.size() << " elements");
+		return basis;
+	}
+
+	/**
+	 * Isolates the roots of all basis elements and merges them into a sorted list.
+	 * If parallel is set and carl is built with THREAD_SAFE, up to one thread per hardware thread is used.
+	 * As the basis elements are coprime, all roots are distinct and comparing them always terminates.
+	 */
+	template<typename Number>
+	std::vector<indexed_root<Number>> isolate(const std::vector<basis_element<Number>>& basis, const Interval<Number>& interval, bool parallel) {
+		std::vector<std::vector<real_algebraic_number_interval<Number>>> roots(basis.size());
+		auto worker = [&basis, &interval, &roots](std::size_t first, std::size_t step) {
+			for (std::size_t i = first; i < basis.size(); i += step) {
+				roots[i] = carl::ran::interval::real_roots(basis[i].polynomial, interval).roots();
+			}
+		};
+#ifdef THREAD_SAFE
+		std::size_t threads = parallel ? std::min<std::size_t>(std::thread::hardware_concurrency(), basis.size()) : 1;
+		if (threads > 1) {
+			std::vector<std::thread> pool;
+			for (std::size_t t = 0; t < threads; ++t) {
+				pool.emplace_back(worker, t, threads);
+			}
+			for (auto& t: pool) t.join();
+		} else {
+			worker(0, 1);
+		}
+#else
+		(void)parallel;
+		worker(0, 1);
+#endif
+
+		std::vector<indexed_root<Number>> res;
+		for (std::size_t i = 0; i < basis.size(); ++i) {
+			for (auto& r: roots[i]) {
+				res.push_back(indexed_root<Number>{ std::move(r), basis[i].indices });
+			}
+		}
+		std::sort(res.begin(), res.end(), [](const auto& lhs, const auto& rhs) {
+			return lhs.value < rhs.value;
+		});
+		for (auto& r: res) {
+			std::sort(r.polynomials.begin(), r.polynomials.end());
+		}
+		return res;
+	}
+}
+
+/**
+ * Isolates the real roots of all given polynomials within the given interval.
+ * The result is sorted in ascending order and contains every root only once, together with the indices of all polynomials that vanish at this root.
+ * The roots of the coprime basis elements are isolated in parallel if parallel is set and carl is built with THREAD_SAFE.
+ * Polynomials that are zero are ignored.
+ */
+template<typename Number>
+std::vector<indexed_root<Number>> real_roots_batch(
+		const std::vector<UnivariatePolynomial<Number>>& polynomials,
+		const Interval<Number>& interval = Interval<Number>::unboundedInterval(),
+		bool parallel = detail_real_roots_batch::parallel_by_default
+) {
+	std::vector<std::pair<std::size_t, UnivariatePolynomial<Number>>> polys;
+	for (std::size_t i = 0; i < polynomials.size(); ++i) {
+		if (carl::isZero(polynomials[i])) continue;
+		polys.emplace_back(i, polynomials[i]);
+	}
+	auto basis = detail_real_roots_batch::coprime_basis(polys);
+	return detail_real_roots_batch::isolate(basis, interval, parallel);
+}
+
+/**
+ * Isolates the real roots of all given polynomials over the current sample point of the lifting context.
+ * All polynomials must have the same main variable, which is not assigned by the context.
+ * The result is sorted in ascending order and contains every root only once, together with the indices of all polynomials that vanish at this root.
+ * Polynomials that vanish or do not become univariate over the sample point are ignored, use LiftingContext::real_roots() to distinguish these cases.
+ */
+template<typename Number>
+std::vector<indexed_root<Number>> real_roots_batch(
+		const std::vector<UnivariatePolynomial<MultivariatePolynomial<Number>>>& polynomials,
+		LiftingContext<Number>& context,
+		const Interval<Number>& interval = Interval<Number>::unboundedInterval(),
+		bool parallel = detail_real_roots_batch::parallel_by_default
+) {
+	if (polynomials.empty()) return {};
+	Variable mainVar = polynomials.front().mainVar();
+	std::vector<std::pair<std::size_t, UnivariatePolynomial<Number>>> polys;
+	for (std::size_t i = 0; i < polynomials.size(); ++i) {
+		assert(polynomials[i].mainVar() == mainVar);
+		if (carl::isZero(polynomials[i])) continue;
+		auto p = context.substitute(polynomials[i]);
+		if (!p || carl::isZero(*p)) continue;
+		polys.emplace_back(i, std::move(*p));
+	}
+	auto basis = detail_real_roots_batch::coprime_basis(polys);
+	auto roots = detail_real_roots_batch::isolate(basis, interval, parallel);
+
+	bool algebraic = std::any_of(context.assignment().begin(), context.assignment().end(), [](const auto& a) { return !a.second.is_numeric(); });
+	if (!algebraic) return roots;
+
+	// The algebraic substitution may introduce spurious roots.
+	auto assignment = context.assignment();
+	std::vector<indexed_root<Number>> res;
+	for (auto& r: roots) {
+		assignment[mainVar] = r.value;
+		auto it = std::remove_if(r.polynomials.begin(), r.polynomials.end(), [&](std::size_t i) {
+			Constraint<MultivariatePolynomial<Number>> cons(MultivariatePolynomial<Number>(polynomials[i]), Relation::EQ);
+			return !evaluate(cons, assignment);
+		});
+		r.polynomials.erase(it, r.polynomials.end());
+		if (r.polynomials.empty()) {
+			CARL_LOG_TRACE("carl.ran.realroots", "Purging spurious root " << r.value);
+		} else {
+			res.emplace_back(std::move(r));
+		}
+	}
+	return res;
+}
+
+}
@@ -4,6 +4,7 @@
  * @file
  * Represent a real algebraic number (RAN) in one of several ways:
  * - Implicitly by a univariate polynomial and an interval.
+ * - Implicitly by a primitive integer polynomial and an interval with dyadic bounds.
  * - Implicitly by a polynomial and a sequence of signs (called Thom encoding).
  * - Explicitly by a rational number.
  * Rationale:
@@ -33,6 +34,11 @@
 #include "interval/ran_interval_evaluation.h"
 #endif
 
+#ifdef RAN_USE_DYADIC
+#include "dyadic/ran_dyadic.h"
+#include "dyadic/ran_dyadic_evaluation.h"
+#endif
+
 #ifdef RAN_USE_THOM
 #include "thom/ran_thom.h"
 #include "thom/ran_thom_evaluation.h"
@@ -54,6 +60,11 @@ namespace carl {
 	using real_algebraic_number = real_algebraic_number_interval<Number>;
 	#endif
 
+	#ifdef RAN_USE_DYADIC
+	template<typename Number>
+	using real_algebraic_number = real_algebraic_number_dyadic<Number>;
+	#endif
+
 	#ifdef RAN_USE_THOM
 	template<typename Number>
 	using real_algebraic_number = real_algebraic_number_thom<Number>;
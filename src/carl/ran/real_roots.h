@@ -6,6 +6,10 @@
 #include "interval/ran_interval_real_roots.h"
 #endif
 
+#ifdef RAN_USE_DYADIC
+#include "dyadic/ran_dyadic_real_roots.h"
+#endif
+
 #ifdef RAN_USE_THOM
 #include "thom/ran_thom_real_roots.h"
 #endif
@@ -23,6 +27,10 @@ namespace carl::ran {
     using carl::ran::interval::real_roots;
     #endif
 
+    #ifdef RAN_USE_DYADIC
+    using carl::ran::dyadic::real_roots;
+    #endif
+
     #ifdef RAN_USE_THOM
     using carl::ran::thom::real_roots;
     #endif
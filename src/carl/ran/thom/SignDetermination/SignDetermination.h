@@ -17,6 +17,7 @@
 #include <iterator>
 #include <list>
 #include <queue>
+#include <vector>
 
 
 namespace carl {
@@ -40,6 +41,10 @@ private:
 	std::list<uint> mAdaHelper;
 	Eigen::MatrixXf mMatrix;
 	bool mNeedsUpdate = false;
+	// the Kronecker product computed while adding the last polynomial and the indices of its columns that correspond to realized sign conditions.
+	// the next matrix is a submatrix of it, hence update() does not need to recompute it.
+	Eigen::MatrixXf mPendingMatrix;
+	std::vector<Eigen::Index> mPendingColumns;
 	
 	
 	
@@ -61,7 +66,9 @@ public:
 		mAda(other.mAda),
 		mAdaHelper(other.mAdaHelper),
 		mMatrix(other.mMatrix),
-		mNeedsUpdate(other.mNeedsUpdate)
+		mNeedsUpdate(other.mNeedsUpdate),
+		mPendingMatrix(other.mPendingMatrix),
+		mPendingColumns(other.mPendingColumns)
 	{}
 	
 	uint sizeOfZeroSet() const {
@@ -76,6 +83,7 @@ public:
 	const auto& adaptedList() const { return mAda; }
 	const auto& matrix() const { return mMatrix; }
 	bool needsUpdate() const { return mNeedsUpdate; }
+	const auto& tarskiQueryManager() const { return mTaQ; }
 	
 	
 private:
@@ -166,7 +174,8 @@ private:
 			const Eigen::MatrixXf& mat,
 			const std::vector<Alpha>& ada,
 			std::vector<Polynomial>& products,
-			const uint q) const {
+			const uint q,
+			std::vector<Eigen::Index>& rows) const {
 		CARL_LOG_ASSERT("carl.thom.sign", n > 0, "");
 		std::vector<uint> lines(ada.size(), 0);
 		assert(n <= ada.size());
@@ -197,6 +206,7 @@ private:
 		for(uint i = 0; i < lines.size(); i++) {
 			if(lines[i] == 1) {
 				res.push_back(ada[i]);
+				rows.push_back(Eigen::Index(q*ada.size() + i));
 				newProducts.push_back(products[q*ada.size() + i]);
 			}
 		}
@@ -211,6 +221,9 @@ private:
 		std::list<Polynomial> adaptedProducts = mProducts;
 		adaptedProducts.resize(mAda.size());
 		uint r1 = mAda.size();
+		// rows of mPendingMatrix that belong to newAda
+		std::vector<Eigen::Index> rows;
+		for(uint i = 0; i < r1; i++) rows.push_back(Eigen::Index(i));
 		if(mSigns.size() != r1) {
 			CARL_LOG_TRACE("carl.thom.sign", "need to compute r2");
 			Eigen::MatrixXf m2 = mMatrix;
@@ -231,7 +244,8 @@ private:
 				m2, 
 				std::vector<Alpha>(mAda.begin(), mAda.end()), 
 				products, 
-				1);
+				1,
+				rows);
 			for(auto& alpha : A_2) {
 				alpha.push_front(1);
 				newAda.push_back(alpha);
@@ -259,7 +273,8 @@ private:
 					m3,
 					std::vector<Alpha>(mAda.begin(), mAda.end()),
 					products,
-					2);
+					2,
+					rows);
 				for(auto& alpha : A_3) {
 					alpha.push_front(2);
 					newAda.push_back(alpha);
@@ -270,7 +285,17 @@ private:
 			}	 
 		}
 		mAda = newAda;
-		mMatrix = adaptedMat(mAda, mSigns);
+		// sigmaToTheAlpha is multiplicative, hence the entries of the new matrix are entries of the Kronecker product
+		CARL_LOG_ASSERT("carl.thom.sign", rows.size() == mAda.size() && mPendingColumns.size() == mSigns.size(), "");
+		mMatrix = Eigen::MatrixXf(Eigen::Index(rows.size()), Eigen::Index(mPendingColumns.size()));
+		for(std::size_t i = 0; i < rows.size(); i++) {
+			for(std::size_t j = 0; j < mPendingColumns.size(); j++) {
+				mMatrix(Eigen::Index(i), Eigen::Index(j)) = mPendingMatrix(rows[i], mPendingColumns[j]);
+			}
+		}
+		CARL_LOG_ASSERT("carl.thom.sign", mMatrix == adaptedMat(mAda, mSigns), "incremental update of the matrix failed");
+		mPendingMatrix.resize(0, 0);
+		mPendingColumns.clear();
 		CARL_LOG_ASSERT("carl.thom.sign", Eigen::FullPivLU<Eigen::MatrixXf>(mMatrix).rank() == mMatrix.cols(), "mMatrix must be invertible!");
 		mProducts = adaptedProducts;
 		mNeedsUpdate = false;
@@ -282,7 +307,8 @@ private:
 			std::list<Polynomial>& products,
 			std::list<Alpha>& ada,
 			std::list<uint>& adaHelper,
-			Eigen::MatrixXf& matrix
+			Eigen::MatrixXf& matrix,
+			std::vector<Eigen::Index>& columns
 	) {
 		if(mNeedsUpdate) this->update();
 		
@@ -340,6 +366,7 @@ private:
 		Eigen::PartialPivLU<Eigen::MatrixXf> dec(M_prime);
 		Eigen::VectorXf c = dec.solve(dprime);
 		CARL_LOG_ASSERT("carl.thom.sign", (uint)c.size() == currSigns.size() * mSigns.size(), "failure in sign determination");
+		matrix = std::move(M_prime);
 		
 		std::list<SignCondition> newSigns;
 		adaHelper = std::list<uint>(mSigns.size(), 0);
@@ -348,6 +375,7 @@ private:
 			auto helper_it = adaHelper.begin();
 			for(const auto& sigma : mSigns) {
 				if ((std::round(c(k))) != 0) {
+					columns.push_back(Eigen::Index(k));
 					uint tmp = *helper_it;
 					helper_it = adaHelper.erase(helper_it);
 					helper_it = adaHelper.insert(helper_it, ++tmp);
@@ -377,7 +405,8 @@ public:
 		std::list<Alpha> dummyAda;
 		std::list<uint> dummyHelper;
 		Eigen::MatrixXf dummyMatrix;
-		std::list<SignCondition> newSigns = getSigns(p, dummyProducts, dummyAda, dummyHelper, dummyMatrix);
+		std::vector<Eigen::Index> dummyColumns;
+		std::list<SignCondition> newSigns = getSigns(p, dummyProducts, dummyAda, dummyHelper, dummyMatrix, dummyColumns);
 		return newSigns;
 	}
 	
@@ -386,12 +415,16 @@ public:
 		std::list<Alpha> newAda;
 		std::list<uint> newHelper;
 		Eigen::MatrixXf newMatrix;
-		std::list<SignCondition> newSigns = getSigns(p, newProducts, newAda, newHelper, newMatrix);
+		std::vector<Eigen::Index> newColumns;
+		std::list<SignCondition> newSigns = getSigns(p, newProducts, newAda, newHelper, newMatrix, newColumns);
 		mNeedsUpdate = true;
 		if(mP.empty()) {
 			mAda = newAda;
 			mMatrix = newMatrix;
 			mNeedsUpdate = false;
+		} else {
+			mPendingMatrix = std::move(newMatrix);
+			mPendingColumns = std::move(newColumns);
 		}
 		mP.push_front(p);
 		mSigns = newSigns;
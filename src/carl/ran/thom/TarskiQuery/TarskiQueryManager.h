@@ -7,19 +7,37 @@
 
 #pragma once
 
+#include <algorithm>
 #include <iterator>
+#include <map>
+#include <memory>
+#include <vector>
 
 #include "MultiplicationTable.h"
 #include "MultivariateTarskiQuery.h"
 #include "UnivariateTarskiQuery.h"
 
+#include <carl/config.h>
 #include <carl/core/polynomialfunctions/to_univariate_polynomial.h>
 
+#ifdef THREAD_SAFE
+#include <mutex>
+#define TARSKI_QUERY_REGISTRY_LOCK_GUARD std::lock_guard<std::mutex> registryLock(registryMutex());
+#define TARSKI_QUERY_CACHE_LOCK_GUARD std::lock_guard<std::mutex> cacheLock(mTables->mCacheMutex);
+#else
+#define TARSKI_QUERY_REGISTRY_LOCK_GUARD
+#define TARSKI_QUERY_CACHE_LOCK_GUARD
+#endif
+
 namespace carl {
         
 /*
  * The Tarski query manager is a class designed to manage the computation of Tarski queries.
  * 
+ * The multiplication table and all computed query results only depend on the zero set.
+ * They are stored in a table that is shared by all managers on the same zero set, i.e. on the same generating polynomials.
+ * This way, sign determinations for different Thom encodings on the same point reuse each other's work.
+ * If THREAD_SAFE is set, the registry and the query caches are guarded by mutexes, the remaining tables are never modified after construction.
  */ 
 template<typename Number>
 class TarskiQueryManager {
@@ -30,15 +48,67 @@ public:
 private:
         using Polynomial = MultivariatePolynomial<Number>;
         
-        // for the univariate case
-        UnivariatePolynomial<Number> mZ = UnivariatePolynomial<Number>(Variable::NO_VARIABLE);
-        UnivariatePolynomial<Number> mDer = UnivariatePolynomial<Number>(Variable::NO_VARIABLE);
+        struct Tables {
+                // for the univariate case
+                UnivariatePolynomial<Number> mZ = UnivariatePolynomial<Number>(Variable::NO_VARIABLE);
+                UnivariatePolynomial<Number> mDer = UnivariatePolynomial<Number>(Variable::NO_VARIABLE);
+                
+                // for the multivariate case
+                MultiplicationTable<Number> mTab;
+                bool mTrivialGb = false;
+                
+                std::map<Polynomial, QueryResultType> mCache;
+#ifdef THREAD_SAFE
+                std::mutex mCacheMutex;
+#endif
+        };
+        
+        std::shared_ptr<Tables> mTables = std::make_shared<Tables>();
         
-        // for the multivariate case
-        MultiplicationTable<Number> mTab;
-        bool mTrivialGb = false;
+        /*
+         * the tables of all alive managers, keyed by the normalized and sorted generators of the zero set
+         */
+        static auto& registry() {
+                static std::map<std::vector<Polynomial>, std::weak_ptr<Tables>> reg;
+                return reg;
+        }
+#ifdef THREAD_SAFE
+        static std::mutex& registryMutex() {
+                static std::mutex mutex;
+                return mutex;
+        }
+#endif
         
-        mutable std::map<Polynomial, QueryResultType> mCache;
+        /*
+         * returns the shared tables for the given zero set, or nullptr if none exist yet
+         */
+        static std::shared_ptr<Tables> lookup(const std::vector<Polynomial>& key) {
+                TARSKI_QUERY_REGISTRY_LOCK_GUARD
+                auto& reg = registry();
+                auto it = reg.find(key);
+                if(it == reg.end()) return nullptr;
+                auto res = it->second.lock();
+                if(res == nullptr) reg.erase(it);
+                return res;
+        }
+        
+        /*
+         * stores the tables for the given zero set and returns the tables to use,
+         * which are those of another manager if it stored tables for the same zero set in the meantime
+         */
+        static std::shared_ptr<Tables> store(const std::vector<Polynomial>& key, const std::shared_ptr<Tables>& tables) {
+                TARSKI_QUERY_REGISTRY_LOCK_GUARD
+                auto& reg = registry();
+                // drop entries of zero sets that are no longer used
+                for(auto it = reg.begin(); it != reg.end(); ) {
+                        if(it->second.expired()) it = reg.erase(it);
+                        else it++;
+                }
+                auto& entry = reg[key];
+                if(auto existing = entry.lock()) return existing;
+                entry = tables;
+                return tables;
+        }
         
 public:
         TarskiQueryManager() = default;
@@ -46,12 +116,21 @@ public:
         template<typename InputIt>
         TarskiQueryManager(InputIt first, InputIt last) {
                 CARL_LOG_TRACE("carl.thom.tarski.manager", "setting up a taq manager on " << std::vector<Polynomial>(first, last));
+                std::vector<Polynomial> key;
+                for(auto it = first; it != last; it++) key.push_back(it->normalize());
+                std::sort(key.begin(), key.end());
+                mTables = lookup(key);
+                if(mTables != nullptr) {
+                        CARL_LOG_TRACE("carl.thom.tarski.manager", "reusing tables with " << cacheSize() << " cached queries");
+                        return;
+                }
+                mTables = std::make_shared<Tables>();
                 // univariate manager
                 if(std::distance(first, last) == 1 && first->isUnivariate()) {
                         CARL_LOG_TRACE("carl.thom.tarski.manager", "as a UNIVARIATE manager");
-                        mZ = carl::to_univariate_polynomial(*first);
-                        CARL_LOG_ASSERT("carl.thom.tarski.manager", !carl::isZero(mZ), "");
-                        mDer = derivative(mZ);
+                        mTables->mZ = carl::to_univariate_polynomial(*first);
+                        CARL_LOG_ASSERT("carl.thom.tarski.manager", !carl::isZero(mTables->mZ), "");
+                        mTables->mDer = derivative(mTables->mZ);
                         CARL_LOG_ASSERT("carl.thom.tarski.manager", this->isUnivariateManager(), "");
                 }
                 // multivariate manager
@@ -59,7 +138,7 @@ public:
                         CARL_LOG_TRACE("carl.thom.tarski.manager", "as a MULTIVARIATE manager");
                         GroebnerBase<Number> gb(first, last);
                         if(gb.isTrivialBase()) {
-                                mTrivialGb = true;
+                                mTables->mTrivialGb = true;
                         }
                         else {
                                 CARL_LOG_ASSERT("carl.thom.tarski.manager", gb.hasFiniteMon(), "");
@@ -67,10 +146,11 @@ public:
                                         std::cout << "aborting because it was tried to set up a tarki query manager on a non zero-dimensional zero set" << std::endl;
                                         std::exit(23);
                                 }
-                                mTab = MultiplicationTable<Number>(gb);
+                                mTables->mTab = MultiplicationTable<Number>(gb);
                         }
                         CARL_LOG_ASSERT("carl.thom.tarski.manager", !this->isUnivariateManager(), "");
                 }
+                mTables = store(key, mTables);
         }
         
         QueryResultType operator()(const Polynomial& p) const {
@@ -88,19 +168,19 @@ public:
                 if(this->isUnivariateManager()) {
                         CARL_LOG_ASSERT("carl.thom.tarski.manager", p.isUnivariate(), "");
                         UnivariatePolynomial<Number> pUniv(Variable::NO_VARIABLE);
-                        if(p.isConstant()) pUniv = UnivariatePolynomial<Number>(mZ.mainVar(), p.lcoeff());
+                        if(p.isConstant()) pUniv = UnivariatePolynomial<Number>(mTables->mZ.mainVar(), p.lcoeff());
                         else pUniv = carl::to_univariate_polynomial(p);
-                        CARL_LOG_ASSERT("carl.thom.tarski.manager", pUniv.mainVar() == mZ.mainVar(),
-                                "cannot compute tarski query of " << p << " on " << mZ);
-                        res = univariateTarskiQuery(pUniv, mZ, mDer);
+                        CARL_LOG_ASSERT("carl.thom.tarski.manager", pUniv.mainVar() == mTables->mZ.mainVar(),
+                                "cannot compute tarski query of " << p << " on " << mTables->mZ);
+                        res = univariateTarskiQuery(pUniv, mTables->mZ, mTables->mDer);
                 }
                 
                 // multivariate manager
                 else {
-                        if(mTrivialGb) res = 0;
+                        if(mTables->mTrivialGb) res = 0;
                         else {
                         // todo: check if variables in p are also in the polynomials defining the zero set
-                                res = multivariateTarskiQuery(p, mTab);
+                                res = multivariateTarskiQuery(p, mTables->mTab);
                         }
                 }
                 cache(p, res);
@@ -118,25 +198,39 @@ public:
                         return a * b;
                 }
                 else {
-                        return mTab.baseReprToPolynomial(mTab.reduce(a * b));
+                        return mTables->mTab.baseReprToPolynomial(mTables->mTab.reduce(a * b));
                 }
                 
         }
         
-
+        /*
+         * number of query results stored for this zero set
+         */
+        std::size_t cacheSize() const {
+                TARSKI_QUERY_CACHE_LOCK_GUARD
+                return mTables->mCache.size();
+        }
+        
+        /*
+         * checks whether both managers share their tables
+         */
+        bool sharesTablesWith(const TarskiQueryManager& other) const {
+                return mTables == other.mTables;
+        }
         
 private:
         
         bool isUnivariateManager() const {
-                return !carl::isZero(mZ);
+                return !carl::isZero(mTables->mZ);
         }
         
         /*
          * looks for the normalization of p in the cache
          */
         bool getCached(const Polynomial& p, QueryResultType& res) const {
-                auto it = mCache.find(p.normalize());
-                if(it != mCache.end()) {
+                TARSKI_QUERY_CACHE_LOCK_GUARD
+                auto it = mTables->mCache.find(p.normalize());
+                if(it != mTables->mCache.end()) {
 						res = int(sgn(p.lcoeff())) * (it->second);
                         return true;
                 }
@@ -147,9 +241,13 @@ private:
          * writes normalized p with correspoding result in cache
          */
         void cache(const Polynomial& p, const QueryResultType res) const {
-                mCache.insert(std::make_pair(p.normalize(), int(sgn(p.lcoeff())) * res));
+                TARSKI_QUERY_CACHE_LOCK_GUARD
+                mTables->mCache.insert(std::make_pair(p.normalize(), int(sgn(p.lcoeff())) * res));
         }
         
 }; // class TarskiQueryManager
 
 } // namespace carl
+
+#undef TARSKI_QUERY_REGISTRY_LOCK_GUARD
+#undef TARSKI_QUERY_CACHE_LOCK_GUARD
@@ -9,6 +9,7 @@
 
 #include <carl/core/Sign.h>
 #include <carl/core/UnivariatePolynomial.h>
+#include <carl/core/polynomialfunctions/SturmSequence.h>
 
 namespace carl {
 
@@ -57,7 +57,7 @@ public:
 		mMainVar(mainVar), mPoint(std::move(point))
 	{
 		Polynomial p = Polynomial(mainVar) - n;
-		std::list<ThomEncoding<Number>> roots = realRootsThom(p, mainVar, point);
+		std::list<ThomEncoding<Number>> roots = realRootsThom(p, mainVar, mPoint);
 		CARL_LOG_ASSERT("carl.thom", roots.size() == 1, "");
 		mSc = roots.front().mSc;
 		mP = roots.front().mP;
@@ -475,7 +475,6 @@ public:
 		CARL_LOG_ASSERT("carl.thom.samples", lhs.mMainVar == rhs.mMainVar, "no intermediate point between encodings on different levels!");
 		CARL_LOG_ASSERT("carl.thom.samples", lhs < rhs, "lhs >= rhs !!!");
 		Number epsilon(INITIAL_OFFSET);
-		std::cout << "epsilon = " << epsilon << std::endl;
 		// pick the polynomial with smaller degree here (or lhs, if equal degree)
 		if(lhs.mP.degree(lhs.mMainVar) <= rhs.mP.degree(rhs.mMainVar)) {
 			ThomEncoding<Number> res = lhs + epsilon;
@@ -489,7 +488,6 @@ public:
 		else {
 			epsilon = -epsilon;
 			ThomEncoding<Number> res = rhs + epsilon;
-			std::cout << "res = " << res << std::endl;
 			while(lhs >= res) {
 				epsilon /= 2;
 				res = rhs + epsilon;
@@ -10,15 +10,12 @@
 #include <carl/interval/Interval.h>
 #include "ThomEncoding.h"
 #include "ThomUtil.h"
-#include "ran_thom.h"
 
 namespace carl {
         
 // forward declarations
 template<typename Number>
 class ThomEncoding;
-template<typename Number>
-class RealAlgebraicNumber;
   
 
 template<typename Number>
@@ -241,132 +238,4 @@ std::list<ThomEncoding<Number>> realRootsThom(
         return result;
 }
 
-/*
- * Interface to the Thom mechanism used in the CAD.
- * 
- * Input:
- *      A (possibly multivariate) polynomial p represented with respect
- *      to the variable of the current level.
- *      A mapping m from a set of variables to a set of RANs that are either
- *      represented explicitly or as Thom encodings. All variables of p that
- *      are not the main variable must appear in m.
- *      An interval where we are looking for roots.
- * 
- * Output:
- *      The list of RANs representing the real roots of the univariate polynomial
- *      obtained by substituting the coeffcients of p according to m.
- *      
- * Overview:
- *      1. Plug in all RANs in m which are explicitly represented into p
- *      2. If the resulting polynomial has at most degree 2, try to solve trivial
- *      3. Use the remaining Thom encodings in m to construct a real alg. point
- *         represented as a Thom encoding
- *      4. Determine roots according to this point
- */
-        
-
-template<typename Coeff, typename Number>
-std::list<RealAlgebraicNumber<Number>> realRootsThom(
-		const UnivariatePolynomial<Coeff>& p,
-		const std::map<Variable, RealAlgebraicNumber<Number>>& m,
-		const Interval<Number>& interval
-) {
-        CARL_LOG_TRACE("carl.thom.rootfinder", p << " in " << p.mainVar() << ", " << m << ", " << interval);
-	assert(m.count(p.mainVar()) == 0);
-        assert(!p.isZero());
-        
-        std::list<ThomEncoding<Number>> roots;
-        
-        UnivariatePolynomial<Coeff> tmp(p);
-	std::map<Variable, ThomEncoding<Number>> TEmap;
-	
-	for (Variable v: tmp.gatherVariables()) {
-		if (v == p.mainVar()) continue;
-		assert(m.count(v) > 0);
-		if (m.at(v).is_numeric()) {
-			tmp.substituteIn(v, Coeff(m.at(v).value()));
-		} else {
-			TEmap.emplace(v, m.at(v).getThomEncoding());
-		}
-	}
-        CARL_LOG_TRACE("carl.thom.rootfinder", "TEmap = " << TEmap);
-        CARL_LOG_TRACE("carl.thom.rootfinder", "tmp = " << tmp);
-        std::list<RealAlgebraicNumber<Number>> roots_triv;
-        if(tmp.gatherVariables().size() <= 1) {
-                if(tmp.isZero()) return {RealAlgebraicNumber<Number>(0)};
-                assert(tmp.gatherVariables().size() == 1);
-                 // Coeff = MultivariatePolynomial<Number>, but all coefficients of tmp are numerical
-                UnivariatePolynomial<Number> tmp_univ = tmp.convert(std::function<Number(const Coeff&)>([](const Coeff& c){ assert(c.isUnivariate()); return c.constantPart(); }));
-                if(tmp_univ.zeroIsRoot()) {
-                        roots_triv.push_back(RealAlgebraicNumber<Number>(0));
-                        tmp_univ.eliminateZeroRoots();
-                }
-                CARL_LOG_TRACE("carl.thom.rootfinder", "tmp_univ = " << tmp_univ);
-                switch (tmp_univ.degree()) {
-                        case 0: {
-                                CARL_LOG_TRACE("carl.thom.rootfinder", "roots_triv = " << roots_triv);
-                                return roots_triv;
-                        }
-                        case 1: {
-                                Number a = tmp_univ.coefficients()[1], b = tmp_univ.coefficients()[0];
-                                assert(a != Number(0));
-                                roots_triv.push_back(RealAlgebraicNumber<Number>(-b / a));
-                                CARL_LOG_TRACE("carl.thom.rootfinder", "roots_triv = " << roots_triv);
-                                return roots_triv;
-                        }
-                        case 2: {
-                                Number a = tmp_univ.coefficients()[2], b = tmp_univ.coefficients()[1], c = tmp_univ.coefficients()[0];
-                                assert(a != Number(0));
-                                CARL_LOG_TRACE("carl.thom.rootfinder", "a = " << a << ", b = " << b << ", c = " << c);
-                                /* Use this formulation of p-q-formula:
-                                 * x = ( -b +- \sqrt{ b*b - 4*a*c } ) / (2*a)
-                                 */
-                                Number rad = b*b - 4*a*c;
-                                if (rad == 0) {
-                                        roots_triv.push_back(RealAlgebraicNumber<Number>(-b / (2*a)));
-                                        CARL_LOG_TRACE("carl.thom.rootfinder", "roots_triv = " << roots_triv);
-                                        return roots_triv;
-                                }
-                                /*
-                                else if (rad > 0) {
-                                        std::pair<Number, Number> res = carl::sqrt_fast(rad);
-                                        CARL_LOG_TRACE("carl.thom.rootfinder", "carl::sqrt_fast(rad) returned " << res);
-                                        if (res.first == res.second) {
-                                                // Root could be calculated exactly
-                                                roots_triv.push_back(RealAlgebraicNumber<Number>((-b - res.first) / (2*a)));
-                                                roots_triv.push_back(RealAlgebraicNumber<Number>((-b + res.first) / (2*a)));
-                                                CARL_LOG_TRACE("carl.thom.rootfinder", "roots_triv = " << roots_triv);
-                                                return roots_triv;
-                                        }
-                                }
-                                */
-                                break;
-                        }
-                }
-               
-                roots = realRootsThom<Number>(MultivariatePolynomial<Number>(tmp_univ), tmp_univ.mainVar(), nullptr, interval);
-                
-        }
-        else {
-                // need to perform 'real' lifting
-                
-                MultivariatePolynomial<Number> p_multiv(tmp);
-                //std::cout << "p_multiv = " << p_multiv << std::endl;
-
-                roots = realRootsThom(p_multiv, p.mainVar(), TEmap, interval);
-        }
-        
-        
-        
-	std::list<RealAlgebraicNumber<Number>> res;
-        for(const auto& te : roots) res.push_back(RealAlgebraicNumber<Number>(te));
-        for(const auto& number : roots_triv) res.push_back(number);
-        
-        CARL_LOG_TRACE("carl.thom.rootfinder", "found the following roots: " << res);
-        
-        return res;
-}
-
-
-        
 } // namespace carl
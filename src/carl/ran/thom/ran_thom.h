@@ -1,235 +1,354 @@
 #pragma once
 
+/**
+ * @file ran_thom.h
+ * This file contains real_algebraic_number_thom, a representation of real algebraic numbers by Thom encodings.
+ * A Thom encoding identifies a root of a polynomial by the signs of its derivatives in this root.
+ * Comparisons and signs are answered by sign determination on the Tarski query tables that all encodings on the same zero set share.
+ */
+
 #include "ThomEncoding.h"
-#include "../ran_operations.h"
 
+#include <carl/core/polynomialfunctions/SquareFreePart.h>
+#include <carl/core/polynomialfunctions/to_univariate_polynomial.h>
+#include <carl/interval/Interval.h>
+
+#include "../ran_common.h"
+#include "../ran_operations.h"
+#include "../ran_operations_number.h"
 
 #include <memory>
+#include <optional>
 
 namespace carl {
 
-// TODO adapt to new interface
+template<typename Number>
+class real_algebraic_number_thom;
 
+namespace ran::thom {
+	/// Converts the result of comparing two Thom encodings to the sign of their difference.
+	inline Sign to_sign(ThomComparisonResult res) {
+		switch (res) {
+			case LESS: return Sign::NEGATIVE;
+			case EQUAL: return Sign::ZERO;
+			default: return Sign::POSITIVE;
+		}
+	}
+
+	/**
+	 * Returns a Thom encoding of the same number with main variable v.
+	 * Only encodings of dimension one can be moved to another variable, as the main variables of lifted encodings are fixed by their underlying point.
+	 */
+	template<typename Number>
+	ThomEncoding<Number> in_variable(const ThomEncoding<Number>& te, Variable v) {
+		if (te.mainVar() == v) return te;
+		assert(te.dimension() == 1);
+		auto p = carl::substitute(te.polynomial(), te.mainVar(), MultivariatePolynomial<Number>(v));
+		for (const auto& r: realRootsThom(p, v)) {
+			if (r.relevantSignCondition() == te.relevantSignCondition()) return r;
+		}
+		CARL_LOG_ASSERT("carl.ran.thom", false, "No root of " << p << " has the sign condition of " << te);
+		return te;
+	}
+}
+
+/**
+ * Represents a real algebraic number by a Thom encoding, or explicitly if it is known to be rational.
+ * Thom encodings of dimension one encode a root of a univariate polynomial.
+ * Roots obtained by lifting over an assignment are encoded over the point of the assignment and can be compared with numbers over the same point.
+ *
+ * Thom encodings do not provide isolating intervals, hence floor and ceil are found by comparisons with integers.
+ */
 template<typename Number>
-struct real_algebraic_number_thom {
+class real_algebraic_number_thom {
+	using Polynomial = UnivariatePolynomial<Number>;
+	static const Variable auxVariable;
+
 	template<typename Num>
-	friend bool operator==(const real_algebraic_number_thom<Num>& lhs, const real_algebraic_number_thom<Num>& rhs);
+	friend bool compare(const real_algebraic_number_thom<Num>&, const real_algebraic_number_thom<Num>&, const Relation);
+
 	template<typename Num>
-	friend bool operator<(const real_algebraic_number_thom<Num>& lhs, const real_algebraic_number_thom<Num>& rhs);
+	friend bool compare(const real_algebraic_number_thom<Num>&, const Num&, const Relation);
+
 private:
-	struct Content {
-		ThomEncoding<Number> te;
+	struct content {
+		/// The value, if the number is numeric.
+		std::optional<Number> value;
+		/// The Thom encoding, if the number is not numeric.
+		std::optional<ThomEncoding<Number>> te;
+		/// The largest integer not larger than the number, computed on demand.
+		std::optional<Number> floor;
 
-		Content(const ThomEncoding<Number>& t):
-			te(t)
-		{}
+		explicit content(const Number& n): value(n) {}
+		explicit content(const ThomEncoding<Number>& t): te(t) {}
 	};
-	std::shared_ptr<Content> mContent;
-public:
-	real_algebraic_number_thom(const ThomEncoding<Number>& te):
-		mContent(std::make_shared<Content>(te))
-	{}
 
-	auto& thom_encoding() {
-		return mContent->te;
+	std::shared_ptr<content> m_content;
+
+	/// Compares the number to an integer, which is cheaper than comparing two encodings.
+	Sign compare_internal(const Number& n) const {
+		if (is_numeric()) return carl::sgn(Number(value() - n));
+		return ran::thom::to_sign(ThomEncoding<Number>::compareRational(thom_encoding(), n));
+	}
+
+	/// Computes the largest integer not larger than the number by exponential and binary search.
+	Number compute_floor() const {
+		if (is_numeric()) return carl::floor(value());
+		Number lower(0);
+		Number upper(1);
+		if (compare_internal(lower) == Sign::NEGATIVE) {
+			upper = lower;
+			lower = Number(-1);
+			while (compare_internal(lower) == Sign::NEGATIVE) {
+				upper = lower;
+				lower *= 2;
+			}
+		} else {
+			while (compare_internal(upper) != Sign::NEGATIVE) {
+				lower = upper;
+				upper *= 2;
+			}
+		}
+		// now: lower <= this < upper
+		while (upper - lower > 1) {
+			Number mid = carl::floor((lower + upper) / 2);
+			if (compare_internal(mid) == Sign::NEGATIVE) {
+				upper = mid;
+			} else {
+				lower = mid;
+			}
+		}
+		return lower;
 	}
-	const auto& thom_encoding() const {
-		return mContent->te;
+
+public:
+	real_algebraic_number_thom()
+		: m_content(std::make_shared<content>(Number(0)))
+	{}
+	real_algebraic_number_thom(const Number& n)
+		: m_content(std::make_shared<content>(n))
+	{}
+	real_algebraic_number_thom(const ThomEncoding<Number>& te)
+		: m_content(std::make_shared<content>(te))
+	{}
+	/**
+	 * Creates the unique root of p within the open interval i.
+	 */
+	real_algebraic_number_thom(const Polynomial& p, const Interval<Number>& i) {
+		assert(!carl::isZero(p) && p.degree() > 0);
+		if (p.degree() == 1) {
+			m_content = std::make_shared<content>(Number(-p.coefficients()[0] / p.coefficients()[1]));
+			return;
+		}
+		auto roots = realRootsThom(MultivariatePolynomial<Number>(p), p.mainVar(), std::map<Variable, ThomEncoding<Number>>(), i);
+		assert(roots.size() == 1);
+		m_content = std::make_shared<content>(roots.front());
 	}
 
-	const auto& polynomial() const {
-		return thom_encoding().polynomial();
+	real_algebraic_number_thom(const real_algebraic_number_thom& ran) = default;
+	real_algebraic_number_thom(real_algebraic_number_thom&& ran) = default;
+
+	real_algebraic_number_thom& operator=(const real_algebraic_number_thom& n) = default;
+	real_algebraic_number_thom& operator=(real_algebraic_number_thom&& n) = default;
+
+	static real_algebraic_number_thom<Number> create_safe(const Polynomial& p, const Interval<Number>& i) {
+		return real_algebraic_number_thom<Number>(carl::squareFreePart(p), i);
 	}
-	const auto& mainVar() const {
-		return thom_encoding().mainVar();
+
+	bool is_numeric() const {
+		return m_content->value.has_value();
 	}
-	auto sign_condition() const {
-		return thom_encoding().signCondition();
+	const Number& value() const {
+		assert(is_numeric());
+		return *m_content->value;
 	}
-	const auto& point() const {
-		return thom_encoding().point();
+	const ThomEncoding<Number>& thom_encoding() const {
+		assert(!is_numeric());
+		return *m_content->te;
 	}
-
-	std::size_t size() const {
-		return thom_encoding().dimension();
+	/**
+	 * The defining polynomial, only available for numbers that are not lifted over a point.
+	 */
+	Polynomial polynomial() const {
+		if (is_numeric()) {
+			return Polynomial(auxVariable, {-value(), Number(1)});
+		}
+		assert(thom_encoding().dimension() == 1);
+		return carl::to_univariate_polynomial(thom_encoding().polynomial());
 	}
-
 	std::size_t dimension() const {
+		if (is_numeric()) return 0;
 		return thom_encoding().dimension();
 	}
 
+	bool is_zero() const {
+		return sgn() == Sign::ZERO;
+	}
 	bool is_integral() const {
-		return thom_encoding().is_integral();
+		if (is_numeric()) return carl::isInteger(value());
+		return compare_internal(integer_below()) == Sign::ZERO;
 	}
-	bool is_zero() const {
-		return thom_encoding().is_zero();
+	Number integer_below() const {
+		if (!m_content->floor) {
+			m_content->floor = compute_floor();
+		}
+		return *m_content->floor;
 	}
-	bool contained_in(const Interval<Number>& i) const {
-		return thom_encoding().containedIn(i);
+
+	real_algebraic_number_thom<Number> abs() const {
+		if (sgn() != Sign::NEGATIVE) return *this;
+		if (is_numeric()) return real_algebraic_number_thom<Number>(-value());
+		// the roots of p(-x) are the negated roots of p in reverse order
+		const auto& te = thom_encoding();
+		MultivariatePolynomial<Number> v(te.mainVar());
+		std::shared_ptr<ThomEncoding<Number>> point = te.dimension() > 1 ? std::make_shared<ThomEncoding<Number>>(te.point()) : nullptr;
+		auto roots = realRootsThom(te.polynomial(), te.mainVar(), point);
+		auto negated = realRootsThom(carl::substitute(te.polynomial(), te.mainVar(), -v), te.mainVar(), point);
+		assert(roots.size() == negated.size());
+		auto it = negated.rbegin();
+		for (const auto& r: roots) {
+			if (r.equals(te)) return real_algebraic_number_thom<Number>(*it);
+			++it;
+		}
+		CARL_LOG_ASSERT("carl.ran.thom", false, te << " is not a root of its polynomial");
+		return *this;
 	}
 
-	Number integer_below() const {
-		return thom_encoding().integer_below();
+	std::size_t size() const {
+		if (is_numeric()) return carl::bitsize(value());
+		return thom_encoding().polynomial().size();
 	}
+
 	Sign sgn() const {
+		if (is_numeric()) return carl::sgn(value());
 		return thom_encoding().sgn();
 	}
-	Sign sgn(const UnivariatePolynomial<Number>& p) const {
-		return thom_encoding().sgn(p);
+	Sign sgn(const Polynomial& p) const {
+		if (is_numeric()) return carl::sgn(carl::evaluate(p, value()));
+		const auto& te = thom_encoding();
+		return te.sgn(carl::substitute(MultivariatePolynomial<Number>(p), p.mainVar(), MultivariatePolynomial<Number>(te.mainVar())));
+	}
+
+	bool contained_in(const Interval<Number>& i) const {
+		if (is_numeric()) return i.contains(value());
+		return thom_encoding().containedIn(i);
 	}
 };
 
 template<typename Number>
-Number branching_point(const real_algebraic_number_thom<Number>& n) {
-	return n.thom_encoding().get_number();
+Number floor(const real_algebraic_number_thom<Number>& n) {
+	return n.integer_below();
 }
-
 template<typename Number>
-Number evaluate(const MultivariatePolynomial<Number>& p, std::map<Variable, real_algebraic_number_thom<Number>>& m) {
-	//using Polynomial = MultivariatePolynomial<Number>;
-	
-	CARL_LOG_INFO("carl.ran.thom",
-			"\n****************************\n"
-			<< "Thom evaluate\n"
-			<< "****************************\n"
-			<< "p = " << p << "\n"
-			<< "m = " << m << "\n"
-			<< "****************************\n");
-	for(const auto& entry : m) { 
-		assert(entry.first == entry.second.thom_encoding().mainVar());
-	}
-	assert(m.size() > 0);
-	
-	std::map<Variable, real_algebraic_number_thom<Number>>& m_prime(m);
-	auto it = m_prime.begin();
-	while(it != m_prime.end()) {
-			if(!p.has(it->first)) {
-					CARL_LOG_TRACE("carl.thom.evaluation", "removing " << it->first);
-					it = m_prime.erase(it);
+Number ceil(const real_algebraic_number_thom<Number>& n) {
+	if (n.is_integral()) return n.integer_below();
+	return n.integer_below() + 1;
+}
+
+namespace ran::thom {
+	/**
+	 * Returns a rational number strictly between lower and upper, which are numbers or real_algebraic_number_thom.
+	 * Integers are preferred, otherwise the interval between the enclosing integers is bisected.
+	 */
+	template<typename Number, typename Lower, typename Upper>
+	Number sample_between(const Lower& lower, const Upper& upper) {
+		assert(lower < upper);
+		Number lo = carl::floor(lower);
+		Number hi = carl::ceil(upper);
+		Number next = lo + 1;
+		if (lower < next && next < upper) return next;
+		while (true) {
+			Number mid = (lo + hi) / 2;
+			if (mid <= lower) {
+				lo = mid;
+			} else if (mid >= upper) {
+				hi = mid;
 			} else {
-					it++;
+				return mid;
 			}
+		}
 	}
-	
-	std::map<Variable, ThomEncoding<Number>> mTE;
-	for(const auto& entry : m_prime) {
-			mTE.insert(std::make_pair(entry.first, entry.second.thom_encoding()));
-	}
-	
-	CARL_LOG_ASSERT("carl.thom.evaluation", p.gatherVariables().size() == mTE.size(), "p = " << p << ", mTE = " << mTE);
-	
-	if(mTE.size() == 1) {
-			int sgn = int(mTE.begin()->second.signOnPolynomial(p));
-			CARL_LOG_TRACE("carl.thom.evaluation", "sign of evaluated polynomial is " << sgn);
-			return Number(sgn);
-	}
-	
-	CARL_LOG_TRACE("carl.thom.evaluation", "mTE = " << mTE);
-	
-	ThomEncoding<Number> point = ThomEncoding<Number>::analyzeTEMap(mTE);
-	int sgn = int(point.signOnPolynomial(p));
-	CARL_LOG_TRACE("carl.thom.", "sign of evaluated polynomial is " << sgn);
-	return Number(sgn);
-	
-}
-
-template<typename Number, typename Poly>
-bool evaluate(const Constraint<Poly>& c, std::map<Variable, real_algebraic_number_thom<Number>>& m) {
-	auto res = evaluate(c.lhs(), m);
-	return evaluate(res, c.relation());
 }
 
 template<typename Number>
-real_algebraic_number_thom<Number> abs(const real_algebraic_number_thom<Number>& n) {
-	assert(false);
-	return n;
+Number branching_point(const real_algebraic_number_thom<Number>& n) {
+	if (n.is_numeric()) return n.value();
+	return n.integer_below();
 }
 
 template<typename Number>
-real_algebraic_number_thom<Number> sample_above(const real_algebraic_number_thom<Number>& n) {
-	return n.thom_encoding() + Number(1);
+Number sample_above(const real_algebraic_number_thom<Number>& n) {
+	return n.integer_below() + 1;
 }
 template<typename Number>
-real_algebraic_number_thom<Number> sample_below(const real_algebraic_number_thom<Number>& n) {
-	return n.thom_encoding() + Number(-1);
+Number sample_below(const real_algebraic_number_thom<Number>& n) {
+	if (n.is_integral()) return n.integer_below() - 1;
+	return n.integer_below();
 }
 template<typename Number>
-real_algebraic_number_thom<Number> sample_between(const real_algebraic_number_thom<Number>& lower, const real_algebraic_number_thom<Number>& upper) {
-	return ThomEncoding<Number>::intermediatePoint(lower.thom_encoding(), upper.thom_encoding());
+Number sample_between(const real_algebraic_number_thom<Number>& lower, const real_algebraic_number_thom<Number>& upper) {
+	return ran::thom::sample_between<Number>(lower, upper);
 }
 template<typename Number>
 Number sample_between(const real_algebraic_number_thom<Number>& lower, const Number& upper) {
-	return ThomEncoding<Number>::intermediatePoint(lower.thom_encoding(), upper);
+	return ran::thom::sample_between<Number>(lower, upper);
 }
 template<typename Number>
 Number sample_between(const Number& lower, const real_algebraic_number_thom<Number>& upper) {
-	return ThomEncoding<Number>::intermediatePoint(lower, upper.thom_encoding());
-}
-
-template<typename Number>
-Number floor(const real_algebraic_number_thom<Number>& n) {
-	return carl::floor(get_interval(n).lower());
-}
-template<typename Number>
-Number ceil(const real_algebraic_number_thom<Number>& n) {
-	return carl::ceil(get_interval(n).upper());
-}
-
-template<typename Number>
-bool operator==(const real_algebraic_number_thom<Number>& lhs, const real_algebraic_number_thom<Number>& rhs) {
-	if (lhs.mContent.get() == rhs.mContent.get()) return true;
-	return lhs.thom_encoding() == rhs.thom_encoding();
+	return ran::thom::sample_between<Number>(lower, upper);
 }
 
 template<typename Number>
-bool operator==(const real_algebraic_number_thom<Number>& lhs, const Number& rhs) {
-	return lhs.thom_encoding() == rhs;
-}
-
-template<typename Number>
-bool operator==(const Number& lhs, const real_algebraic_number_thom<Number>& rhs) {
-	return lhs == rhs.thom_encoding();
-}
-
-template<typename Number>
-bool operator<(const real_algebraic_number_thom<Number>& lhs, const real_algebraic_number_thom<Number>& rhs) {
-	if (lhs.mContent.get() == rhs.mContent.get()) return false;
-	return lhs.thom_encoding() < rhs.thom_encoding();
-}
-
-template<typename Number>
-bool operator<(const real_algebraic_number_thom<Number>& lhs, const Number& rhs) {
-	return lhs.thom_encoding() == rhs;
+bool compare(const real_algebraic_number_thom<Number>& lhs, const real_algebraic_number_thom<Number>& rhs, const Relation relation) {
+	CARL_LOG_DEBUG("carl.ran.thom", "Compare " << lhs << " " << relation << " " << rhs);
+	if (lhs.m_content.get() == rhs.m_content.get()) {
+		return evaluate(Sign::ZERO, relation);
+	}
+	if (lhs.is_numeric()) {
+		return compare(rhs, lhs.value(), inverse(relation));
+	}
+	if (rhs.is_numeric()) {
+		return compare(lhs, rhs.value(), relation);
+	}
+	const auto& l = lhs.thom_encoding();
+	const auto& r = rhs.thom_encoding();
+	if (l.mainVar() != r.mainVar()) {
+		// encodings of the same level are compared by their values, hence univariate encodings are moved to the variable of the other one
+		if (r.dimension() == 1) {
+			return evaluate(ran::thom::to_sign(ThomEncoding<Number>::compare(l, ran::thom::in_variable(r, l.mainVar()))), relation);
+		}
+		if (l.dimension() == 1) {
+			return evaluate(ran::thom::to_sign(ThomEncoding<Number>::compare(ran::thom::in_variable(l, r.mainVar()), r)), relation);
+		}
+	}
+	return evaluate(ran::thom::to_sign(ThomEncoding<Number>::compare(l, r)), relation);
 }
 
 template<typename Number>
-bool operator<(const Number& lhs, const real_algebraic_number_thom<Number>& rhs) {
-	return lhs == rhs.thom_encoding();
+bool compare(const real_algebraic_number_thom<Number>& lhs, const Number& rhs, const Relation relation) {
+	return evaluate(lhs.compare_internal(rhs), relation);
 }
 
 template<typename Num>
-std::ostream& operator<<(std::ostream& os, const real_algebraic_number_thom<Num>& rhs) {
-	os << "(TE " << rhs.polynomial() << " in " << rhs.mainVar() << ", " << rhs.sign_condition();
-	if (rhs.dimension() > 1) {
-		os << " OVER " << rhs.point();
+std::ostream& operator<<(std::ostream& os, const real_algebraic_number_thom<Num>& ran) {
+	if (ran.is_numeric()) {
+		return os << "(NR " << ran.value() << ")";
 	}
-	os << ")";
-	return os;
+	return os << "(" << ran.thom_encoding() << ")";
 }
 
 template<typename Number>
-struct is_ran<real_algebraic_number_thom<Number>> { 
-  static const bool value = true;
-};
+const Variable real_algebraic_number_thom<Number>::auxVariable = freshRealVariable("__r");
 
+template<typename Number>
+struct is_ran<real_algebraic_number_thom<Number>>: std::true_type {};
 }
 
-
 namespace std {
 template<typename Number>
-struct hash<carl::real_algebraic_number_z3<Number>> {
-    std::size_t operator()(const carl::real_algebraic_number_z3<Number>& n) const {
+struct hash<carl::real_algebraic_number_thom<Number>> {
+	std::size_t operator()(const carl::real_algebraic_number_thom<Number>& n) const {
 		return carl::hash_all(n.integer_below());
 	}
 };
-}
\ No newline at end of file
+}
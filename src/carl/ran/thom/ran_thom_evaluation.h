@@ -0,0 +1,80 @@
+#pragma once
+
+/**
+ * @file ran_thom_evaluation.h
+ * Evaluation of polynomials and constraints over real algebraic numbers represented by Thom encodings.
+ * The assigned encodings are combined into a single point, on which signs are determined using the shared Tarski query tables.
+ */
+
+#include "ran_thom.h"
+
+#include <carl/formula/Constraint.h>
+
+#include <boost/logic/tribool.hpp>
+
+namespace carl {
+
+namespace ran::thom {
+	/**
+	 * Substitutes the numeric values of m into p and collects the Thom encodings of the remaining assigned variables of p.
+	 * The encodings are moved to the variables they are assigned to.
+	 * @return false, if p contains a variable that is not assigned.
+	 */
+	template<typename Number>
+	bool prepare_evaluation(MultivariatePolynomial<Number>& p, const ran::ran_assignment_t<real_algebraic_number_thom<Number>>& m, std::map<Variable, ThomEncoding<Number>>& encodings) {
+		for (const auto& [var, ran]: m) {
+			if (!p.has(var)) continue;
+			if (ran.is_numeric()) {
+				substitute_inplace(p, var, MultivariatePolynomial<Number>(ran.value()));
+			}
+		}
+		for (Variable v: carl::variables(p)) {
+			auto it = m.find(v);
+			if (it == m.end()) return false;
+			encodings.emplace(v, in_variable(it->second.thom_encoding(), v));
+		}
+		return true;
+	}
+}
+
+/**
+ * Evaluate the given polynomial with the given values for the variables.
+ * The value is the unique root of y - p over the point defined by m, hence it is encoded over this point.
+ * Returns std::nullopt if some unassigned variables are still contained in p after plugging in m.
+ */
+template<typename Number>
+std::optional<real_algebraic_number_thom<Number>> evaluate(MultivariatePolynomial<Number> p, const ran::ran_assignment_t<real_algebraic_number_thom<Number>>& m, bool = true) {
+	CARL_LOG_DEBUG("carl.ran.thom", "Evaluating " << p << " on " << m);
+	std::map<Variable, ThomEncoding<Number>> encodings;
+	if (!ran::thom::prepare_evaluation(p, m, encodings)) {
+		return std::nullopt;
+	}
+	if (p.isNumber()) {
+		return real_algebraic_number_thom<Number>(p.constantPart());
+	}
+	auto point = std::make_shared<ThomEncoding<Number>>(ThomEncoding<Number>::analyzeTEMap(encodings));
+	Variable y = freshRealVariable();
+	auto roots = realRootsThom(MultivariatePolynomial<Number>(y) - p, y, point);
+	assert(roots.size() == 1);
+	return real_algebraic_number_thom<Number>(roots.front());
+}
+
+template<typename Number, typename Poly>
+boost::tribool evaluate(const Constraint<Poly>& c, const ran::ran_assignment_t<real_algebraic_number_thom<Number>>& m, bool = true, bool = true) {
+	CARL_LOG_DEBUG("carl.ran.thom", "Evaluating " << c << " on " << m);
+	MultivariatePolynomial<Number> p(c.lhs());
+	std::map<Variable, ThomEncoding<Number>> encodings;
+	if (!ran::thom::prepare_evaluation(p, m, encodings)) {
+		return boost::indeterminate;
+	}
+	if (p.isNumber()) {
+		return carl::evaluate(p.constantPart(), c.relation());
+	}
+	if (encodings.size() == 1) {
+		return carl::evaluate(encodings.begin()->second.signOnPolynomial(p), c.relation());
+	}
+	ThomEncoding<Number> point = ThomEncoding<Number>::analyzeTEMap(encodings);
+	return carl::evaluate(point.signOnPolynomial(p), c.relation());
+}
+
+}
@@ -0,0 +1,123 @@
+#pragma once
+
+/**
+ * @file ran_thom_real_roots.h
+ * Real root isolation for real algebraic numbers represented by Thom encodings.
+ * Roots over an assignment are lifted over the point that the assigned encodings define.
+ */
+
+#include "ran_thom.h"
+#include "ran_thom_evaluation.h"
+
+#include "../real_roots_common.h"
+
+#include <map>
+
+namespace carl::ran::thom {
+
+namespace detail {
+	template<typename Number>
+	real_roots_result<real_algebraic_number_thom<Number>> from_encodings(const std::list<ThomEncoding<Number>>& encodings) {
+		std::vector<real_algebraic_number_thom<Number>> roots(encodings.begin(), encodings.end());
+		return real_roots_result<real_algebraic_number_thom<Number>>::roots_response(std::move(roots));
+	}
+}
+
+/**
+ * Find all real roots of a univariate 'polynomial' with numeric coefficients within a given 'interval'.
+ * The roots are sorted in ascending order.
+ */
+template<typename Coeff, typename Number = typename UnderlyingNumberType<Coeff>::type, EnableIf<std::is_same<Coeff, Number>> = dummy>
+real_roots_result<real_algebraic_number_thom<Number>> real_roots(
+		const UnivariatePolynomial<Coeff>& polynomial,
+		const Interval<Number>& interval = Interval<Number>::unboundedInterval()
+) {
+	using result = real_roots_result<real_algebraic_number_thom<Number>>;
+	if (carl::isZero(polynomial)) {
+		return result::nullified_response();
+	}
+	if (polynomial.isConstant()) {
+		return result::no_roots_response();
+	}
+	CARL_LOG_DEBUG("carl.ran.thom", polynomial << " within " << interval);
+	if (polynomial.degree() == 1) {
+		Number root = -polynomial.coefficients()[0] / polynomial.coefficients()[1];
+		if (!interval.contains(root)) {
+			return result::no_roots_response();
+		}
+		return result::roots_response({ real_algebraic_number_thom<Number>(root) });
+	}
+	return detail::from_encodings(realRootsThom(MultivariatePolynomial<Number>(polynomial), polynomial.mainVar(), std::map<Variable, ThomEncoding<Number>>(), interval));
+}
+
+/**
+ * Find all real roots of a univariate 'polynomial' with non-numeric coefficients within a given 'interval'.
+ * However, all coefficients must be types that contain numeric numbers that are retrievable by using .constantPart();
+ * The roots are sorted in ascending order.
+ */
+template<typename Coeff, typename Number = typename UnderlyingNumberType<Coeff>::type, DisableIf<std::is_same<Coeff, Number>> = dummy>
+real_roots_result<real_algebraic_number_thom<Number>> real_roots(
+		const UnivariatePolynomial<Coeff>& polynomial,
+		const Interval<Number>& interval = Interval<Number>::unboundedInterval()
+) {
+	assert(polynomial.isUnivariate());
+	return real_roots(polynomial.convert(std::function<Number(const Coeff&)>([](const Coeff& c){ return c.constantPart(); })), interval);
+}
+
+/**
+ * Find all real roots of a polynomial 'poly' with respect to the assignment 'varToRANMap' within a given 'interval'.
+ * The roots are sorted in ascending order.
+ * Roots that depend on irrational assignments are encoded over the point of these assignments.
+ * Returns a real_roots_result indicating whether the roots could be isolated or the polynomial
+ * was not univariate or is nullified.
+ */
+template<typename Coeff, typename Number>
+real_roots_result<real_algebraic_number_thom<Number>> real_roots(
+		const UnivariatePolynomial<Coeff>& poly,
+		const ran::ran_assignment_t<real_algebraic_number_thom<Number>>& varToRANMap,
+		const Interval<Number>& interval = Interval<Number>::unboundedInterval()
+) {
+	using result = real_roots_result<real_algebraic_number_thom<Number>>;
+	CARL_LOG_FUNC("carl.ran.thom", poly << " in " << poly.mainVar() << ", " << varToRANMap << ", " << interval);
+	assert(varToRANMap.count(poly.mainVar()) == 0);
+
+	if (carl::isZero(poly)) {
+		return result::nullified_response();
+	}
+	if (poly.isNumber()) {
+		return result::no_roots_response();
+	}
+
+	UnivariatePolynomial<Coeff> polyCopy(poly);
+	std::map<Variable, ThomEncoding<Number>> encodings;
+	for (Variable v: carl::variables(polyCopy)) {
+		if (v == poly.mainVar()) continue;
+		auto it = varToRANMap.find(v);
+		if (it == varToRANMap.end()) {
+			CARL_LOG_TRACE("carl.ran.thom", "poly still contains unassigned variable " << v << " -> non-univariate");
+			return result::non_univariate_response();
+		}
+		if (it->second.is_numeric()) {
+			substitute_inplace(polyCopy, v, Coeff(it->second.value()));
+		} else {
+			encodings.emplace(v, in_variable(it->second.thom_encoding(), v));
+		}
+	}
+	if (carl::isZero(polyCopy)) {
+		return result::nullified_response();
+	}
+	if (encodings.empty()) {
+		assert(polyCopy.isUnivariate());
+		return real_roots(polyCopy, interval);
+	}
+
+	MultivariatePolynomial<Number> p(polyCopy);
+	auto point = std::make_shared<ThomEncoding<Number>>(ThomEncoding<Number>::analyzeTEMap(encodings));
+	if (point->makesPolynomialZero(p, poly.mainVar())) {
+		CARL_LOG_TRACE("carl.ran.thom", p << " vanishes on " << *point << " -> nullified");
+		return result::nullified_response();
+	}
+	return detail::from_encodings(realRootsThom(p, poly.mainVar(), point, interval));
+}
+
+}
@@ -0,0 +1,431 @@
+/**
+ * @file ArenaAllocator.h
+ *
+ * Allocators for short-lived containers, most notably the term vectors of polynomials.
+ *
+ * There are two allocation strategies:
+ * - If a ScopedArena is active in the current thread, memory is taken from its MemoryArena by bumping a pointer.
+ *   Deallocation is (almost) a no-op and the whole memory is released at once when the scope ends.
+ * - Otherwise, small blocks are taken from a thread-local SlabPool that recycles freed blocks by size class.
+ *   Large or over-aligned blocks are forwarded to the global operator new, using the aligned overload if necessary.
+ *
+ * The allocators are opt-in: only polynomials using the PolynomialAllocator policy allocate their terms here,
+ * the polynomials used by the algorithms of carl use std::allocator.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace carl {
+
+/**
+ * A simple bump allocator.
+ * Memory is obtained in chunks of growing size and handed out sequentially.
+ * Individual deallocations only give memory back if it was the most recent allocation; all memory is released by release() or upon destruction.
+ * A MemoryArena is not thread-safe.
+ */
+class MemoryArena {
+private:
+	/// Header of every chunk, the usable memory follows directly.
+	struct alignas(std::max_align_t) Chunk {
+		Chunk* next;
+		std::size_t size;
+		char* data() {
+			return reinterpret_cast<char*>(this + 1);
+		}
+	};
+	/// Most recently allocated chunk.
+	Chunk* mChunks = nullptr;
+	/// Next free byte in the current chunk.
+	char* mCurrent = nullptr;
+	/// End of the current chunk.
+	char* mEnd = nullptr;
+	/// Size of the next chunk.
+	std::size_t mChunkSize;
+	/// Number of bytes currently handed out.
+	std::size_t mUsed = 0;
+	/// Number of bytes obtained from the system.
+	std::size_t mReserved = 0;
+	/// Address ranges of all chunks, sorted by their start.
+	using Range = std::pair<const char*, const char*>;
+	std::vector<Range> mRanges;
+
+	void newChunk(std::size_t bytes) {
+		std::size_t size = std::max(mChunkSize, bytes);
+		auto* c = static_cast<Chunk*>(::operator new(sizeof(Chunk) + size));
+		c->next = mChunks;
+		c->size = size;
+		mChunks = c;
+		mCurrent = c->data();
+		mEnd = mCurrent + size;
+		mReserved += size;
+		Range range(mCurrent, mEnd);
+		mRanges.insert(std::upper_bound(mRanges.begin(), mRanges.end(), range), range);
+		// Grow geometrically to keep the number of chunks logarithmic.
+		mChunkSize *= 2;
+	}
+public:
+	/// Size of the first chunk.
+	static constexpr std::size_t defaultChunkSize = 64 * 1024;
+
+	explicit MemoryArena(std::size_t chunkSize = defaultChunkSize): mChunkSize(chunkSize) {}
+	MemoryArena(const MemoryArena&) = delete;
+	MemoryArena& operator=(const MemoryArena&) = delete;
+	~MemoryArena() {
+		release();
+	}
+
+	/**
+	 * Allocates the given number of bytes with the given alignment.
+	 * @param bytes Number of bytes.
+	 * @param alignment Alignment, must be a power of two.
+	 * @return Pointer to the memory.
+	 */
+	void* allocate(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t)) {
+		assert((alignment & (alignment - 1)) == 0);
+		auto aligned = [alignment](char* p) {
+			return reinterpret_cast<char*>((reinterpret_cast<std::uintptr_t>(p) + alignment - 1) & ~(alignment - 1));
+		};
+		char* res = aligned(mCurrent);
+		if (mCurrent == nullptr || res + bytes > mEnd) {
+			newChunk(bytes + alignment);
+			res = aligned(mCurrent);
+		}
+		mCurrent = res + bytes;
+		mUsed += bytes;
+		return res;
+	}
+
+	/**
+	 * Deallocates memory obtained from allocate().
+	 * The memory is only reused if it was the most recent allocation.
+	 */
+	void deallocate(void* p, std::size_t bytes) {
+		assert(owns(p));
+		if (static_cast<char*>(p) + bytes == mCurrent) {
+			mCurrent = static_cast<char*>(p);
+		}
+		mUsed -= bytes;
+	}
+
+	/// Checks whether the given pointer was obtained from this arena.
+	bool owns(const void* p) const {
+		auto* ptr = static_cast<const char*>(p);
+		if (mChunks != nullptr && ptr >= mChunks->data() && ptr < mEnd) return true;
+		// The first range that starts after ptr follows the only range that may contain ptr.
+		auto it = std::upper_bound(mRanges.begin(), mRanges.end(), ptr, [](const char* lhs, const Range& rhs){ return lhs < rhs.first; });
+		if (it == mRanges.begin()) return false;
+		--it;
+		return ptr < it->second;
+	}
+
+	/// Releases all memory at once. All pointers obtained from this arena become invalid.
+	void release() {
+		while (mChunks != nullptr) {
+			Chunk* next = mChunks->next;
+			::operator delete(mChunks);
+			mChunks = next;
+		}
+		mRanges.clear();
+		mCurrent = nullptr;
+		mEnd = nullptr;
+		mUsed = 0;
+		mReserved = 0;
+	}
+
+	/// Number of bytes currently handed out.
+	std::size_t used() const {
+		return mUsed;
+	}
+	/// Number of bytes obtained from the system.
+	std::size_t reserved() const {
+		return mReserved;
+	}
+};
+
+/**
+ * A thread-local pool of small memory blocks, organized in size classes of powers of two.
+ * Freed blocks are kept in a free list per size class and reused by later allocations.
+ *
+ * Blocks are carved from slabs that are aligned to their size, hence the slab of a block is found by masking its address.
+ * Every slab counts its live blocks plus one reference held by the pool that owns it.
+ * A block freed by another thread is not recycled but only decrements this counter.
+ * When the owning thread terminates, its pool drops its free lists and its references and every slab is released as soon as its last block is freed.
+ */
+class SlabPool {
+private:
+	/// Smallest size class.
+	static constexpr std::size_t minBlockSize = 16;
+	/// Number of size classes.
+	static constexpr std::size_t numClasses = 9;
+	/// Size and alignment of the slabs the blocks are carved from.
+	static constexpr std::size_t slabSize = 64 * 1024;
+
+	/// Header at the beginning of every slab.
+	struct alignas(std::max_align_t) Slab {
+		/// Live blocks plus one if the slab is still owned.
+		std::atomic<std::size_t> references;
+		/// Owning pool, nullptr once the owner has terminated.
+		std::atomic<const SlabPool*> owner;
+		/// Next slab of the same owner.
+		Slab* next;
+
+		char* begin() {
+			return reinterpret_cast<char*>(this + 1);
+		}
+		char* end() {
+			return reinterpret_cast<char*>(this) + slabSize;
+		}
+		static Slab* of(void* p) {
+			return reinterpret_cast<Slab*>(reinterpret_cast<std::uintptr_t>(p) & ~(slabSize - 1));
+		}
+		static Slab* create(const SlabPool* owner, std::size_t references) {
+			auto* res = new (::operator new(slabSize, std::align_val_t(slabSize))) Slab;
+			res->references.store(references, std::memory_order_relaxed);
+			res->owner.store(owner, std::memory_order_relaxed);
+			res->next = nullptr;
+			return res;
+		}
+		/// Drops a reference and releases the slab if none is left.
+		void release() {
+			if (references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+				this->~Slab();
+				::operator delete(this, std::align_val_t(slabSize));
+			}
+		}
+	};
+
+	/// Node of the intrusive free lists.
+	struct FreeBlock {
+		FreeBlock* next;
+	};
+	/// Free lists by size class.
+	std::array<FreeBlock*, numClasses> mFree = {};
+	/// All slabs owned by this pool.
+	Slab* mSlabs = nullptr;
+	/// Remainder of the current slab.
+	char* mCurrent = nullptr;
+	char* mEnd = nullptr;
+
+	static std::size_t sizeClass(std::size_t bytes) {
+		std::size_t res = 0;
+		for (std::size_t size = minBlockSize; size < bytes; size *= 2) ++res;
+		return res;
+	}
+
+	/// Pool of the current thread.
+	static SlabPool*& current() {
+		static thread_local SlabPool* pool = nullptr;
+		return pool;
+	}
+	/// Whether the current thread has already released its pool.
+	static bool& terminated() {
+		static thread_local bool res = false;
+		return res;
+	}
+	/// Releases the pool of the current thread when the thread terminates.
+	struct Reaper {
+		~Reaper() {
+			delete current();
+			current() = nullptr;
+			terminated() = true;
+		}
+	};
+
+	SlabPool() = default;
+public:
+	/// Largest block size served by the pool.
+	static constexpr std::size_t maxBlockSize = minBlockSize << (numClasses - 1);
+
+	SlabPool(const SlabPool&) = delete;
+	SlabPool& operator=(const SlabPool&) = delete;
+	~SlabPool() {
+		while (mSlabs != nullptr) {
+			Slab* next = mSlabs->next;
+			mSlabs->owner.store(nullptr, std::memory_order_release);
+			mSlabs->release();
+			mSlabs = next;
+		}
+	}
+
+	/**
+	 * Returns the pool of the current thread, or nullptr if the thread is already terminating.
+	 */
+	static SlabPool* local() {
+		SlabPool*& pool = current();
+		if (pool == nullptr && !terminated()) {
+			static thread_local Reaper reaper;
+			pool = new SlabPool();
+		}
+		return pool;
+	}
+
+	/// Allocates a block of at least the given size, which must not exceed maxBlockSize.
+	void* allocate(std::size_t bytes) {
+		assert(bytes <= maxBlockSize);
+		std::size_t c = sizeClass(bytes);
+		void* res = mFree[c];
+		if (res != nullptr) {
+			mFree[c] = mFree[c]->next;
+		} else {
+			std::size_t size = minBlockSize << c;
+			if (mCurrent == nullptr || mCurrent + size > mEnd) {
+				// The remainder of the old slab is dropped.
+				Slab* slab = Slab::create(this, 1);
+				slab->next = mSlabs;
+				mSlabs = slab;
+				mCurrent = slab->begin();
+				mEnd = slab->end();
+			}
+			res = mCurrent;
+			mCurrent += size;
+		}
+		Slab::of(res)->references.fetch_add(1, std::memory_order_relaxed);
+		return res;
+	}
+
+	/**
+	 * Returns a block of the given size.
+	 * The block is recycled by this pool if the pool owns it and released to its slab otherwise.
+	 * @param pool Pool of the current thread, may be nullptr.
+	 */
+	static void deallocate(SlabPool* pool, void* p, std::size_t bytes) {
+		assert(bytes <= maxBlockSize);
+		Slab* slab = Slab::of(p);
+		if (pool != nullptr && slab->owner.load(std::memory_order_acquire) == pool) {
+			std::size_t c = sizeClass(bytes);
+			auto* block = static_cast<FreeBlock*>(p);
+			block->next = pool->mFree[c];
+			pool->mFree[c] = block;
+			// The pool still owns the slab, thus this never releases it.
+			slab->references.fetch_sub(1, std::memory_order_relaxed);
+		} else {
+			slab->release();
+		}
+	}
+
+	/**
+	 * Allocates a block without a pool, used while the current thread terminates.
+	 * The block gets a slab of its own that is released with the block.
+	 */
+	static void* allocateUnpooled(std::size_t bytes) {
+		assert(bytes <= maxBlockSize);
+		return Slab::create(nullptr, 1)->begin();
+	}
+};
+
+/**
+ * Makes a MemoryArena the allocation source for all ArenaAllocator instances of the current thread while this object lives.
+ * Scopes can be nested, the innermost scope is used for new allocations.
+ * When the scope ends, all memory allocated within it is released at once.
+ *
+ * All containers that allocated memory within the scope must be destroyed before the scope ends.
+ * Results that shall survive the computation must be copied to containers using another allocator, for example a MultivariatePolynomial with the default policies.
+ */
+class ScopedArena {
+private:
+	MemoryArena mArena;
+	ScopedArena* mPrevious;
+
+	static ScopedArena*& current() {
+		static thread_local ScopedArena* cur = nullptr;
+		return cur;
+	}
+public:
+	explicit ScopedArena(std::size_t chunkSize = MemoryArena::defaultChunkSize): mArena(chunkSize), mPrevious(current()) {
+		current() = this;
+	}
+	ScopedArena(const ScopedArena&) = delete;
+	ScopedArena& operator=(const ScopedArena&) = delete;
+	~ScopedArena() {
+		assert(current() == this);
+		current() = mPrevious;
+	}
+
+	/// Returns the innermost active scope of the current thread, or nullptr.
+	static ScopedArena* active() {
+		return current();
+	}
+	/// Returns the enclosing scope, or nullptr.
+	ScopedArena* previous() const {
+		return mPrevious;
+	}
+	MemoryArena& arena() {
+		return mArena;
+	}
+	const MemoryArena& arena() const {
+		return mArena;
+	}
+};
+
+namespace arena_detail {
+	inline void* allocate(std::size_t bytes, std::size_t alignment) {
+		if (ScopedArena* scope = ScopedArena::active()) {
+			return scope->arena().allocate(bytes, alignment);
+		}
+		if (bytes <= SlabPool::maxBlockSize && alignment <= alignof(std::max_align_t)) {
+			if (SlabPool* pool = SlabPool::local()) return pool->allocate(bytes);
+			return SlabPool::allocateUnpooled(bytes);
+		}
+		if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+			return ::operator new(bytes, std::align_val_t(alignment));
+		}
+		return ::operator new(bytes);
+	}
+	inline void deallocate(void* p, std::size_t bytes, std::size_t alignment) {
+		for (ScopedArena* scope = ScopedArena::active(); scope != nullptr; scope = scope->previous()) {
+			if (scope->arena().owns(p)) {
+				scope->arena().deallocate(p, bytes);
+				return;
+			}
+		}
+		if (bytes <= SlabPool::maxBlockSize && alignment <= alignof(std::max_align_t)) {
+			SlabPool::deallocate(SlabPool::local(), p, bytes);
+		} else if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+			::operator delete(p, std::align_val_t(alignment));
+		} else {
+			::operator delete(p);
+		}
+	}
+}
+
+/**
+ * A stateless standard allocator that allocates from the active ScopedArena or the thread-local SlabPool.
+ */
+template<typename T>
+class ArenaAllocator {
+public:
+	using value_type = T;
+
+	ArenaAllocator() noexcept = default;
+	template<typename U>
+	ArenaAllocator(const ArenaAllocator<U>&) noexcept {} // NOLINT
+
+	T* allocate(std::size_t n) {
+		return static_cast<T*>(arena_detail::allocate(n * sizeof(T), alignof(T)));
+	}
+	void deallocate(T* p, std::size_t n) noexcept {
+		arena_detail::deallocate(p, n * sizeof(T), alignof(T));
+	}
+};
+
+template<typename T, typename U>
+bool operator==(const ArenaAllocator<T>&, const ArenaAllocator<U>&) noexcept {
+	return true;
+}
+template<typename T, typename U>
+bool operator!=(const ArenaAllocator<T>&, const ArenaAllocator<U>&) noexcept {
+	return false;
+}
+
+}
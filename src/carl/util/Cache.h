@@ -9,10 +9,14 @@
 
 #include "Common.h"
 
+#include <array>
+#include <atomic>
 #include <cassert>
+#include <condition_variable>
 #include <limits>
 #include <mutex>
 #include <stack>
+#include <thread>
 #include <unordered_set>
 #include <vector>
 
@@ -43,6 +47,17 @@ namespace carl
     template<typename T>
     void doNothing( const T& /*unused*/, const T& /*unused*/) {}
    
+    /**
+     * A reference counting cache which can be shared by multiple threads.
+     * 
+     * The entries are distributed over several shards by their hash value, each of which is protected by its own lock, such that
+     * threads working on different entries rarely contend. References are resolved without any locking. Activity updates are
+     * collected in striped buffers and applied in batches, and unused entries are removed by a background thread instead of
+     * the thread that triggers the cleaning.
+     * 
+     * An entry with a usage count of zero is only accessed while holding the lock of its shard. Hence, an entry must only be
+     * accessed via its reference while it is registered, and rehash() must not be called concurrently with other accesses to the same entry.
+     */
     template<typename T>
     class Cache {
         
@@ -54,7 +69,7 @@ namespace carl
             /**
              * Store the number of usages of the entry in the cache for which this information hold by external objects.
              */
-            std::size_t usageCount;
+            std::atomic<std::size_t> usageCount;
             
             /**
              * Stores the reference of the entry in the cache for which this information hold.
@@ -66,17 +81,46 @@ namespace carl
              * is involved in computations in the recent past.
              */
             double activity;
+            
+            /**
+             * The shard the entry is stored in.
+             */
+            std::size_t shard;
 
-            explicit Info( double _activity ):
+            Info( double _activity, std::size_t _shard ):
                 usageCount(0),
                 refStoragePositions(),
-                activity(_activity)
+                activity(_activity),
+                shard(_shard)
             {}
         };
         
         using Container = std::unordered_set<TypeInfoPair<T,Info>*, pointerHash<TypeInfoPair<T,Info>>, pointerEqual<TypeInfoPair<T,Info>>>;
         
     private:
+        using Slot = std::atomic<TypeInfoPair<T,Info>*>;
+        
+        /// The number of shards the entries are distributed over.
+        static constexpr std::size_t NUM_OF_SHARDS = 16;
+        /// The number of buffers collecting activity updates.
+        static constexpr std::size_t NUM_OF_ACTIVITY_BUFFERS = 16;
+        /// The number of activity updates a buffer collects before they are applied.
+        static constexpr std::size_t ACTIVITY_BUFFER_SIZE = 64;
+        /// The size of the first chunk of references, every further chunk is twice as large as its predecessor.
+        static constexpr std::size_t FIRST_REF_CHUNK_SIZE = 1024;
+        /// The maximal number of chunks of references.
+        static constexpr std::size_t NUM_OF_REF_CHUNKS = 48;
+        
+        struct Shard {
+            mutable std::mutex mutex;
+            Container entries;
+        };
+        
+        struct ActivityBuffer {
+            std::mutex mutex;
+            std::vector<Ref> refs;
+        };
+        
         // Members
         
         /**
@@ -84,10 +128,15 @@ namespace carl
          */
         std::size_t mMaxCacheSize;
         
+        /**
+         * The current number of entries in the cache.
+         */
+        std::atomic<std::size_t> mSize;
+        
         /**
          * The current number of entries in the cache, which are not used.
          */
-        std::size_t mNumOfUnusedEntries = 0;
+        std::atomic<std::size_t> mNumOfUnusedEntries;
         
         /**
          * The percentage of the cache, which shall be removed at best, if the cache size exceeds the threshold. (NOT YET USED)
@@ -97,7 +146,7 @@ namespace carl
         /**
          * The threshold for the maximum activity. In case it is exceeded, all activities are rescaled.
          */
-        double mMaxActivity = 0.0;
+        std::atomic<double> mMaxActivity;
         
         /**
          * The reciprocal of the factor to multiply an activity with in order to increase it. 
@@ -122,23 +171,35 @@ namespace carl
         double mActivityDecrementFactor = 1e-100;
         
         /**
-         * A mutex for situation where any member is changed. TODO: Refine the locking-situations. 
-         */
-        std::recursive_mutex mMutex;
-        
-        /**
-         *  The container storing all cached entries. It maps the objects to store to cache information, which cover a usage counter, 
-         *  the position in mCacheRefs, being the entries reference, and the activity of this entry.
+         * The shards storing all cached entries. Every shard maps the objects to store to cache information, which cover a usage counter, 
+         * the positions in mRefChunks, being the entries references, and the activity of this entry.
+         * Lock order: mActivityMutex, the mutex of a shard, mRefMutex.
          */
-        Container mCache;
+        std::array<Shard,NUM_OF_SHARDS> mShards;
         
         /**
-         * Stores at the reference of an entry in the cache an iterator to this entry. 
-         * This reference can be used to access the entry outside this class.
+         * Stores at the reference of an entry in the cache a pointer to this entry. 
+         * This reference can be used to access the entry outside this class. The chunks are never moved, hence they can be read without locking.
          */
-        std::vector<TypeInfoPair<T,Info>*> mCacheRefs;
+        std::array<std::atomic<Slot*>,NUM_OF_REF_CHUNKS> mRefChunks;
+        /// The smallest reference which has never been used.
+        Ref mNextRef = 1;
         /// A stack containing free references, which have been used before but freed now.
         std::stack<Ref> mUnusedPositionsInCacheRefs;
+        /// A mutex for the allocation of references.
+        mutable std::mutex mRefMutex;
+        
+        /// Buffers collecting activity updates, a thread uses the buffer determined by its id.
+        std::array<ActivityBuffer,NUM_OF_ACTIVITY_BUFFERS> mActivityBuffers;
+        /// A mutex for the activities, the activity increment and the removal of entries.
+        mutable std::mutex mActivityMutex;
+        
+        /// The thread removing unused entries, it is started on the first request.
+        std::thread mCleaner;
+        std::mutex mCleanerMutex;
+        std::condition_variable mCleanerCondition;
+        std::atomic<bool> mCleaningRequested;
+        bool mStopCleaner = false;
         
     public:
 
@@ -152,18 +213,20 @@ namespace carl
         ~Cache();
         
         /**
-         * Caches the given object.
+         * Caches the given object and registers the entry it is stored in. If an equal object has already been cached,
+         * the cache does not take the ownership of the given object.
          * @param _toCache The object to cache.
          * @param _canBeUpdated A function, which determines whether, in the case an equal object has already been cached, the given object
          *                      can update the information in this already cached object.
          * @param _update A function which updates an object in the cache, which is equal to the given object, by the information in the given object.
          *                After this function has been applied, the corresponding entry in the cache will be reinserted in it after been rehashed.
-         * @return The reference of the entry, which can be used outside this class to access the entry.
+         * @return The reference of the entry, which can be used outside this class to access the entry, and whether a new entry has been created.
          */
         std::pair<Ref,bool> cache( T* _toCache, bool (*_canBeUpdated)( const T&, const T& ) = &returnFalse<T>, void (*_update)( const T&, const T& ) = &doNothing<T> );
         
         /**
          * Registers the entry to the given reference. It mainly increases the usage counter of this entry in the cache.
+         * The entry must already be registered, e.g. by the object the reference has been copied from.
          * @param _refStoragePos The reference of the entry to register.
          */
         void reg( Ref _refStoragePos );
@@ -177,7 +240,6 @@ namespace carl
         /**
          * Removes and reinserts the entry with the given reference, after its hash value is recalculated.
          * @param _refStoragePos The reference of the entry to apply the given function to.
-         * @return The new reference.
          */
         void rehash( Ref _refStoragePos );
         
@@ -188,10 +250,25 @@ namespace carl
         
         /**
          * Strenghtens the activity of the entry in the cache with the given reference, by increasing its activity.
+         * The update is buffered and applied together with other updates of the same thread.
          * @param _refStoragePos The reference of the entry in the cache to strengthen its activity.
          */
         void strengthenActivity( Ref _refStoragePos );
         
+        /**
+         * Removes a certain amount of unused entries in the cache. 
+         * This is done automatically by a background thread if the cache size exceeds the threshold.
+         */
+        void clean();
+        
+        /**
+         * @return The current number of entries in the cache.
+         */
+        std::size_t size() const
+        {
+            return mSize.load();
+        }
+        
         /**
          * Prints all information stored in this cache to std::cout.
          * @param _out The stream to print on.
@@ -204,74 +281,90 @@ namespace carl
          */
         const T& get( Ref _refStoragePos ) const
         {
-            assert( _refStoragePos < mCacheRefs.size() );
-            assert( mCacheRefs[_refStoragePos] != nullptr );
-            assert( mCacheRefs[_refStoragePos]->second.usageCount > 0 );
-            return *mCacheRefs[_refStoragePos]->first;
+            TypeInfoPair<T,Info>* cacheRef = slot( _refStoragePos ).load( std::memory_order_acquire );
+            assert( cacheRef != nullptr );
+            assert( cacheRef->second.usageCount > 0 );
+            return *cacheRef->first;
         }
         
     private:
         
         /**
-         * Removes a certain amount of unused entries in the cache.
+         * @param _ref A reference.
+         * @return The chunk the reference is stored in and its position in this chunk.
          */
-        void clean();
+        static std::pair<std::size_t,std::size_t> refPosition( Ref _ref )
+        {
+            std::size_t q = _ref / FIRST_REF_CHUNK_SIZE + 1;
+            std::size_t chunk = 0;
+            while( (q >>= 1) != 0 )
+                ++chunk;
+            return std::make_pair( chunk, _ref - ((std::size_t(1) << chunk) - 1) * FIRST_REF_CHUNK_SIZE );
+        }
+        
+        Slot& slot( Ref _ref ) const
+        {
+            auto pos = refPosition( _ref );
+            assert( pos.first < NUM_OF_REF_CHUNKS );
+            Slot* chunk = mRefChunks[pos.first].load( std::memory_order_acquire );
+            assert( chunk != nullptr );
+            return chunk[pos.second];
+        }
         
         /**
-         * Removes the entry at the given position in the cache.
-         * @param _toRemove The position to the entry to remove from the cache.
-         * @return 
+         * @return A free reference. Requires mRefMutex to be locked.
          */
-        std::size_t erase( TypeInfoPair<T,Info>* _toRemove )
+        Ref allocateRef();
+        
+        std::size_t shardOf( const T& _t ) const
         {
-            assert( checkNumOfUnusedEntries() );
-            std::lock_guard<std::recursive_mutex> lock( mMutex );
-            assert( _toRemove->second.usageCount == 0 );
-            for( const Ref& ref : _toRemove->second.refStoragePositions )
-            {
-                mCacheRefs[ref] = nullptr;
-                assert (ref > 0);
-                mUnusedPositionsInCacheRefs.push( ref );
-            }
-            assert( mNumOfUnusedEntries > 0 );
-            --mNumOfUnusedEntries;
-            assert(_toRemove->second.usageCount == 0);
-            auto result = mCache.erase( _toRemove );
-            T* toDel = _toRemove->first;
-            delete _toRemove;
-            delete toDel;
-            assert( checkNumOfUnusedEntries() );
-            return result;
+            return _t.getHash() % NUM_OF_SHARDS;
         }
         
         /**
-         * Removes the entry at the given position in the cache.
-         * @param _toRemove The position to the entry to remove from the cache.
-         * @return An iterator to the entry in the cache right after the entry which has to be removed.
+         * Inserts the given element into its shard after its hash value is recalculated. Merges it with an equal entry, if there is one.
+         * Requires mActivityMutex to be locked.
+         * @return The entry which contains the given element afterwards.
          */
-        typename Container::iterator erase( typename Container::iterator _toRemove )
+        TypeInfoPair<T,Info>* reinsert( TypeInfoPair<T,Info>* _element );
+        
+        /**
+         * Removes the entry at the given position in the given shard. Requires mActivityMutex and the mutex of the shard to be locked.
+         * @return An iterator to the entry in the shard right after the entry which has to be removed.
+         */
+        typename Container::iterator erase( Shard& _shard, typename Container::iterator _toRemove )
         {
-            assert( checkNumOfUnusedEntries() );
-            std::lock_guard<std::recursive_mutex> lock( mMutex );
             assert( (*_toRemove)->second.usageCount == 0 );
-            for( const Ref& ref : (*_toRemove)->second.refStoragePositions )
             {
-                mCacheRefs[ref] = nullptr;
-                assert (ref > 0);
-                mUnusedPositionsInCacheRefs.push( ref );
+                std::lock_guard<std::mutex> lock( mRefMutex );
+                for( const Ref& ref : (*_toRemove)->second.refStoragePositions )
+                {
+                    assert (ref > 0);
+                    slot( ref ).store( nullptr, std::memory_order_release );
+                    mUnusedPositionsInCacheRefs.push( ref );
+                }
             }
             assert( mNumOfUnusedEntries > 0 );
             --mNumOfUnusedEntries;
-            assert((*_toRemove)->second.usageCount == 0);
+            --mSize;
             T* toDel = (*_toRemove)->first;
             TypeInfoPair<T,Info>* toDelB = *_toRemove;
-            auto result = mCache.erase( _toRemove );
+            auto result = _shard.entries.erase( _toRemove );
             delete toDelB;
             delete toDel;
-            assert( checkNumOfUnusedEntries() );
             return result;
         }
         
+        /**
+         * Applies the activity updates collected in the given buffer. Requires mActivityMutex to be locked.
+         */
+        void applyActivities( const std::vector<Ref>& _refs );
+        
+        /**
+         * Wakes up the background thread removing unused entries and starts it, if necessary.
+         */
+        void requestCleaning();
+        
         bool hasDuplicates(const std::vector<Ref>& _vec) const
         {
             std::set<Ref> vecEntries;
@@ -283,29 +376,6 @@ namespace carl
             return false;
         }
         
-        bool checkNumOfUnusedEntries() const
-        {
-            std::size_t actualNumOfUnusedEntries = 0;
-            for( auto iter = mCache.begin(); iter != mCache.end(); ++iter )
-            {
-                if( (*iter)->second.usageCount == 0 )
-                {
-                    ++actualNumOfUnusedEntries;
-                }
-            }
-            return mNumOfUnusedEntries == actualNumOfUnusedEntries;
-        }
-        
-        size_t sumOfAllUsageCounts() const
-        {
-            std::size_t result = 0;
-            for( auto iter = mCache.begin(); iter != mCache.end(); ++iter )
-            {
-                result += (*iter)->second.usageCount;
-            }
-            return result;
-        }
-        
     };
     
 } // namespace carl
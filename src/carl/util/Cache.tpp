@@ -9,6 +9,9 @@
 
 #include "Cache.h"
 
+#include <functional>
+#include <tuple>
+
 
 namespace carl
 {   
@@ -18,248 +21,370 @@ namespace carl
     template<typename T>
     Cache<T>::Cache( size_t _maxCacheSize, double _cacheReductionAmount, double _decay ):
         mMaxCacheSize( _maxCacheSize ),
+        mSize( 0 ),
+        mNumOfUnusedEntries( 0 ),
         mCacheReductionAmount( _cacheReductionAmount ), // TODO: use it, but without the effort of quick select
+        mMaxActivity( 0.0 ),
         mDecay( _decay ),
-        mCache(),
-        mCacheRefs(),
-        mUnusedPositionsInCacheRefs()
+        mShards(),
+        mUnusedPositionsInCacheRefs(),
+        mCleaningRequested( false )
     {
         assert( _decay >= 0.9 && _decay <= 1.0 );
-        mCache.reserve( _maxCacheSize ); // TODO: maybe no reservation of memory and let it grow dynamically
-        mCacheRefs.reserve( _maxCacheSize ); // TODO: maybe no reservation of memory and let it grow dynamically
+        for( auto& shard : mShards )
+            shard.entries.reserve( _maxCacheSize / NUM_OF_SHARDS ); // TODO: maybe no reservation of memory and let it grow dynamically
+        for( auto& chunk : mRefChunks )
+            chunk.store( nullptr );
         // reserve the first entry with index 0 as default
-        mCacheRefs.push_back( nullptr ); 
+        allocateRef();
     }
     
     template<typename T>
     Cache<T>::~Cache()
     {
-        mCacheRefs.clear();
-        while( !mCache.empty() )
         {
-            TypeInfoPair<T,Info>* tip = *mCache.begin();
-            mCache.erase( mCache.begin() );
-            T* t = tip->first;
-            delete tip;
-            delete t;
+            std::lock_guard<std::mutex> lock( mCleanerMutex );
+            mStopCleaner = true;
         }
+        mCleanerCondition.notify_one();
+        if( mCleaner.joinable() )
+            mCleaner.join();
+        for( auto& shard : mShards )
+        {
+            while( !shard.entries.empty() )
+            {
+                TypeInfoPair<T,Info>* tip = *shard.entries.begin();
+                shard.entries.erase( shard.entries.begin() );
+                T* t = tip->first;
+                delete tip;
+                delete t;
+            }
+        }
+        for( auto& chunk : mRefChunks )
+            delete[] chunk.load();
     }
     
     template<typename T>
     std::pair<typename Cache<T>::Ref,bool> Cache<T>::cache( T* _toCache, bool (*_canBeUpdated)( const T&, const T& ), void (*_update)( const T&, const T& ) )
     {
-        std::lock_guard<std::recursive_mutex> lock( mMutex );
-        if( mCache.size() >= mMaxCacheSize ) // Clean, if the number of elements in the cache exceeds the threshold.
-        {
-            clean();
-        }
-        auto newElement = new TypeInfoPair<T,Info>(_toCache, Info(mMaxActivity));
-        auto ret = mCache.insert( newElement );
+        auto newElement = new TypeInfoPair<T,Info>( std::piecewise_construct, std::forward_as_tuple( _toCache ), std::forward_as_tuple( mMaxActivity.load(), shardOf( *_toCache ) ) );
+        Shard& shard = mShards[newElement->second.shard];
+        std::unique_lock<std::mutex> lock( shard.mutex );
+        auto ret = shard.entries.insert( newElement );
         
         if( !ret.second ) // There is already an equal object in the cache.
         {
+            delete newElement;
+            TypeInfoPair<T,Info>* element = *ret.first;
+            if( element->second.usageCount++ == 0 )
+            {
+                assert( mNumOfUnusedEntries > 0 );
+                --mNumOfUnusedEntries;
+            }
+            assert( element->second.refStoragePositions.size() > 0);
+            assert( element->second.refStoragePositions.front() > 0 );
+            Ref ref = element->second.refStoragePositions.front();
             // Try to update the entry in the cache by the information in the given object.
-            if( (*_canBeUpdated)( *((*ret.first)->first), *_toCache ) )
+            if( (*_canBeUpdated)( *element->first, *_toCache ) )
             {
-                TypeInfoPair<T,Info>* element = *ret.first;
                 (*_update)( *element->first, *_toCache );
-                mCache.erase( ret.first );
-                element->first->rehash();
-                auto retB = mCache.insert( element );
-                assert( retB.second );
-                for( const Ref& ref : element->second.refStoragePositions )
-                    mCacheRefs[ref] = *retB.first;
-                delete newElement;
-                Info& info = (*retB.first)->second;
-                assert( info.refStoragePositions.size() > 0);
-                assert( info.refStoragePositions.front() > 0 );
-                info.refStoragePositions.insert( info.refStoragePositions.end(), element->second.refStoragePositions.begin(), element->second.refStoragePositions.end() );
-                return std::make_pair( info.refStoragePositions.front(), false );
+                shard.entries.erase( ret.first );
+                lock.unlock();
+                std::lock_guard<std::mutex> activityLock( mActivityMutex );
+                reinsert( element );
             }
-            else
-                delete newElement;
+            return std::make_pair( ref, false );
         }
-        else // Create a new entry in the cache.
+        // Create a new entry in the cache.
+        Ref ref;
         {
-            if( mUnusedPositionsInCacheRefs.empty() ) // Get a brand new reference.
-            {
-                assert( mCacheRefs.size() > 0);
-                (*ret.first)->second.refStoragePositions.push_back( mCacheRefs.size() );
-                assert( !hasDuplicates( (*ret.first)->second.refStoragePositions ) );
-                mCacheRefs.push_back( newElement );
-            }
-            else // Try to take the reference from the stack of old ones.
-            {
-                mCacheRefs[mUnusedPositionsInCacheRefs.top()] = newElement;
-                assert( mUnusedPositionsInCacheRefs.top() > 0);
-                newElement->second.refStoragePositions.push_back( mUnusedPositionsInCacheRefs.top() );
-                assert( !hasDuplicates( newElement->second.refStoragePositions ) );
-                mUnusedPositionsInCacheRefs.pop();
-            }
-            assert( mNumOfUnusedEntries < std::numeric_limits<sint>::max() );
-            ++mNumOfUnusedEntries;
+            std::lock_guard<std::mutex> refLock( mRefMutex );
+            ref = allocateRef();
+        }
+        newElement->second.refStoragePositions.push_back( ref );
+        newElement->second.usageCount = 1;
+        slot( ref ).store( newElement, std::memory_order_release );
+        ++mSize;
+        lock.unlock();
+        if( mSize >= mMaxCacheSize ) // Clean, if the number of elements in the cache exceeds the threshold.
+        {
+            requestCleaning();
         }
-        assert( (*ret.first)->second.refStoragePositions.size() > 0);
-        assert( (*ret.first)->second.refStoragePositions.front() > 0 );
-        return std::make_pair( (*ret.first)->second.refStoragePositions.front(), ret.second );
+        return std::make_pair( ref, true );
     }
     
     template<typename T>
     void Cache<T>::reg( Ref _refStoragePos )
     {
-        std::lock_guard<std::recursive_mutex> lock( mMutex );
-        assert( _refStoragePos < mCacheRefs.size() );
-        TypeInfoPair<T,Info>* cacheRef = mCacheRefs[_refStoragePos];
+        TypeInfoPair<T,Info>* cacheRef = slot( _refStoragePos ).load( std::memory_order_acquire );
         assert( cacheRef != nullptr );
-        if( cacheRef->second.usageCount == 0 )
+        std::size_t usageCount = cacheRef->second.usageCount.load();
+        while( usageCount > 0 )
+        {
+            assert( usageCount < std::numeric_limits<sint>::max() );
+            if( cacheRef->second.usageCount.compare_exchange_weak( usageCount, usageCount + 1 ) )
+                return;
+        }
+        // The entry is not used, hence it may only be changed while holding the lock of its shard.
+        std::lock_guard<std::mutex> lock( mShards[cacheRef->second.shard].mutex );
+        if( cacheRef->second.usageCount++ == 0 )
         {
             assert( mNumOfUnusedEntries > 0 );
             --mNumOfUnusedEntries;
         }
-        assert( cacheRef->second.usageCount < std::numeric_limits<sint>::max() );
-        ++cacheRef->second.usageCount;
     }
     
     template<typename T>
     void Cache<T>::dereg( Ref _refStoragePos )
     {
-        std::lock_guard<std::recursive_mutex> lock( mMutex );
-        assert( _refStoragePos < mCacheRefs.size() );
-        TypeInfoPair<T,Info>* cacheRef = mCacheRefs[_refStoragePos];
+        TypeInfoPair<T,Info>* cacheRef = slot( _refStoragePos ).load( std::memory_order_acquire );
         assert( cacheRef != nullptr );
-        assert( cacheRef->second.usageCount > 0 );
-        --cacheRef->second.usageCount;
-        if( cacheRef->second.usageCount == 0 ) // no more usage
+        std::size_t usageCount = cacheRef->second.usageCount.load();
+        while( usageCount > 1 )
+        {
+            if( cacheRef->second.usageCount.compare_exchange_weak( usageCount, usageCount - 1 ) )
+                return;
+        }
         {
+            // The entry might become unused, hence it may only be changed while holding the lock of its shard.
+            std::lock_guard<std::mutex> lock( mShards[cacheRef->second.shard].mutex );
+            assert( cacheRef->second.usageCount > 0 );
+            if( --cacheRef->second.usageCount > 0 )
+                return;
             assert( mNumOfUnusedEntries < std::numeric_limits<sint>::max() );
             ++mNumOfUnusedEntries;
-            // If the cache contains more used elements than the maximum desired cache size, remove this entry directly.
-            if( mCache.size() - mNumOfUnusedEntries >= mMaxCacheSize )
-            {
-                erase( cacheRef );
-            }
+        }
+        // If the cache contains more used elements than the maximum desired cache size, remove unused entries.
+        if( mSize - mNumOfUnusedEntries >= mMaxCacheSize )
+        {
+            requestCleaning();
         }
     }
     
     template<typename T>
     void Cache<T>::rehash( Ref _refStoragePos )
     {
-        std::lock_guard<std::recursive_mutex> lock( mMutex );
-        assert( _refStoragePos < mCacheRefs.size() );
-        TypeInfoPair<T,Info>* cacheRef = mCacheRefs[_refStoragePos];
+        std::lock_guard<std::mutex> activityLock( mActivityMutex );
+        TypeInfoPair<T,Info>* cacheRef = slot( _refStoragePos ).load( std::memory_order_acquire );
         assert( cacheRef != nullptr );
-        mCache.erase( cacheRef );
-        cacheRef->first->rehash();
-        const Info& infoB = cacheRef->second;
-        auto ret = mCache.insert( cacheRef );
-        if( !ret.second )
         {
-            Info& info = (*ret.first)->second;
-            if( infoB.usageCount == 0 )
-            {
-                assert( mNumOfUnusedEntries > 0 );
-                --mNumOfUnusedEntries;
-            }
-            else if( info.usageCount == 0 )
-            {
-                assert( mNumOfUnusedEntries > 0 );
-                --mNumOfUnusedEntries;
-            }
-            assert( info.usageCount + infoB.usageCount >= info.usageCount );
-            info.usageCount += infoB.usageCount;
-            info.refStoragePositions.insert( info.refStoragePositions.end(), infoB.refStoragePositions.begin(), infoB.refStoragePositions.end() );
-            assert( !hasDuplicates( info.refStoragePositions ) );
-            assert( std::find( infoB.refStoragePositions.begin(), infoB.refStoragePositions.end(), _refStoragePos ) != infoB.refStoragePositions.end() );
-            for( const Ref& ref : infoB.refStoragePositions )
-            {
-                assert( mCacheRefs[ref] != *(ret.first) );
-                mCacheRefs[ref] = *(ret.first);
-            }
-            delete cacheRef->first;
-            delete cacheRef;
+            Shard& shard = mShards[cacheRef->second.shard];
+            std::lock_guard<std::mutex> lock( shard.mutex );
+            shard.entries.erase( cacheRef );
+        }
+        reinsert( cacheRef );
+    }
+    
+    template<typename T>
+    typename Cache<T>::Ref Cache<T>::allocateRef()
+    {
+        if( !mUnusedPositionsInCacheRefs.empty() ) // Try to take the reference from the stack of old ones.
+        {
+            Ref ref = mUnusedPositionsInCacheRefs.top();
+            assert( ref > 0 );
+            mUnusedPositionsInCacheRefs.pop();
+            return ref;
+        }
+        // Get a brand new reference.
+        Ref ref = mNextRef++;
+        auto pos = refPosition( ref );
+        assert( pos.first < NUM_OF_REF_CHUNKS );
+        if( mRefChunks[pos.first].load( std::memory_order_relaxed ) == nullptr )
+        {
+            mRefChunks[pos.first].store( new Slot[FIRST_REF_CHUNK_SIZE << pos.first](), std::memory_order_release );
+        }
+        return ref;
+    }
+    
+    template<typename T>
+    TypeInfoPair<T,typename Cache<T>::Info>* Cache<T>::reinsert( TypeInfoPair<T,Info>* _element )
+    {
+        _element->first->rehash();
+        std::size_t shardIndex = shardOf( *_element->first );
+        Shard& shard = mShards[shardIndex];
+        std::lock_guard<std::mutex> lock( shard.mutex );
+        _element->second.shard = shardIndex;
+        auto ret = shard.entries.insert( _element );
+        if( ret.second )
+            return _element;
+        Info& info = (*ret.first)->second;
+        const Info& infoB = _element->second;
+        if( infoB.usageCount == 0 )
+        {
+            assert( mNumOfUnusedEntries > 0 );
+            --mNumOfUnusedEntries;
         }
+        else if( info.usageCount == 0 )
+        {
+            assert( mNumOfUnusedEntries > 0 );
+            --mNumOfUnusedEntries;
+        }
+        info.usageCount += infoB.usageCount;
+        info.refStoragePositions.insert( info.refStoragePositions.end(), infoB.refStoragePositions.begin(), infoB.refStoragePositions.end() );
+        assert( !hasDuplicates( info.refStoragePositions ) );
+        for( const Ref& ref : infoB.refStoragePositions )
+        {
+            assert( slot( ref ).load() != *(ret.first) );
+            slot( ref ).store( *(ret.first), std::memory_order_release );
+        }
+        --mSize;
+        delete _element->first;
+        delete _element;
+        return *(ret.first);
     }
     
     template<typename T>
     void Cache<T>::clean()
     {
         CARL_LOG_TRACE( "carl.util.cache", "Cleaning cache..." );
-        if( double(mNumOfUnusedEntries) < (double(mCache.size()) * mCacheReductionAmount) )
+        std::lock_guard<std::mutex> activityLock( mActivityMutex );
+        // Apply all buffered activity updates, as they are the basis for the decision which entries to remove.
+        for( auto& buffer : mActivityBuffers )
         {
-            if( mNumOfUnusedEntries > 0 )
+            std::vector<Ref> refs;
             {
-                // There are less entries we can delete than we want to delete: just delete them all
-                for( auto iter = mCache.begin(); iter != mCache.end(); )
+                std::lock_guard<std::mutex> lock( buffer.mutex );
+                refs.swap( buffer.refs );
+            }
+            applyActivities( refs );
+        }
+        if( double(mNumOfUnusedEntries) < (double(mSize) * mCacheReductionAmount) )
+        {
+            // There are less entries we can delete than we want to delete: just delete them all
+            for( auto& shard : mShards )
+            {
+                std::lock_guard<std::mutex> lock( shard.mutex );
+                for( auto iter = shard.entries.begin(); iter != shard.entries.end(); )
                 {
                     if( (*iter)->second.usageCount == 0 )
-                    {
-                        iter = erase( iter );
-                    }
+                        iter = erase( shard, iter );
                     else
-                    {
                         ++iter;
-                    }
                 }
             }
-            assert( mNumOfUnusedEntries == 0 );
         }
         else
         {
-            std::vector<typename Container::iterator> noUsageEntries;
             // Calculate the expected median of the activities of all entries in the cache with no usage.
             double limit = 0.0;
-            for( auto iter = mCache.begin(); iter != mCache.end(); ++iter )
+            std::size_t numOfNoUsageEntries = 0;
+            for( auto& shard : mShards )
             {
-                if( (*iter)->second.usageCount == 0 )
+                std::lock_guard<std::mutex> lock( shard.mutex );
+                for( auto iter = shard.entries.begin(); iter != shard.entries.end(); ++iter )
                 {
-                    noUsageEntries.push_back( iter );
-                    limit += (*iter)->second.activity;
+                    if( (*iter)->second.usageCount == 0 )
+                    {
+                        ++numOfNoUsageEntries;
+                        limit += (*iter)->second.activity;
+                    }
                 }
             }
-            limit = limit / double(noUsageEntries.size());
+            if( numOfNoUsageEntries == 0 )
+                return;
+            limit = limit / double(numOfNoUsageEntries);
             // Remove all entries in the cache with no usage, which have an activity below the calculated median.
-            for( auto iter = noUsageEntries.begin(); iter != noUsageEntries.end(); ++iter )
+            for( auto& shard : mShards )
             {
-                if( (**iter)->second.activity <= limit )
+                std::lock_guard<std::mutex> lock( shard.mutex );
+                for( auto iter = shard.entries.begin(); iter != shard.entries.end(); )
                 {
-                    erase( *iter );
+                    if( (*iter)->second.usageCount == 0 && (*iter)->second.activity <= limit )
+                        iter = erase( shard, iter );
+                    else
+                        ++iter;
                 }
             }
         }
     }
     
+    template<typename T>
+    void Cache<T>::requestCleaning()
+    {
+        if( mCleaningRequested.load( std::memory_order_relaxed ) )
+            return;
+        {
+            std::lock_guard<std::mutex> lock( mCleanerMutex );
+            if( mStopCleaner )
+                return;
+            mCleaningRequested = true;
+            if( !mCleaner.joinable() )
+            {
+                mCleaner = std::thread( [this]()
+                {
+                    std::unique_lock<std::mutex> cleanerLock( mCleanerMutex );
+                    while( true )
+                    {
+                        mCleanerCondition.wait( cleanerLock, [this](){ return mCleaningRequested || mStopCleaner; } );
+                        if( mStopCleaner )
+                            return;
+                        mCleaningRequested = false;
+                        cleanerLock.unlock();
+                        clean();
+                        cleanerLock.lock();
+                    }
+                } );
+            }
+        }
+        mCleanerCondition.notify_one();
+    }
+    
     template<typename T>
     void Cache<T>::decayActivity()
     {
-        std::lock_guard<std::recursive_mutex> lock( mMutex );
+        std::lock_guard<std::mutex> lock( mActivityMutex );
         mActivityIncrement *= (1 / mDecay);
     }
     
     template<typename T>
     void Cache<T>::strengthenActivity( Ref _refStoragePos )
     {
-        assert( _refStoragePos < mCacheRefs.size() );
-        TypeInfoPair<T,Info>* cacheRef = mCacheRefs[_refStoragePos];
-        assert( cacheRef != nullptr );
-        // update the activity of the cache entry at the given position
-        if( (cacheRef->second.activity += mActivityIncrement) > mActivityThreshold )
+        assert( slot( _refStoragePos ).load() != nullptr );
+        ActivityBuffer& buffer = mActivityBuffers[std::hash<std::thread::id>()( std::this_thread::get_id() ) % NUM_OF_ACTIVITY_BUFFERS];
+        std::vector<Ref> refs;
+        {
+            std::lock_guard<std::mutex> lock( buffer.mutex );
+            buffer.refs.push_back( _refStoragePos );
+            if( buffer.refs.size() < ACTIVITY_BUFFER_SIZE )
+                return;
+            refs.swap( buffer.refs );
+        }
+        std::lock_guard<std::mutex> lock( mActivityMutex );
+        applyActivities( refs );
+    }
+    
+    template<typename T>
+    void Cache<T>::applyActivities( const std::vector<Ref>& _refs )
+    {
+        for( Ref ref : _refs )
         {
-            std::lock_guard<std::recursive_mutex> lock( mMutex );
-            // rescale if the threshold for the maximum activity has been exceeded
-            for( auto iter = mCache.begin(); iter != mCache.end(); ++iter )
-                (*iter)->second.activity *= mActivityDecrementFactor;
-            mActivityIncrement *= mActivityDecrementFactor;
-            mMaxActivity *= mActivityDecrementFactor;
+            // The entry may have been removed in the meantime.
+            TypeInfoPair<T,Info>* cacheRef = slot( ref ).load( std::memory_order_acquire );
+            if( cacheRef == nullptr )
+                continue;
+            // update the activity of the cache entry at the given position
+            if( (cacheRef->second.activity += mActivityIncrement) > mActivityThreshold )
+            {
+                // rescale if the threshold for the maximum activity has been exceeded
+                for( auto& shard : mShards )
+                {
+                    std::lock_guard<std::mutex> lock( shard.mutex );
+                    for( auto iter = shard.entries.begin(); iter != shard.entries.end(); ++iter )
+                        (*iter)->second.activity *= mActivityDecrementFactor;
+                }
+                mActivityIncrement *= mActivityDecrementFactor;
+                mMaxActivity = mMaxActivity * mActivityDecrementFactor;
+            }
+            // update the maximum activity
+            if( mMaxActivity < cacheRef->second.activity )
+                mMaxActivity = cacheRef->second.activity;
         }
-        // update the maximum activity
-        std::lock_guard<std::recursive_mutex> lock( mMutex );
-        if( mMaxActivity < cacheRef->second.activity )
-            mMaxActivity = cacheRef->second.activity;
     }
     
     template<typename T>
     void Cache<T>::print( std::ostream& _out ) const
     {
+        std::lock_guard<std::mutex> activityLock( mActivityMutex );
         _out << "General cache information:" << std::endl;
         _out << "   desired maximum cache size                                 : "  << mMaxCacheSize << std::endl;
         _out << "   number of unused entries                                   : "  << mNumOfUnusedEntries << std::endl;
@@ -269,19 +394,26 @@ namespace carl
         _out << "   decay factor for the given activities                      : "  << mDecay << std::endl;
         _out << "   upper bound of the activities                              : "  << mActivityThreshold << std::endl;
         _out << "   scaling factor of the activities                           : "  << mActivityDecrementFactor << std::endl;
-        _out << "   current size of the cache                                  : "  << mCache.size() << std::endl;
-        _out << "   number of yet involved references                          : "  << mCacheRefs.size() << std::endl;
-        _out << "   number of currently freed references                       : "  << mUnusedPositionsInCacheRefs.size() << std::endl;
+        _out << "   current size of the cache                                  : "  << mSize << std::endl;
+        {
+            std::lock_guard<std::mutex> refLock( mRefMutex );
+            _out << "   number of yet involved references                          : "  << mNextRef << std::endl;
+            _out << "   number of currently freed references                       : "  << mUnusedPositionsInCacheRefs.size() << std::endl;
+        }
         _out << "Cache contains:" << std::endl;
-        for( auto iter = mCache.begin(); iter != mCache.end(); ++iter )
+        for( const auto& shard : mShards )
         {
-            assert( (*iter)->first != nullptr );
-            _out << "   " << *(*iter)->first << std::endl;
-            _out << "                       usage count: " << (*iter)->second.usageCount << std::endl;
-            _out << "        reference storage positions:";
-            for( Ref ref : (*iter)->second.refStoragePositions )
-                _out << "  " << ref;
-            _out << "                          activity: " << (*iter)->second.activity << std::endl;
+            std::lock_guard<std::mutex> lock( shard.mutex );
+            for( auto iter = shard.entries.begin(); iter != shard.entries.end(); ++iter )
+            {
+                assert( (*iter)->first != nullptr );
+                _out << "   " << *(*iter)->first << std::endl;
+                _out << "                       usage count: " << (*iter)->second.usageCount << std::endl;
+                _out << "        reference storage positions:";
+                for( Ref ref : (*iter)->second.refStoragePositions )
+                    _out << "  " << ref;
+                _out << "                          activity: " << (*iter)->second.activity << std::endl;
+            }
         }
     }
     
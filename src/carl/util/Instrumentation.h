@@ -0,0 +1,101 @@
+/**
+ * @file Instrumentation.h
+ *
+ * Instrumentation of the major operations of carl.
+ * If carl is built with CARL_DEVOPTION_Instrumentation, every `CARL_INSTRUMENT(name, inputs...)` records
+ * the call count, the running time and the sizes of the inputs of the surrounding function as statistics named `name`.
+ * Otherwise, the macro expands to nothing.
+ *
+ * The input sizes are measured generically: polynomials contribute their degree, number of terms and the bit size of their largest coefficient,
+ * numbers their bit size and ranges all their elements.
+ */
+
+#pragma once
+
+#include <carl-statistics/config.h>
+
+#ifdef CARL_DEVOPTION_Instrumentation
+
+#include <carl-statistics/Instrumentation.h>
+#include "../numbers/numbers.h"
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+
+namespace carl {
+namespace instrumentation {
+
+namespace detail {
+	template<typename T, typename = void>
+	struct is_multivariate : std::false_type {};
+	template<typename T>
+	struct is_multivariate<T, std::void_t<decltype(std::declval<const T&>().totalDegree()), decltype(std::declval<const T&>().nrTerms())>> : std::true_type {};
+
+	template<typename T, typename = void>
+	struct is_univariate : std::false_type {};
+	template<typename T>
+	struct is_univariate<T, std::void_t<decltype(std::declval<const T&>().degree()), decltype(std::declval<const T&>().coefficients())>> : std::true_type {};
+
+	template<typename T, typename = void>
+	struct is_range : std::false_type {};
+	template<typename T>
+	struct is_range<T, std::void_t<decltype(std::begin(std::declval<const T&>())), decltype(std::end(std::declval<const T&>()))>> : std::true_type {};
+}
+
+/// Return the bit size of a coefficient, that is either a number or a polynomial.
+template<typename T>
+std::size_t bits(const T& t) {
+	if constexpr (is_number<T>::value) {
+		return carl::bitsize(t);
+	} else if constexpr (detail::is_multivariate<T>::value) {
+		std::size_t res = 0;
+		for (const auto& term: t) res = std::max(res, bits(term.coeff()));
+		return res;
+	} else if constexpr (detail::is_univariate<T>::value) {
+		std::size_t res = 0;
+		for (const auto& c: t.coefficients()) res = std::max(res, bits(c));
+		return res;
+	} else {
+		return 0;
+	}
+}
+
+/// Add the size of the given input to size.
+template<typename T>
+void measure(statistics::input_size& size, const T& input) {
+	if constexpr (is_number<T>::value) {
+		size.bits = std::max(size.bits, bits(input));
+	} else if constexpr (detail::is_multivariate<T>::value) {
+		size.degree = std::max(size.degree, static_cast<std::size_t>(input.totalDegree()));
+		size.terms += input.nrTerms();
+		size.bits = std::max(size.bits, bits(input));
+	} else if constexpr (detail::is_univariate<T>::value) {
+		size.degree = std::max(size.degree, static_cast<std::size_t>(input.degree()));
+		size.terms += static_cast<std::size_t>(std::count_if(input.coefficients().begin(), input.coefficients().end(), [](const auto& c){ return !carl::isZero(c); }));
+		size.bits = std::max(size.bits, bits(input));
+	} else if constexpr (detail::is_range<T>::value) {
+		for (const auto& i: input) measure(size, i);
+	}
+}
+
+/// Return the combined size of the given inputs.
+template<typename... Args>
+statistics::input_size input_size(const Args&... inputs) {
+	statistics::input_size res;
+	(measure(res, inputs), ...);
+	return res;
+}
+
+}
+}
+
+#define __CARL_INSTRUMENT_NAME(prefix, id) prefix ## id
+#define __CARL_INSTRUMENT(name, id, ...) \
+	static auto& __CARL_INSTRUMENT_NAME(__carl_instrument_statistics_, id) = carl::statistics::operation_statistics(name); \
+	carl::statistics::operation_scope __CARL_INSTRUMENT_NAME(__carl_instrument_scope_, id)(__CARL_INSTRUMENT_NAME(__carl_instrument_statistics_, id), carl::instrumentation::input_size(__VA_ARGS__))
+#define CARL_INSTRUMENT(name, ...) __CARL_INSTRUMENT(name, __COUNTER__, __VA_ARGS__)
+
+#else
+#define CARL_INSTRUMENT(name, ...)
+#endif
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <carl-statistics/Metrics.h>
+
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <cstddef>
 #include <utility>
@@ -28,5 +31,27 @@ public:
 	std::pair<bool, std::size_t> needRehash(std::size_t numBuckets, std::size_t numElements) const;
 };
 
+/**
+ * Counts how a pool is used, such that the pools can be monitored.
+ * A hit is a request for an element that was already in the pool, a miss adds a new element.
+ * The counters are metrics, hence they can be read without holding the lock of the pool and exported directly, see PoolStatistics.
+ */
+struct Counters {
+	/// Number of requests that returned an existing element.
+	statistics::counter hits;
+	/// Number of requests that added a new element.
+	statistics::counter misses;
+	/// Number of times the underlying hash table was rehashed.
+	statistics::counter rehashes;
+
+	/// Returns the ratio of requests that returned an existing element.
+	double hit_rate() const {
+		auto h = hits.value();
+		auto requests = h + misses.value();
+		if (requests == 0) return 0;
+		return static_cast<double>(h) / static_cast<double>(requests);
+	}
+};
+
 } // namespace pool
 } // namespace carl
\ No newline at end of file
@@ -7,9 +7,11 @@
 
 #pragma once 
 
+#include <iterator>
 #include <list>
 #include <mutex>
 #include <tuple>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 
@@ -154,7 +156,12 @@ public:
 		else return terms[max];
 	}
     
-	void readTerms(TAMId id, Terms& terms) {
+	/**
+	 * Writes the collected terms to the given vector.
+	 * If the vector uses the same allocator as our buffers, the buffers are swapped, otherwise the terms are moved.
+	 */
+	template<typename TermsType>
+	void readTerms(TAMId id, TermsType& terms) {
         Tuple& data = *id;
 		assert(std::get<2>(data));
 		Terms& t = std::get<1>(data);
@@ -178,7 +185,11 @@ public:
                 ++i;
             }
 		}
-		std::swap(t, terms);
+		if constexpr (std::is_same<TermsType, Terms>::value) {
+			std::swap(t, terms);
+		} else {
+			terms.assign(std::make_move_iterator(t.begin()), std::make_move_iterator(t.end()));
+		}
 		t.clear();
         #else
         terms.clear();
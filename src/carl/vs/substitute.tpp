@@ -189,7 +189,7 @@ namespace carl::vs::detail
                         if( !_onlyNeq )
                         {
                             toCombine.emplace_back();
-                            const smtrat::Factorization& factorization = constraint->factorization();
+                            const Factors<Poly>& factorization = constraint->factorization();
                             for( auto factor = factorization.begin(); factor != factorization.end(); ++factor )
                             {
                                 toCombine.back().emplace_back();
@@ -209,7 +209,7 @@ namespace carl::vs::detail
                     {
                         toCombine.emplace_back();
                         toCombine.back().emplace_back();
-                        const smtrat::Factorization& factorization = constraint->factorization();
+                        const Factors<Poly>& factorization = constraint->factorization();
                         for( auto factor = factorization.begin(); factor != factorization.end(); ++factor )
                             toCombine.back().back().push_back( Constraint<Poly>( factor->first, Relation::NEQ ) );
                         simplify( toCombine.back() );
@@ -257,7 +257,7 @@ namespace carl::vs::detail
                 {
                     if( !_onlyNeq )
                     {
-                        const smtrat::Factorization& factorization = _constraint.factorization();
+                        const Factors<Poly>& factorization = _constraint.factorization();
                         for( auto factor = factorization.begin(); factor != factorization.end(); ++factor )
                         {
                             result.emplace_back();
@@ -275,7 +275,7 @@ namespace carl::vs::detail
                 case Relation::NEQ:
                 {
                     result.emplace_back();
-                    const smtrat::Factorization& factorization = _constraint.factorization();
+                    const Factors<Poly>& factorization = _constraint.factorization();
                     for( auto factor = factorization.begin(); factor != factorization.end(); ++factor )
                         result.back().push_back( Constraint<Poly>( factor->first, Relation::NEQ ) );
                     simplify( result );
@@ -327,7 +327,7 @@ namespace carl::vs::detail
             while( foundNoInvalidConstraint && pos < cc.size() )
             {
                 const Constraint<Poly>& constraint = cc[pos];
-                std::vector<std::pair<smtrat::Rational,Poly>> sosDec;
+                std::vector<std::pair<typename Poly::NumberType,Poly>> sosDec;
                 bool lcoeffNeg = carl::isNegative(constraint.lhs().lcoeff());
                 if (lcoeffNeg)
                     sosDec = carl::sos_decomposition(-constraint.lhs());
@@ -462,7 +462,7 @@ namespace carl::vs::detail
             ConstraintConjunction<Poly> negatives;
             ConstraintConjunction<Poly> alwaysnegatives;
             unsigned numOfAlwaysNegatives = 0;
-            const smtrat::Factorization& product = _constraint.factorization();
+            const Factors<Poly>& product = _constraint.factorization();
             for( auto factor = product.begin(); factor != product.end(); ++factor )
             {
                 Constraint<Poly> consPos = Constraint<Poly>( factor->first, relPos );
@@ -663,16 +663,16 @@ namespace carl::vs::detail
                            Variables& _conflictingVariables,
                            const detail::EvalDoubleIntervalMap& _solutionSpace )
     {
-        
+        using Rational = typename Poly::NumberType;
         bool result = true;
         if( _cons.hasVariable( _subs.variable() ) )
         {
             // Collect all necessary left hand sides to create the new conditions of all cases referring to the virtual substitution.
-            if( carl::pow( smtrat::Rational(smtrat::Rational(_subs.term().sqrt_ex().constantPart().size()) + smtrat::Rational(_subs.term().sqrt_ex().factor().size()) * smtrat::Rational(_subs.term().sqrt_ex().radicand().size())), _cons.maxDegree( _subs.variable() )) > (MAX_NUM_OF_TERMS*MAX_NUM_OF_TERMS) )
+            if( carl::pow( Rational(Rational(_subs.term().sqrt_ex().constantPart().size()) + Rational(_subs.term().sqrt_ex().factor().size()) * Rational(_subs.term().sqrt_ex().radicand().size())), _cons.maxDegree( _subs.variable() )) > (MAX_NUM_OF_TERMS*MAX_NUM_OF_TERMS) )
             {
                 return false;
             }
-            smtrat::SqrtEx sub = smtrat::SqrtEx::subBySqrtEx( _cons.lhs(), _subs.variable(), _subs.term().sqrt_ex() );
+            SqrtEx<Poly> sub = SqrtEx<Poly>::subBySqrtEx( _cons.lhs(), _subs.variable(), _subs.term().sqrt_ex() );
             #ifdef VS_DEBUG_SUBSTITUTION
             std::cout << "Result of common substitution:" << sub << std::endl;
             #endif
@@ -0,0 +1,265 @@
+#pragma once
+
+/**
+ * @file substitution_cache.h
+ * A memoizing front end for virtual substitution.
+ * Substitution results are cached per constraint, variable and test candidate, and the case distinction of a conjunction of constraints,
+ * i.e. the product of the case distinctions of its constraints, is enumerated lazily instead of being materialized.
+ */
+
+#include "substitute.h"
+#include "../util/hash.h"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#ifdef THREAD_SAFE
+#include <mutex>
+#include <thread>
+#define VS_CACHE_LOCK_GUARD std::lock_guard<std::mutex> lock(m_mutex);
+#else
+#define VS_CACHE_LOCK_GUARD
+#endif
+
+namespace carl::vs {
+
+/**
+ * Lazily enumerates the conjunctions, called branches, of a product of case distinctions.
+ * Every branch is the union of one conjunction from every factor and is simplified before it is returned: true constraints and
+ * constraints implied by other constraints of the branch are dropped, and branches with a false constraint or two conflicting
+ * constraints are skipped. Hence, unlike detail::combine, there is no limit on the number of combinations.
+ *
+ * If carl is built with THREAD_SAFE, next_batch() may simplify the branches of a batch in parallel.
+ */
+template<typename Poly>
+class case_generator {
+	std::vector<CaseDistinction<Poly>> m_factors;
+	std::size_t m_size;
+	/// Index of the next branch to simplify.
+	std::size_t m_next = 0;
+	bool m_parallel;
+
+	/// Counts the branches, saturated at the maximum of std::size_t.
+	static std::size_t count(const std::vector<CaseDistinction<Poly>>& factors) {
+		std::size_t res = 1;
+		for (const auto& f: factors) {
+			if (f.empty()) return 0;
+			if (res > std::numeric_limits<std::size_t>::max() / f.size()) return std::numeric_limits<std::size_t>::max();
+			res *= f.size();
+		}
+		return res;
+	}
+
+	/**
+	 * Builds and simplifies the branch with the given index, read as a mixed-radix number over the factors.
+	 * @return std::nullopt if the branch is inconsistent.
+	 */
+	std::optional<ConstraintConjunction<Poly>> branch(std::size_t index) const {
+		ConstraintConjunction<Poly> res;
+		for (const auto& f: m_factors) {
+			for (const auto& c: f[index % f.size()]) {
+				if (c == Constraint<Poly>(false)) return std::nullopt;
+				if (c == Constraint<Poly>(true)) continue;
+				bool redundant = false;
+				for (auto it = res.begin(); it != res.end() && !redundant; ) {
+					switch (carl::compare(*it, c)) {
+					case A_IFF_B:
+					case A_IMPLIES_B:
+						redundant = true;
+						++it;
+						break;
+					case B_IMPLIES_A:
+						it = res.erase(it);
+						break;
+					case NOT__A_AND_B:
+					case A_XOR_B:
+						return std::nullopt;
+					default:
+						++it;
+					}
+				}
+				if (!redundant) res.push_back(c);
+			}
+			index /= f.size();
+		}
+		return res;
+	}
+
+public:
+	/**
+	 * @param parallel Whether next_batch() simplifies branches in parallel. Only has an effect if carl is built with THREAD_SAFE.
+	 */
+	explicit case_generator(std::vector<CaseDistinction<Poly>> factors, bool parallel = false)
+		: m_factors(std::move(factors)), m_size(count(m_factors)), m_parallel(parallel) {}
+
+	/// The number of branches in the product, saturated at the maximum of std::size_t.
+	std::size_t size() const {
+		return m_size;
+	}
+
+	/**
+	 * Returns the next consistent branch or std::nullopt if all branches have been enumerated.
+	 * An empty branch is trivially true.
+	 */
+	std::optional<ConstraintConjunction<Poly>> next() {
+		while (m_next < m_size) {
+			auto res = branch(m_next++);
+			if (res) return res;
+		}
+		return std::nullopt;
+	}
+
+	/**
+	 * Simplifies the next (at most) count branches and returns the consistent ones in order.
+	 * Returns an empty vector only if all branches have been enumerated.
+	 */
+	std::vector<ConstraintConjunction<Poly>> next_batch(std::size_t count) {
+		std::vector<ConstraintConjunction<Poly>> res;
+		while (res.empty() && m_next < m_size) {
+			std::size_t n = std::min(count, m_size - m_next);
+			std::vector<std::optional<ConstraintConjunction<Poly>>> branches(n);
+#ifdef THREAD_SAFE
+			std::size_t threads = m_parallel ? std::min<std::size_t>(std::thread::hardware_concurrency(), n) : 1;
+			if (threads > 1) {
+				std::vector<std::thread> pool;
+				for (std::size_t t = 0; t < threads; ++t) {
+					pool.emplace_back([&, t]() {
+						for (std::size_t i = t; i < n; i += threads) {
+							branches[i] = branch(m_next + i);
+						}
+					});
+				}
+				for (auto& t: pool) t.join();
+			} else
+#endif
+			{
+				for (std::size_t i = 0; i < n; ++i) {
+					branches[i] = branch(m_next + i);
+				}
+			}
+			m_next += n;
+			for (auto& b: branches) {
+				if (b) res.push_back(std::move(*b));
+			}
+		}
+		return res;
+	}
+};
+
+/**
+ * Caches the results of virtual substitutions per (constraint, variable, test candidate).
+ * The cached results are those of carl::vs::substitute(), including the failure if too many combinations would be created.
+ *
+ * If carl is built with THREAD_SAFE, the cache can be shared between threads, and the generators returned by
+ * substitute(const ConstraintConjunction<Poly>&, ...) simplify the resulting branches in parallel.
+ */
+template<typename Poly>
+class substitution_cache {
+	struct key {
+		Constraint<Poly> constraint;
+		Variable variable;
+		Term<Poly> term;
+		bool operator==(const key& other) const {
+			return constraint == other.constraint && variable == other.variable && term == other.term;
+		}
+	};
+	struct key_hash {
+		std::size_t operator()(const key& k) const {
+			std::size_t seed = 0;
+			carl::hash_add(seed, k.constraint, k.variable, k.term);
+			return seed;
+		}
+	};
+	using result_t = std::optional<CaseDistinction<Poly>>;
+
+	std::unordered_map<key, std::shared_ptr<const result_t>, key_hash> m_cache;
+	std::size_t m_hits = 0;
+	std::size_t m_misses = 0;
+	bool m_parallel;
+#ifdef THREAD_SAFE
+	mutable std::mutex m_mutex;
+#endif
+
+	std::shared_ptr<const result_t> lookup(const key& k) {
+		VS_CACHE_LOCK_GUARD
+		auto it = m_cache.find(k);
+		if (it == m_cache.end()) return nullptr;
+		++m_hits;
+		return it->second;
+	}
+
+	std::shared_ptr<const result_t> store(const key& k, result_t&& res) {
+		auto ptr = std::make_shared<const result_t>(std::move(res));
+		VS_CACHE_LOCK_GUARD
+		++m_misses;
+		return m_cache.emplace(k, ptr).first->second;
+	}
+
+	std::shared_ptr<const result_t> compute(const key& k) {
+		return store(k, carl::vs::substitute(k.constraint, k.variable, k.term));
+	}
+
+public:
+	/**
+	 * @param parallel Whether the returned generators simplify branches in parallel. Only has an effect if carl is built with THREAD_SAFE.
+	 */
+	explicit substitution_cache(bool parallel = true): m_parallel(parallel) {}
+
+	/**
+	 * Applies a substitution to a constraint, see carl::vs::substitute().
+	 * @return std::nullopt if the number of combinations in the result exceeds the limit, the substitution result otherwise.
+	 */
+	std::optional<CaseDistinction<Poly>> substitute(const Constraint<Poly>& cons, Variable var, const Term<Poly>& term) {
+		key k{cons, var, term};
+		auto res = lookup(k);
+		if (res == nullptr) res = compute(k);
+		return *res;
+	}
+
+	/**
+	 * Applies a substitution to a conjunction of constraints.
+	 * The resulting case distinction is the product of the case distinctions of the individual constraints and is enumerated lazily.
+	 * The cached results are copied into the generator, hence it stays valid if the cache is cleared.
+	 * @return std::nullopt if the substitution into one of the constraints fails, a generator for the resulting conjunctions otherwise.
+	 */
+	std::optional<case_generator<Poly>> substitute(const ConstraintConjunction<Poly>& conj, Variable var, const Term<Poly>& term) {
+		std::vector<CaseDistinction<Poly>> factors;
+		for (const auto& c: conj) {
+			key k{c, var, term};
+			auto res = lookup(k);
+			if (res == nullptr) res = compute(k);
+			if (!*res) return std::nullopt;
+			factors.push_back(**res);
+		}
+		return case_generator<Poly>(std::move(factors), m_parallel);
+	}
+
+	/// Number of substitutions that were answered from the cache.
+	std::size_t hits() const {
+		VS_CACHE_LOCK_GUARD
+		return m_hits;
+	}
+	/// Number of substitutions that were computed.
+	std::size_t misses() const {
+		VS_CACHE_LOCK_GUARD
+		return m_misses;
+	}
+	std::size_t size() const {
+		VS_CACHE_LOCK_GUARD
+		return m_cache.size();
+	}
+	void clear() {
+		VS_CACHE_LOCK_GUARD
+		m_cache.clear();
+		m_hits = 0;
+		m_misses = 0;
+	}
+};
+
+}
+
+#undef VS_CACHE_LOCK_GUARD
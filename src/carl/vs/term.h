@@ -76,7 +76,11 @@ template<class Poly>
 struct hash<carl::vs::Term<Poly>> {
 public:
 	size_t operator()(const carl::vs::Term<Poly>& term) const {
-		return ((hash<carl::SqrtEx<Poly>>()(term.sqrt_ex()) << 5) ^ term.type());
+		std::size_t res = static_cast<std::size_t>(term.type());
+		if (term.is_normal() || term.is_plus_eps()) {
+			res ^= hash<carl::SqrtEx<Poly>>()(term.sqrt_ex()) << 5;
+		}
+		return res;
 	}
 };
 } // namespace std
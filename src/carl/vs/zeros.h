@@ -1,7 +1,14 @@
 #pragma once
 
 #include "SqrtEx.h"
+#include <carl/core/polynomialfunctions/Factorization.h>
+#include <carl/formula/VariableComparison.h>
+#include <carl/ran/real_roots.h>
+#include <algorithm>
 #include <optional>
+#include <queue>
+#include <unordered_map>
+#include <variant>
 #include <vector>
 
 namespace carl::vs {
@@ -150,7 +157,7 @@ static bool gather_zeros(const VariableComparison<Poly>& varcomp, const Variable
 	}
 	assert(varcomp.var() == eliminationVar);
 
-	const auto& ran = std::get<RealAlgebraicNumber<Rational>>(varcomp.value());
+	const auto& ran = std::get<typename VariableComparison<Poly>::RAN>(varcomp.value());
 	if (ran.is_numeric()) {
 		results.push_back({SqrtEx<Poly>(Poly(Rational(ran.value()))), Constraints<Poly>()});
 		return true;
@@ -212,4 +219,127 @@ static bool gather_zeros(const VariableComparison<Poly>& varcomp, const Variable
 	}
 	return false;
 }
-}
\ No newline at end of file
+
+/**
+ * Incrementally generates the test candidates for the given constraints and variable comparisons in the given variable.
+ *
+ * Constraints and variable comparisons are processed in the order of their degree in the elimination variable, and the zeros gathered so far are yielded
+ * linear before quadratic and with fewer side conditions first. Hence the caller can stop as soon as a satisfying branch is found
+ * without gathering the zeros of all constraints.
+ * A candidate is dominated and thus skipped if an equal square root expression with a subset of its side conditions has already
+ * been yielded.
+ */
+template<typename Poly>
+class zero_generator {
+	struct entry {
+		zero<Poly> z;
+		std::size_t id;
+	};
+	struct entry_less {
+		/// std::priority_queue yields the greatest element, hence the preferred entry must be the greatest.
+		bool operator()(const entry& lhs, const entry& rhs) const {
+			if (lhs.z.sqrt_ex.hasSqrt() != rhs.z.sqrt_ex.hasSqrt()) return lhs.z.sqrt_ex.hasSqrt();
+			if (lhs.z.side_condition.size() != rhs.z.side_condition.size()) return lhs.z.side_condition.size() > rhs.z.side_condition.size();
+			return lhs.id > rhs.id;
+		}
+	};
+
+	using atom = std::variant<Constraint<Poly>, VariableComparison<Poly>>;
+	struct pending {
+		atom a;
+		std::size_t degree;
+	};
+
+	Variable m_var;
+	/// Atoms whose zeros have not been gathered yet, sorted by decreasing degree.
+	std::vector<pending> m_pending;
+	std::priority_queue<entry, std::vector<entry>, entry_less> m_queue;
+	std::unordered_map<SqrtEx<Poly>, std::vector<Constraints<Poly>>> m_yielded;
+	std::size_t m_next_id = 0;
+	bool m_complete = true;
+
+	/// Gathers the zeros of all pending constraints of the least degree.
+	void gather_next_degree() {
+		assert(!m_pending.empty());
+		auto degree = m_pending.back().degree;
+		while (!m_pending.empty() && m_pending.back().degree == degree) {
+			std::vector<zero<Poly>> zeros;
+			bool gathered = std::visit([this, &zeros](const auto& a) { return gather_zeros(a, m_var, zeros); }, m_pending.back().a);
+			if (!gathered) {
+				m_complete = false;
+			}
+			m_pending.pop_back();
+			for (auto& z: zeros) {
+				m_queue.push(entry{std::move(z), m_next_id++});
+			}
+		}
+	}
+
+	bool is_dominated(const zero<Poly>& z) const {
+		auto it = m_yielded.find(z.sqrt_ex);
+		if (it == m_yielded.end()) return false;
+		return std::any_of(it->second.begin(), it->second.end(), [&z](const auto& sc) {
+			return std::includes(z.side_condition.begin(), z.side_condition.end(), sc.begin(), sc.end(), z.side_condition.key_comp());
+		});
+	}
+
+	void add(const Constraint<Poly>& c) {
+		if (c.hasVariable(m_var)) m_pending.push_back(pending{c, c.maxDegree(m_var)});
+	}
+	/**
+	 * A variable comparison with a real algebraic number yields the root of its defining polynomial, if the polynomial is at most quadratic.
+	 * Comparisons with a multivariate root do not yield zeros and mark the generator as incomplete.
+	 */
+	void add(const VariableComparison<Poly>& vc) {
+		if (vc.var() != m_var && !carl::variables(vc).has(m_var)) return;
+		auto c = vc.asConstraint();
+		std::size_t degree = c ? c->maxDegree(m_var) : vc.definingPolynomial().degree(m_var);
+		m_pending.push_back(pending{vc, degree});
+	}
+
+public:
+	/**
+	 * The iterators yield constraints, variable comparisons, or std::variant<Constraint<Poly>, VariableComparison<Poly>>.
+	 */
+	template<typename Iterator>
+	zero_generator(Iterator begin, Iterator end, Variable var): m_var(var) {
+		for (; begin != end; ++begin) {
+			if constexpr (std::is_same_v<std::decay_t<decltype(*begin)>, atom>) {
+				std::visit([this](const auto& a) { add(a); }, *begin);
+			} else {
+				add(*begin);
+			}
+		}
+		std::stable_sort(m_pending.begin(), m_pending.end(), [](const auto& lhs, const auto& rhs) {
+			return lhs.degree > rhs.degree;
+		});
+	}
+
+	/**
+	 * Returns the next test candidate or std::nullopt if all candidates have been yielded.
+	 */
+	std::optional<zero<Poly>> next() {
+		while (true) {
+			while (m_queue.empty()) {
+				if (m_pending.empty()) return std::nullopt;
+				gather_next_degree();
+			}
+			zero<Poly> z = m_queue.top().z;
+			m_queue.pop();
+			if (is_dominated(z)) continue;
+			m_yielded[z.sqrt_ex].push_back(z.side_condition);
+			return z;
+		}
+	}
+
+	/**
+	 * Whether the zeros of all atoms processed so far could be gathered, i.e. no factor had a degree greater than two and no
+	 * variable comparison was with a multivariate root.
+	 * Only if this holds after next() returned std::nullopt, the yielded candidates are complete.
+	 */
+	bool complete() const {
+		return m_complete;
+	}
+};
+
+}
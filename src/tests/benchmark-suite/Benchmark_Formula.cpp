@@ -0,0 +1,63 @@
+#include "Generator.h"
+
+#include <benchmark/benchmark.h>
+
+#include <carl/formula/Formula.h>
+#include <carl/formula/helpers/to_cnf.h>
+
+using namespace carl::suite;
+
+using FormulaT = carl::Formula<MVP>;
+using ConstraintT = carl::Constraint<MVP>;
+
+namespace {
+	/// Return n random linear and quadratic constraints.
+	std::vector<FormulaT> constraints(Generator& gen, std::size_t n) {
+		static const std::vector<carl::Relation> relations = {carl::Relation::EQ, carl::Relation::NEQ, carl::Relation::LESS, carl::Relation::LEQ, carl::Relation::GREATER, carl::Relation::GEQ};
+		auto vars = variables(4);
+		std::vector<FormulaT> res;
+		for (std::size_t i = 0; i < n; ++i) {
+			MVP p = gen.polynomial(vars, 4, 2);
+			res.emplace_back(ConstraintT(p, relations[static_cast<std::size_t>(gen.integer(0, 5))]));
+		}
+		return res;
+	}
+	/// Return a disjunction of conjunctions over the given constraints that has no trivial CNF.
+	FormulaT dnf(Generator& gen, const std::vector<FormulaT>& atoms, std::size_t clauses) {
+		carl::Formulas<MVP> disjuncts;
+		for (std::size_t i = 0; i < clauses; ++i) {
+			carl::Formulas<MVP> conjuncts;
+			for (std::size_t j = 0; j < 3; ++j) {
+				const auto& a = atoms[static_cast<std::size_t>(gen.integer(0, static_cast<long>(atoms.size()) - 1))];
+				conjuncts.push_back(gen.integer(0, 1) == 0 ? a : FormulaT(carl::FormulaType::NOT, a));
+			}
+			disjuncts.emplace_back(carl::FormulaType::AND, std::move(conjuncts));
+		}
+		return FormulaT(carl::FormulaType::OR, std::move(disjuncts));
+	}
+}
+
+// The argument is the number of constraints. Formulas are pooled, hence most iterations measure lookups in the pools.
+static void Formula_Construction(benchmark::State& state) {
+	std::vector<MVP> polys;
+	Generator gen(201);
+	auto vars = variables(4);
+	for (long i = 0; i < state.range(0); ++i) polys.push_back(gen.polynomial(vars, 4, 2));
+	for (auto _ : state) {
+		carl::Formulas<MVP> atoms;
+		for (const auto& p: polys) atoms.emplace_back(ConstraintT(p, carl::Relation::LEQ));
+		benchmark::DoNotOptimize(FormulaT(carl::FormulaType::AND, std::move(atoms)));
+	}
+}
+BENCHMARK(Formula_Construction)->RangeMultiplier(4)->Range(16, 1024);
+
+// The argument is the number of clauses of a formula in disjunctive normal form.
+static void Formula_CNF(benchmark::State& state) {
+	Generator gen(202);
+	auto atoms = constraints(gen, 16);
+	FormulaT f = dnf(gen, atoms, static_cast<std::size_t>(state.range(0)));
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(carl::to_cnf(f));
+	}
+}
+BENCHMARK(Formula_CNF)->RangeMultiplier(2)->Range(4, 64);
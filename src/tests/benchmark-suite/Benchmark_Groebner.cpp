@@ -0,0 +1,33 @@
+#include "Generator.h"
+
+#include <benchmark/benchmark.h>
+
+#include <carl/groebner/benchmarks/cyclic.h>
+#include <carl/groebner/benchmarks/katsura.h>
+#include <carl/groebner/groebner.h>
+
+using namespace carl::suite;
+
+using GBPolynomial = carl::MultivariatePolynomial<Rational, carl::GrLexOrdering>;
+
+static void groebner(benchmark::State& state, const std::vector<GBPolynomial>& input) {
+	for (auto _ : state) {
+		carl::GBProcedure<GBPolynomial, carl::Buchberger, carl::StdAdding> gb;
+		for (const auto& p: input) gb.addPolynomial(p);
+		gb.reduceInput();
+		gb.calculate();
+		benchmark::DoNotOptimize(gb.getIdeal().nrGenerators());
+	}
+}
+
+// The argument is the index of the cyclic-n system.
+static void Groebner_Cyclic(benchmark::State& state) {
+	groebner(state, carl::benchmarks::cyclic<Rational, carl::GrLexOrdering, carl::StdMultivariatePolynomialPolicies<>>(static_cast<unsigned>(state.range(0))));
+}
+BENCHMARK(Groebner_Cyclic)->DenseRange(2, 3);
+
+// The argument is the index of the katsura-n system.
+static void Groebner_Katsura(benchmark::State& state) {
+	groebner(state, carl::benchmarks::katsura<Rational, carl::GrLexOrdering, carl::StdMultivariatePolynomialPolicies<>>(static_cast<unsigned>(state.range(0))));
+}
+BENCHMARK(Groebner_Katsura)->DenseRange(2, 4);
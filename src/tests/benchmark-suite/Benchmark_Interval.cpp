@@ -0,0 +1,45 @@
+#include "Generator.h"
+
+#include <benchmark/benchmark.h>
+
+#include <carl/interval/Contraction.h>
+#include <carl/interval/Interval.h>
+#include <carl/interval/IntervalEvaluation.h>
+
+using namespace carl::suite;
+
+// The argument is the number of terms of the polynomial that is used for contraction.
+static void Interval_Contraction(benchmark::State& state) {
+	Generator gen(301);
+	auto vars = variables(4);
+	MVP p = gen.polynomial(vars, static_cast<std::size_t>(state.range(0)), 3);
+	carl::Interval<double>::evalintervalmap map;
+	for (auto v: vars) {
+		double lower = static_cast<double>(gen.integer(-10, 0));
+		map[v] = carl::Interval<double>(lower, lower + static_cast<double>(gen.integer(1, 10)));
+	}
+	carl::Contraction<carl::SimpleNewton, MVP> contractor(p);
+	carl::Interval<double> resA;
+	carl::Interval<double> resB;
+	for (auto _ : state) {
+		for (auto v: vars) {
+			benchmark::DoNotOptimize(contractor(map, v, resA, resB));
+		}
+	}
+}
+BENCHMARK(Interval_Contraction)->RangeMultiplier(2)->Range(2, 32);
+
+static void Interval_Evaluation(benchmark::State& state) {
+	Generator gen(302);
+	auto vars = variables(4);
+	MVP p = gen.polynomial(vars, static_cast<std::size_t>(state.range(0)), 4);
+	std::map<carl::Variable, carl::Interval<Rational>> map;
+	for (auto v: vars) {
+		Rational lower = gen.rational(10);
+		map[v] = carl::Interval<Rational>(lower, lower + Rational(gen.integer(1, 10)));
+	}
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(carl::IntervalEvaluation::evaluate(p, map));
+	}
+}
+BENCHMARK(Interval_Evaluation)->RangeMultiplier(4)->Range(4, 256);
@@ -0,0 +1,87 @@
+#include "Generator.h"
+
+#include <benchmark/benchmark.h>
+
+#include <carl/core/polynomialfunctions/Division.h>
+#include <carl/core/polynomialfunctions/Factorization_univariate.h>
+#include <carl/core/polynomialfunctions/GCD.h>
+#include <carl/core/polynomialfunctions/Resultant.h>
+#include <carl/core/polynomialfunctions/to_univariate_polynomial.h>
+
+using namespace carl::suite;
+
+// The argument is the number of terms of the operands.
+static void Polynomial_Add(benchmark::State& state) {
+	Generator gen(1);
+	auto vars = variables(3);
+	MVP p = gen.polynomial(vars, static_cast<std::size_t>(state.range(0)), 8);
+	MVP q = gen.polynomial(vars, static_cast<std::size_t>(state.range(0)), 8);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(p + q);
+	}
+}
+BENCHMARK(Polynomial_Add)->RangeMultiplier(4)->Range(8, 512);
+
+static void Polynomial_Mul(benchmark::State& state) {
+	Generator gen(2);
+	auto vars = variables(3);
+	MVP p = gen.polynomial(vars, static_cast<std::size_t>(state.range(0)), 6);
+	MVP q = gen.polynomial(vars, static_cast<std::size_t>(state.range(0)), 6);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(p * q);
+	}
+}
+BENCHMARK(Polynomial_Mul)->RangeMultiplier(2)->Range(4, 64);
+
+static void Polynomial_Div(benchmark::State& state) {
+	Generator gen(3);
+	auto vars = variables(3);
+	MVP q = gen.polynomial(vars, static_cast<std::size_t>(state.range(0)), 4);
+	MVP p = q * gen.polynomial(vars, static_cast<std::size_t>(state.range(0)), 4) + gen.polynomial(vars, 4, 3);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(carl::divide(p, q));
+	}
+}
+BENCHMARK(Polynomial_Div)->RangeMultiplier(2)->Range(4, 32);
+
+// The argument is the degree of the operands, which have a common factor of half their degree.
+static void Polynomial_GCD(benchmark::State& state) {
+	Generator gen(4);
+	carl::Variable x = variables(1)[0];
+	std::size_t degree = static_cast<std::size_t>(state.range(0));
+	UVP g = gen.univariate(x, degree / 2);
+	UVP a = g * gen.univariate(x, degree - degree / 2);
+	UVP b = g * gen.univariate(x, degree - degree / 2);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(carl::gcd(a, b));
+	}
+}
+BENCHMARK(Polynomial_GCD)->RangeMultiplier(2)->Range(4, 32);
+
+static void Polynomial_Factorization(benchmark::State& state) {
+	Generator gen(5);
+	carl::Variable x = variables(1)[0];
+	UVP p(x, Rational(1));
+	for (long i = 0; i < state.range(0); ++i) {
+		p *= gen.univariate(x, static_cast<std::size_t>(gen.integer(1, 3)), 10);
+	}
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(carl::factorization(p));
+	}
+}
+BENCHMARK(Polynomial_Factorization)->DenseRange(2, 8, 2);
+
+// The argument is the degree of the operands in the main variable, the coefficients are polynomials in two other variables.
+static void Polynomial_Resultant(benchmark::State& state) {
+	Generator gen(6);
+	auto vars = variables(3);
+	std::size_t degree = static_cast<std::size_t>(state.range(0));
+	MVP p = gen.polynomial(vars, 2 * degree, degree);
+	MVP q = gen.polynomial(vars, 2 * degree, degree);
+	auto up = carl::to_univariate_polynomial(p, vars[0]);
+	auto uq = carl::to_univariate_polynomial(q, vars[0]);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(carl::resultant(up, uq));
+	}
+}
+BENCHMARK(Polynomial_Resultant)->DenseRange(2, 6, 2);
@@ -0,0 +1,67 @@
+#include "Generator.h"
+
+#include <benchmark/benchmark.h>
+
+#include <carl/ran/real_roots.h>
+
+using namespace carl::suite;
+
+// The argument is the degree of a polynomial with only real roots.
+static void RealRoots_Rooted(benchmark::State& state) {
+	Generator gen(101);
+	carl::Variable x = variables(1)[0];
+	UVP p = gen.rootedUnivariate(x, static_cast<std::size_t>(state.range(0)));
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(carl::real_roots(p));
+	}
+}
+BENCHMARK(RealRoots_Rooted)->DenseRange(4, 16, 4);
+
+// The argument is the degree of a polynomial with random coefficients.
+static void RealRoots_Dense(benchmark::State& state) {
+	Generator gen(102);
+	carl::Variable x = variables(1)[0];
+	UVP p = gen.univariate(x, static_cast<std::size_t>(state.range(0)));
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(carl::real_roots(p));
+	}
+}
+BENCHMARK(RealRoots_Dense)->DenseRange(4, 16, 4);
+
+// The argument is the degree of two random polynomials whose real roots are compared pairwise.
+// Comparisons refine the numbers, hence all but the first iteration measure comparisons of sufficiently refined numbers.
+static void RAN_Compare(benchmark::State& state) {
+	Generator gen(103);
+	carl::Variable x = variables(1)[0];
+	std::size_t degree = static_cast<std::size_t>(state.range(0));
+	auto a = carl::real_roots(gen.univariate(x, degree) * gen.univariate(x, 2)).roots();
+	auto b = carl::real_roots(gen.univariate(x, degree) * gen.univariate(x, 2)).roots();
+	for (auto _ : state) {
+		std::size_t less = 0;
+		for (const auto& ra: a) {
+			for (const auto& rb: b) {
+				if (ra < rb) ++less;
+			}
+		}
+		benchmark::DoNotOptimize(less);
+	}
+}
+BENCHMARK(RAN_Compare)->DenseRange(3, 9, 3);
+
+static void RAN_CompareRational(benchmark::State& state) {
+	Generator gen(104);
+	carl::Variable x = variables(1)[0];
+	auto roots = carl::real_roots(gen.rootedUnivariate(x, 3) * gen.univariate(x, static_cast<std::size_t>(state.range(0)))).roots();
+	std::vector<Rational> pivots;
+	for (std::size_t i = 0; i < 16; ++i) pivots.push_back(gen.rational(20));
+	for (auto _ : state) {
+		std::size_t less = 0;
+		for (const auto& r: roots) {
+			for (const auto& p: pivots) {
+				if (r < p) ++less;
+			}
+		}
+		benchmark::DoNotOptimize(less);
+	}
+}
+BENCHMARK(RAN_CompareRational)->DenseRange(2, 8, 2);
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <carl/core/MultivariatePolynomial.h>
+#include <carl/core/UnivariatePolynomial.h>
+#include <carl/core/VariablePool.h>
+#include <carl/numbers/numbers.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace carl::suite {
+
+using Rational = mpq_class;
+using MVP = carl::MultivariatePolynomial<Rational>;
+using UVP = carl::UnivariatePolynomial<Rational>;
+
+/// Seed of all generators, can be set by the --carl_seed option.
+std::uint64_t& seed();
+
+/// Return the first n variables of a fixed set of real variables.
+std::vector<Variable> variables(std::size_t n);
+
+/**
+ * Seeded generator for random workloads.
+ * Every benchmark uses its own generator with a distinct salt, hence its inputs only depend on the seed and the size parameters,
+ * but not on which other benchmarks are run.
+ */
+class Generator {
+	std::mt19937_64 mRNG;
+public:
+	explicit Generator(std::uint64_t salt): mRNG(seed() ^ (salt * 0x9e3779b97f4a7c15ULL)) {}
+
+	/// Return a uniformly distributed integer from [lower, upper].
+	long integer(long lower, long upper) {
+		return std::uniform_int_distribution<long>(lower, upper)(mRNG);
+	}
+	/// Return a nonzero integer from [-bound, bound].
+	Rational coefficient(long bound = 100) {
+		long res = integer(-bound, bound - 1);
+		return Rational(res >= 0 ? res + 1 : res);
+	}
+	/// Return a rational number with numerator and denominator from [-bound, bound] and [1, bound].
+	Rational rational(long bound = 100) {
+		return Rational(integer(-bound, bound), integer(1, bound));
+	}
+
+	/// Return a polynomial with (up to) the given number of terms of total degree at most degree.
+	MVP polynomial(const std::vector<Variable>& vars, std::size_t terms, std::size_t degree) {
+		std::vector<Term<Rational>> res;
+		for (std::size_t i = 0; i < terms; ++i) {
+			Term<Rational> t(coefficient());
+			std::size_t remaining = static_cast<std::size_t>(integer(0, static_cast<long>(degree)));
+			for (; remaining > 0; --remaining) {
+				t = t * vars[static_cast<std::size_t>(integer(0, static_cast<long>(vars.size()) - 1))];
+			}
+			res.push_back(t);
+		}
+		return MVP(res);
+	}
+	/// Return a dense univariate polynomial of the given degree.
+	UVP univariate(Variable x, std::size_t degree, long bound = 100) {
+		std::vector<Rational> coeffs;
+		for (std::size_t i = 0; i <= degree; ++i) coeffs.push_back(coefficient(bound));
+		return UVP(x, coeffs);
+	}
+	/// Return the product of linear factors with random rational roots, which has as many real roots as its degree.
+	UVP rootedUnivariate(Variable x, std::size_t degree, long bound = 20) {
+		UVP res(x, Rational(1));
+		for (std::size_t i = 0; i < degree; ++i) {
+			res *= UVP(x, {-rational(bound), Rational(1)});
+		}
+		return res;
+	}
+};
+
+}
@@ -0,0 +1,76 @@
+#!/usr/bin/env python3
+"""
+Compares two runs of the benchmark suite and reports regressions.
+
+Both files are JSON outputs of google benchmark, for example obtained with
+
+    runBenchmarkSuite --benchmark_out=results.json --benchmark_out_format=json
+
+Benchmarks whose time increased by more than the threshold are reported as regressions,
+in which case the exit code is 1. If benchmarks were repeated, the mean is compared.
+"""
+
+import argparse
+import json
+import sys
+
+UNITS = {"ns": 1, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def load(filename, metric):
+    """Returns a mapping from benchmark names to times in nanoseconds."""
+    with open(filename) as f:
+        data = json.load(f)
+    iterations = {}
+    means = {}
+    for b in data["benchmarks"]:
+        time = b[metric] * UNITS[b.get("time_unit", "ns")]
+        if b.get("run_type") == "aggregate":
+            if b.get("aggregate_name") == "mean":
+                means[b["run_name"]] = time
+        else:
+            name = b.get("run_name", b["name"])
+            iterations.setdefault(name, []).append(time)
+    result = {name: sum(times) / len(times) for name, times in iterations.items()}
+    result.update(means)
+    return result
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("baseline", help="results of the baseline run")
+    parser.add_argument("contender", help="results of the run to check")
+    parser.add_argument("--threshold", type=float, default=0.1, help="relative slowdown that counts as regression (default: 0.1)")
+    parser.add_argument("--metric", choices=["cpu_time", "real_time"], default="cpu_time", help="time to compare (default: cpu_time)")
+    args = parser.parse_args()
+
+    baseline = load(args.baseline, args.metric)
+    contender = load(args.contender, args.metric)
+
+    regressions = []
+    width = max((len(name) for name in baseline.keys() | contender.keys()), default=0)
+    print("{:<{w}} {:>14} {:>14} {:>9}".format("Benchmark", "Baseline [ns]", "Contender [ns]", "Change", w=width))
+    for name in sorted(baseline.keys() & contender.keys()):
+        old = baseline[name]
+        new = contender[name]
+        change = (new - old) / old if old > 0 else 0.0
+        flag = ""
+        if change > args.threshold:
+            flag = "  REGRESSION"
+            regressions.append(name)
+        elif change < -args.threshold:
+            flag = "  improvement"
+        print("{:<{w}} {:>14.0f} {:>14.0f} {:>+8.1%}{}".format(name, old, new, change, flag, w=width))
+    for name in sorted(baseline.keys() - contender.keys()):
+        print("{:<{w}} missing in contender".format(name, w=width))
+    for name in sorted(contender.keys() - baseline.keys()):
+        print("{:<{w}} missing in baseline".format(name, w=width))
+
+    if regressions:
+        print("\n{} regression(s) beyond {:.0%}: {}".format(len(regressions), args.threshold, ", ".join(regressions)))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,54 @@
+/**
+ * @file main.cpp
+ *
+ * Benchmark suite for regression tracking.
+ * All workloads are generated from a seed that can be set by `--carl_seed=<n>`, all other options are passed to google benchmark.
+ * For example, the following writes the results of a run to a JSON file:
+ *
+ *     runBenchmarkSuite --benchmark_out=results.json --benchmark_out_format=json
+ *
+ * Two such files can be compared with compare.py, which reports regressions beyond a threshold.
+ */
+
+#include "Generator.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstring>
+#include <iostream>
+#include <string>
+
+namespace carl::suite {
+
+std::uint64_t& seed() {
+	static std::uint64_t s = 42;
+	return s;
+}
+
+std::vector<Variable> variables(std::size_t n) {
+	static std::vector<Variable> vars;
+	while (vars.size() < n) {
+		vars.push_back(freshRealVariable("x" + std::to_string(vars.size())));
+	}
+	return std::vector<Variable>(vars.begin(), vars.begin() + static_cast<long>(n));
+}
+
+}
+
+int main(int argc, char** argv) {
+	const char* option = "--carl_seed=";
+	int args = 0;
+	for (int i = 0; i < argc; ++i) {
+		if (std::strncmp(argv[i], option, std::strlen(option)) == 0) {
+			carl::suite::seed() = std::stoull(argv[i] + std::strlen(option));
+		} else {
+			argv[args++] = argv[i];
+		}
+	}
+	argc = args;
+	std::cerr << "Seed: " << carl::suite::seed() << std::endl;
+	benchmark::Initialize(&argc, argv);
+	if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+	benchmark::RunSpecifiedBenchmarks();
+	return 0;
+}
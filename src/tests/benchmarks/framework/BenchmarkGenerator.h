@@ -60,7 +60,7 @@ public:
 		return bi.variables[uniDist(bi.variables.size())];
 	}
     
-	std::shared_ptr<const carl::Monomial> randomMonomial(std::size_t degree) const {
+	carl::Monomial::Arg randomMonomial(std::size_t degree) const {
 		Monomial::Arg res;
 		for (unsigned d = 1; d < degree; d++) {
             res = res * randomVariable();
@@ -0,0 +1,56 @@
+#include "gtest/gtest.h"
+#include <carl-extpolys/CompiledRationalFunction.h>
+#include <carl/util/stringparser.h>
+
+#include "../Common.h"
+
+using namespace carl;
+
+typedef MultivariatePolynomial<Rational> Pol;
+typedef FactorizedPolynomial<Pol> FPol;
+typedef RationalFunction<Pol> RFunc;
+typedef RationalFunction<FPol> RFactFunc;
+typedef Cache<PolynomialFactorizationPair<Pol>> CachePol;
+
+TEST(CompiledRationalFunction, Polynomial)
+{
+	StringParser sp;
+	sp.setVariables({"x", "y"});
+	Pol p = sp.parseMultivariatePolynomial<Rational>("3*x^2*y + x + (-2)*y^3 + 5");
+	CompiledRationalFunction<Pol> c(p);
+	ASSERT_EQ(2, c.variables().size());
+	std::map<Variable, Rational> point = {{c.variables()[0], Rational(2)}, {c.variables()[1], Rational(-1)/3}};
+	EXPECT_EQ(carl::evaluate(p, point), c.evaluate(point));
+	EXPECT_NEAR(toDouble(carl::evaluate(p, point)), c.evaluate(std::vector<double>({2.0, -1.0/3})), 1e-12);
+}
+
+TEST(CompiledRationalFunction, SharedFactors)
+{
+	StringParser sp;
+	sp.setVariables({"x", "y"});
+	auto cache = std::make_shared<CachePol>();
+	FPol f1(sp.parseMultivariatePolynomial<Rational>("x + y"), cache);
+	FPol f2(sp.parseMultivariatePolynomial<Rational>("x + (-1)*y + 1"), cache);
+	FPol f3(sp.parseMultivariatePolynomial<Rational>("y^2 + 1"), cache);
+	RFactFunc rf(f1 * f1 * f2, f2 * f3);
+	CompiledRationalFunction<FPol> c(rf);
+	// the common factor is evaluated only once
+	EXPECT_GE(3, c.numberOfFactors());
+
+	std::vector<std::vector<Rational>> exact;
+	std::vector<std::vector<double>> points;
+	for (int i = 0; i < 37; ++i) {
+		exact.push_back({Rational(i) / 7, Rational(5 - i) / 3});
+		points.push_back({toDouble(exact.back()[0]), toDouble(exact.back()[1])});
+	}
+	auto exactRes = c.evaluate(exact, 2);
+	auto res = c.evaluate(points, 1);
+	auto parallelRes = c.evaluate(points, 3);
+	ASSERT_EQ(points.size(), res.size());
+	for (std::size_t i = 0; i < points.size(); ++i) {
+		std::map<Variable, Rational> m = {{c.variables()[0], exact[i][0]}, {c.variables()[1], exact[i][1]}};
+		EXPECT_EQ(rf.evaluate(m), exactRes[i]);
+		EXPECT_NEAR(toDouble(exactRes[i]), res[i], 1e-9);
+		EXPECT_EQ(res[i], parallelRes[i]);
+	}
+}
@@ -10,6 +10,8 @@
 
 #include "../Common.h"
 
+#include <thread>
+
 using namespace carl;
 
 typedef mpq_class Rational;
@@ -343,6 +345,66 @@ TEST(FactorizedPolynomial, GCD)
     EXPECT_EQ( fpolGCD, ft3 );
 }
 
+TEST(FactorizedPolynomial, RepeatedGCD)
+{
+    carl::VariablePool::getInstance().clear();
+    StringParser sp;
+    sp.setVariables({"x", "y"});
+
+    auto pCache = std::make_shared<CachePol>();
+    FPol f1( sp.parseMultivariatePolynomial<Rational>("x+1"), pCache );
+    FPol f2( sp.parseMultivariatePolynomial<Rational>("y+2"), pCache );
+    FPol f3( sp.parseMultivariatePolynomial<Rational>("x*y+3"), pCache );
+    FPol f4( sp.parseMultivariatePolynomial<Rational>("x^2+y"), pCache );
+
+    // Factorizations with overlapping factors meet repeatedly, the coprimality of their factors is only computed once.
+    FPol fpA = f1 * f2 * f3;
+    FPol fpB = f1 * f3 * f4;
+    for( int i = 0; i < 3; ++i )
+    {
+        FPol fpRestA;
+        FPol fpRestB;
+        FPol fpGCD = gcd( fpA, fpB, fpRestA, fpRestB );
+        EXPECT_EQ( computePolynomial( f1 * f3 ), computePolynomial( fpGCD ) );
+        EXPECT_EQ( computePolynomial( f2 ), computePolynomial( fpRestA ) );
+        EXPECT_EQ( computePolynomial( fpB ), computePolynomial( fpRestB ) * computePolynomial( fpGCD ) );
+        fpB = fpB * f4;
+    }
+}
+
+TEST(FactorizedPolynomial, BoundedCoprimeMemo)
+{
+    carl::VariablePool::getInstance().clear();
+    Variable x = freshRealVariable("x");
+    Variable y = freshRealVariable("y");
+
+    auto pCache = std::make_shared<CachePol>();
+    FPol common( Pol(y) + Rational(1), pCache );
+    std::vector<FPol> factors;
+    for( int i = 0; i < 100; ++i )
+        factors.emplace_back( Pol(x) + Rational(i), pCache );
+
+    // The common factor is coprime to more factors than are remembered, gcds stay correct nonetheless.
+    for( int round = 0; round < 2; ++round )
+    {
+        for( std::size_t i = 0; i + 1 < factors.size(); ++i )
+        {
+            FPol fpRestA;
+            FPol fpRestB;
+            FPol fpGCD = gcd( common * factors[i], common * factors[i+1], fpRestA, fpRestB );
+            EXPECT_EQ( computePolynomial( common ), computePolynomial( fpGCD ) );
+            EXPECT_EQ( computePolynomial( factors[i] ), computePolynomial( fpRestA ) );
+            EXPECT_EQ( computePolynomial( factors[i+1] ), computePolynomial( fpRestB ) );
+        }
+    }
+    // Destroying the partners removes them from the memo of the common factor.
+    factors.clear();
+    FPol fpRestA;
+    FPol fpRestB;
+    FPol fpGCD = gcd( common * FPol( Pol(x) + Rational(1), pCache ), common * FPol( Pol(x) + Rational(2), pCache ), fpRestA, fpRestB );
+    EXPECT_EQ( computePolynomial( common ), computePolynomial( fpGCD ) );
+}
+
 TEST(FactorizedPolynomial, Flattening)
 {
     carl::VariablePool::getInstance().clear();
@@ -508,6 +570,51 @@ TEST(FactorizedPolynomial, Destructor)
     EXPECT_EQ( pQuot, computePolynomial( fpQuot ) );
 }
 
+TEST(FactorizedPolynomial, SharedCache)
+{
+    carl::VariablePool::getInstance().clear();
+    Variable x = freshRealVariable("x");
+    Variable y = freshRealVariable("y");
+
+    auto pCache = std::make_shared<CachePol>( 8 );
+    std::vector<FPol> fpolys;
+    for( int i = 0; i < 32; ++i )
+        fpolys.emplace_back( Pol(x) + Rational(i), pCache );
+    EXPECT_EQ( 32, pCache->size() );
+
+    // Copying and destroying factorized polynomials only (de)registers their cache entries, which may be done concurrently.
+    std::vector<std::thread> threads;
+    std::vector<bool> consistent( 4, true );
+    for( std::size_t t = 0; t < 4; ++t )
+    {
+        threads.emplace_back( [&fpolys, &consistent, t]()
+        {
+            for( int round = 0; round < 1000; ++round )
+            {
+                for( const auto& fp : fpolys )
+                {
+                    FPol copy( fp );
+                    if( copy.cacheRef() != fp.cacheRef() )
+                        consistent[t] = false;
+                }
+            }
+        } );
+    }
+    for( auto& thread : threads )
+        thread.join();
+    for( bool c : consistent )
+        EXPECT_TRUE( c );
+    EXPECT_EQ( 32, pCache->size() );
+
+    // Exceeding the maximum cache size triggers the cleaning in the background, while the cache is still used.
+    fpolys.clear();
+    FPol fp( Pol(y), pCache );
+    FPol fp2( Pol(x) + Rational(3), pCache );
+    pCache->clean();
+    EXPECT_EQ( Pol(y), computePolynomial( fp ) );
+    EXPECT_EQ( Pol(x) + Rational(3), computePolynomial( fp2 ) );
+}
+
 TEST(FactorizedPolynomial, Equality)
 {
     carl::VariablePool::getInstance().clear();
@@ -653,4 +760,7 @@ TEST(FactorizedPolynomial, Derivation)
     Pol p3({(Rational)126*x*x});
     FPol fp4( p3, pCache );
     EXPECT_EQ( fp4, derivation );
+
+    Pol p5({(Rational)252*x});
+    EXPECT_EQ( p5, computePolynomial( fp3.derivative(x, 2) ) );
 }
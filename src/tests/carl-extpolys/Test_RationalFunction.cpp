@@ -310,6 +310,69 @@ TEST(RationalFunction, Derivative)
 	EXPECT_EQ(r2, r1.derivative(sp.variables().at("x")));
 }
 
+TEST(RationalFunction, GradientAndHessian)
+{
+    StringParser sp;
+    sp.setVariables({"x", "y"});
+    Variable x = sp.variables().at("x");
+    Variable y = sp.variables().at("y");
+
+    Pol pu = sp.parseMultivariatePolynomial<Rational>("x^2*y + 1");
+    Pol pv1 = sp.parseMultivariatePolynomial<Rational>("x + y");
+    Pol pv2 = sp.parseMultivariatePolynomial<Rational>("x + 2");
+
+    auto pCache = std::make_shared<CachePol>();
+    FPol fu(pu, pCache);
+    FPol fv1(pv1, pCache);
+    FPol fv2(pv2, pCache);
+
+    RFunc r(pu, pv1*pv1*pv2);
+    RFactFunc rf(fu, fv1*fv1*fv2);
+    std::map<Variable,Rational> point = {{x, Rational(1)}, {y, Rational(2)}};
+
+    auto gradient = r.gradient({x, y});
+    auto factorizedGradient = rf.gradient({x, y});
+    ASSERT_EQ(2, gradient.size());
+    ASSERT_EQ(2, factorizedGradient.size());
+    EXPECT_EQ(Rational(1)/Rational(27), gradient[0].evaluate(point));
+    for (std::size_t i = 0; i < 2; ++i) {
+        EXPECT_EQ(gradient[i].evaluate(point), factorizedGradient[i].evaluate(point));
+    }
+
+    auto hessian = r.hessian({x, y});
+    auto factorizedHessian = rf.hessian({x, y});
+    for (std::size_t i = 0; i < 2; ++i) {
+        for (std::size_t j = 0; j < 2; ++j) {
+            EXPECT_EQ(hessian[i][j].evaluate(point), factorizedHessian[i][j].evaluate(point));
+        }
+    }
+    EXPECT_EQ(hessian[0][1].evaluate(point), hessian[1][0].evaluate(point));
+    EXPECT_EQ(hessian[0][0].evaluate(point), r.derivative(x, 2).evaluate(point));
+    EXPECT_EQ(factorizedHessian[1][1].evaluate(point), rf.derivative(y, 2).evaluate(point));
+}
+
+TEST(RationalFunction, NthDerivative)
+{
+    StringParser sp;
+    sp.setVariables({"x", "y"});
+    Variable x = sp.variables().at("x");
+    Variable y = sp.variables().at("y");
+
+    Pol pu = sp.parseMultivariatePolynomial<Rational>("x^2*y + 1");
+    Pol pv = sp.parseMultivariatePolynomial<Rational>("x^3 + x*y^2 + 2*y^3");
+
+    auto pCache = std::make_shared<CachePol>();
+    RFunc r(pu, pv);
+    RFactFunc rf(FPol(pu, pCache), FPol(pv, pCache));
+    std::map<Variable,Rational> point = {{x, Rational(1)}, {y, Rational(2)}};
+
+    // The third derivative of u/v has the denominator v^4, not v^8
+    auto third = r.derivative(x, 3);
+    EXPECT_EQ(4 * pv.totalDegree(), third.denominator().totalDegree());
+    EXPECT_EQ(third.evaluate(point), rf.derivative(x, 3).evaluate(point));
+    EXPECT_EQ(third.evaluate(point), r.derivative(x).derivative(x).derivative(x).evaluate(point));
+}
+
 TEST(RationalFunction, Simplification)
 {
     //carl::VariablePool::getInstance().clear();
@@ -342,6 +405,48 @@ TEST(RationalFunction, Simplification)
     EXPECT_TRUE( r2.nominator().isOne() );
 }
 
+TEST(RationalFunction, LazySimplification)
+{
+    typedef RationalFunction<Pol,true> RFuncAS;
+    Variable x = freshRealVariable("x");
+    Pol px(x);
+    RFuncAS a( px + Rational(1), px - Rational(1) );
+    RFuncAS b( Pol(Rational(1)), px*px - Rational(1) );
+
+    RFuncAS eager = a;
+    for( int i = 0; i < 3; ++i )
+        eager += b;
+    EXPECT_TRUE( eager.isSimplified() );
+
+    RFuncAS::setLazySimplification( 100 );
+    RFuncAS lazy = a;
+    for( int i = 0; i < 3; ++i )
+        lazy += b;
+    EXPECT_FALSE( lazy.isSimplified() );
+    EXPECT_EQ( eager.evaluate({{x, Rational(3)}}), lazy.evaluate({{x, Rational(3)}}) );
+    EXPECT_EQ( eager, lazy );
+    EXPECT_TRUE( lazy.isSimplified() );
+
+    // The common factor is eliminated as soon as the bound is reached.
+    RFuncAS::setLazySimplification( 4 );
+    RFuncAS bounded = a;
+    bounded += b;
+    EXPECT_TRUE( bounded.isSimplified() );
+
+    // Observers eliminate a deferred common factor, hence equal rational functions hash equally.
+    RFuncAS::setLazySimplification( 100 );
+    Variable y = freshRealVariable("y");
+    Pol py(y);
+    RFuncAS deferred( px*py, py );
+    RFuncAS plain( px, Pol(Rational(1)) );
+    EXPECT_EQ( std::hash<RFuncAS>()( plain ), std::hash<RFuncAS>()( deferred ) );
+    EXPECT_EQ( plain, deferred );
+    EXPECT_EQ( std::hash<RFuncAS>()( RFuncAS( Pol(Rational(1)), px ) ), std::hash<RFuncAS>()( RFuncAS( px*py, py ).inverse() ) );
+    EXPECT_TRUE( RFuncAS( Rational(2)*px, px ).isConstant() );
+    EXPECT_EQ( Rational(2), RFuncAS( Rational(2)*px*py, px*py ).constantPart() );
+    RFuncAS::setLazySimplification( 0 );
+}
+
 TEST(RationalFunction, Evaluation)
 {
     //carl::VariablePool::getInstance().clear();
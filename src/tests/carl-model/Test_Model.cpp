@@ -43,3 +43,42 @@ TYPED_TEST(Model, ModelSubstitution)
 	EXPECT_TRUE(m.at(x).asRational() == TypeParam(3));
 	EXPECT_TRUE(m.at(y).isSubstitution());
 }
+
+TYPED_TEST(Model, DenseView)
+{
+	using Poly = carl::MultivariatePolynomial<TypeParam>;
+	using ModelPolySubs = carl::ModelPolynomialSubstitution<TypeParam,Poly>;
+
+	carl::Variable x = carl::freshRealVariable("x");
+	carl::Variable y = carl::freshRealVariable("y");
+	carl::Variable z = carl::freshIntegerVariable("z");
+	carl::Model<TypeParam,Poly> m;
+	m.assign(x, TypeParam(3));
+	m.emplace(carl::ModelVariable(y), carl::createSubstitution<TypeParam,Poly,ModelPolySubs>(Poly(TypeParam(2)) * x));
+	EXPECT_EQ(nullptr, m.denseView());
+	m.enableDenseView();
+	ASSERT_NE(nullptr, m.denseView());
+
+	ASSERT_NE(nullptr, m.denseView()->rational(x));
+	EXPECT_EQ(TypeParam(3), *m.denseView()->rational(x));
+	EXPECT_EQ(nullptr, m.denseView()->rational(y));
+	EXPECT_EQ(nullptr, m.findRational(z));
+	ASSERT_NE(nullptr, m.findRational(y));
+	EXPECT_EQ(TypeParam(6), *m.findRational(y));
+
+	// the view is updated incrementally
+	m.assign(x, TypeParam(4));
+	m.assign(z, TypeParam(1));
+	EXPECT_EQ(TypeParam(4), *m.denseView()->rational(x));
+	EXPECT_EQ(TypeParam(8), *m.findRational(y));
+	EXPECT_EQ(TypeParam(1), *m.findRational(z));
+	m.erase(z);
+	EXPECT_EQ(nullptr, m.findRational(z));
+	EXPECT_EQ(nullptr, m.findEvaluated(z));
+
+	// copies build their own view
+	carl::Model<TypeParam,Poly> copy(m);
+	copy.assign(x, TypeParam(5));
+	EXPECT_EQ(TypeParam(5), *copy.findRational(x));
+	EXPECT_EQ(TypeParam(4), *m.findRational(x));
+}
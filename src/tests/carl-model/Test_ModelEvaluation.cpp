@@ -129,3 +129,104 @@ TEST(ModelEvaluation, EvaluateBV)
 	auto res = carl::model::evaluate(f, m);
 	std::cout << res << std::endl;
 }
+
+TEST(ModelEvaluation, DenseView)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Pol p = Pol(x) * Pol(y) + Pol(1);
+	ModelT m;
+	m.assign(x, Rational(2));
+	m.enableDenseView();
+	Pol q = p;
+	model::substituteIn(q, m);
+	EXPECT_EQ(Pol(Rational(2)) * Pol(y) + Pol(1), q);
+
+	m.assign(y, Rational(3));
+	auto res = model::evaluate(p, m);
+	EXPECT_TRUE(res.isRational());
+	EXPECT_EQ(Rational(7), res.asRational());
+}
+
+TEST(ModelEvaluation, IncrementalEvaluation)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable z = freshRealVariable("z");
+	Variable w = freshRealVariable("w");
+	ModelT m;
+	m.enableFormulaCache();
+	m.assign(x, Rational(1));
+	m.assign(w, Rational(0));
+	// y = 2*x, z = y + 1
+	m.emplace(y, carl::createSubstitution<Rational,Pol,carl::ModelPolynomialSubstitution<Rational, Pol>>(Pol(Rational(2)) * x));
+	m.emplace(z, carl::createSubstitution<Rational,Pol,carl::ModelPolynomialSubstitution<Rational, Pol>>(Pol(y) + Pol(1)));
+	EXPECT_EQ(Rational(3), m.evaluated(z).asRational());
+
+	FormulaT fz(ConstraintT(Pol(z) - Pol(3), carl::Relation::EQ));
+	FormulaT fw(ConstraintT(Pol(w), carl::Relation::EQ));
+	EXPECT_TRUE(model::evaluate(fz, m).asBool());
+	EXPECT_TRUE(model::evaluate(fw, m).asBool());
+	EXPECT_NE(nullptr, m.cachedEvaluation(fz));
+	EXPECT_NE(nullptr, m.cachedEvaluation(fw));
+
+	// changing x invalidates y, z and fz, but not fw
+	m.assign(x, Rational(2));
+	EXPECT_EQ(nullptr, m.cachedEvaluation(fz));
+	EXPECT_NE(nullptr, m.cachedEvaluation(fw));
+	EXPECT_EQ(Rational(5), m.evaluated(z).asRational());
+	EXPECT_FALSE(model::evaluate(fz, m).asBool());
+
+	m.assign(w, Rational(1));
+	EXPECT_EQ(nullptr, m.cachedEvaluation(fw));
+	EXPECT_FALSE(model::evaluate(fw, m).asBool());
+	EXPECT_NE(nullptr, m.cachedEvaluation(fz));
+
+	// a substitution over a variable that is assigned later
+	Variable v = freshRealVariable("v");
+	Variable u = freshRealVariable("u");
+	m.emplace(u, carl::createSubstitution<Rational,Pol,carl::ModelPolynomialSubstitution<Rational, Pol>>(Pol(v) + Pol(x)));
+	m.assign(v, Rational(1));
+	EXPECT_EQ(Rational(3), m.evaluated(u).asRational());
+	m.erase(v);
+	m.assign(v, Rational(2));
+	EXPECT_EQ(Rational(4), m.evaluated(u).asRational());
+}
+
+TEST(ModelEvaluation, FormulaCache)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	ModelT m;
+	m.assign(x, Rational(1));
+	m.assign(y, Rational(2));
+	FormulaT fx(ConstraintT(Pol(x) - Pol(1), carl::Relation::EQ));
+	FormulaT fy(ConstraintT(Pol(y) - Pol(2), carl::Relation::EQ));
+	FormulaT fxy(ConstraintT(Pol(x) - Pol(y), carl::Relation::LESS));
+
+	// formula caching is disabled by default
+	EXPECT_TRUE(model::evaluate(fx, m).asBool());
+	EXPECT_EQ(nullptr, m.cachedEvaluation(fx));
+	EXPECT_EQ(0, m.formulaCacheSize());
+
+	// the least recently used evaluation is evicted
+	m.enableFormulaCache(2);
+	EXPECT_TRUE(model::evaluate(fx, m).asBool());
+	EXPECT_TRUE(model::evaluate(fy, m).asBool());
+	EXPECT_TRUE(model::evaluate(fx, m).asBool());
+	EXPECT_TRUE(model::evaluate(fxy, m).asBool());
+	EXPECT_EQ(2, m.formulaCacheSize());
+	EXPECT_NE(nullptr, m.cachedEvaluation(fx));
+	EXPECT_EQ(nullptr, m.cachedEvaluation(fy));
+	EXPECT_NE(nullptr, m.cachedEvaluation(fxy));
+
+	// invalidation drops all evaluations depending on x
+	m.assign(x, Rational(3));
+	EXPECT_EQ(0, m.formulaCacheSize());
+	EXPECT_FALSE(model::evaluate(fxy, m).asBool());
+
+	m.disableFormulaCache();
+	EXPECT_EQ(0, m.formulaCacheSize());
+	EXPECT_FALSE(model::evaluate(fx, m).asBool());
+	EXPECT_EQ(0, m.formulaCacheSize());
+}
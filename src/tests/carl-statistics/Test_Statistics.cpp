@@ -1,9 +1,15 @@
 #include "../get_output.h"
 
+#include <carl-statistics/Instrumentation.h>
+#include <carl-statistics/Profiler.h>
 #include <carl-statistics/Statistics.h>
+#include <carl-statistics/StatisticsSnapshot.h>
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <chrono>
+#include <fstream>
+#include <sstream>
 #include <thread>
 
 TEST(Statistics, Timer)
@@ -13,4 +19,222 @@ TEST(Statistics, Timer)
 	carl::statistics::timer timer;
 	timer.finish(start);
 	ASSERT_EQ(timer.count(), 1);
+	EXPECT_GE(timer.overall_ms(), 45);
+	EXPECT_LE(timer.overall_ms(), 5000);
+	EXPECT_GE(timer.percentile_ns(50), 25000000);
+}
+
+TEST(Statistics, TimerResolution)
+{
+	carl::statistics::timer timer;
+	for (std::size_t i = 0; i < 100; ++i) {
+		auto start = carl::statistics::timer::start();
+		timer.finish(start);
+	}
+	EXPECT_EQ(timer.count(), 100);
+	EXPECT_EQ(timer.overall_ms(), 0);
+	EXPECT_LE(timer.percentile_ns(50), timer.percentile_ns(99));
+
+	carl::statistics::timer other;
+	other.merge(timer);
+	other.merge(timer);
+	EXPECT_EQ(other.count(), 200);
+}
+
+TEST(Statistics, Histogram)
+{
+	carl::statistics::histogram h;
+	for (std::size_t v: {0, 1, 2, 3, 4, 100}) h.add(v);
+	EXPECT_EQ(h.count(), 6);
+	EXPECT_EQ(h.max(), 100);
+	EXPECT_EQ(h.buckets().size(), 8);
+	EXPECT_EQ(h.buckets()[0], 1);
+	EXPECT_EQ(h.buckets()[1], 1);
+	EXPECT_EQ(h.buckets()[2], 2);
+	EXPECT_EQ(h.buckets()[3], 1);
+	EXPECT_EQ(h.buckets()[7], 1);
+	EXPECT_EQ(carl::statistics::histogram::lower_bound(7), 64);
+}
+
+TEST(Statistics, HistogramQuantile)
+{
+	carl::statistics::histogram h;
+	for (std::size_t v = 1; v <= 100; ++v) h.add(v);
+	EXPECT_EQ(h.quantile(0), 1);
+	EXPECT_EQ(h.quantile(1), 100);
+	EXPECT_GE(h.quantile(0.5), 32);
+	EXPECT_LE(h.quantile(0.5), 63);
+	carl::statistics::histogram g;
+	g.add(1000);
+	g.merge(h);
+	EXPECT_EQ(g.count(), 101);
+	EXPECT_EQ(g.max(), 1000);
+}
+
+TEST(Statistics, Profiler)
+{
+	auto& profiler = carl::statistics::profiler::getInstance();
+	profiler.reset();
+	auto work = [](){
+		for (std::size_t i = 0; i < 10; ++i) {
+			carl::statistics::profile_scope outer("outer");
+			carl::statistics::profile_scope inner("inner");
+		}
+	};
+	std::thread t(work);
+	work();
+	t.join();
+	auto result = profiler.collect();
+	EXPECT_EQ(result["outer"].count(), 20);
+	EXPECT_EQ(result["outer/inner"].count(), 20);
+	EXPECT_EQ(result.count("inner"), 0);
+
+	profiler.enable(false);
+	work();
+	profiler.enable(true);
+	EXPECT_EQ(profiler.collect()["outer"].count(), 20);
+}
+
+TEST(Statistics, ProfilerConcurrentCollect)
+{
+	auto& profiler = carl::statistics::profiler::getInstance();
+	profiler.reset();
+	std::atomic<bool> done = false;
+	std::thread t([&](){
+		for (std::size_t i = 0; i < 10000; ++i) {
+			carl::statistics::profile_scope scope("concurrent");
+			carl::statistics::profile_scope nested(i % 2 == 0 ? "even" : "odd");
+		}
+		done = true;
+	});
+	while (!done) {
+		auto result = profiler.collect();
+		EXPECT_LE(result["concurrent"].count(), 10000);
+	}
+	t.join();
+	auto result = profiler.collect();
+	EXPECT_EQ(result["concurrent"].count(), 10000);
+	EXPECT_EQ(result["concurrent/even"].count(), 5000);
+	EXPECT_EQ(result["concurrent/odd"].count(), 5000);
+	EXPECT_LE(result["concurrent/odd"].overall_ns(), result["concurrent"].overall_ns());
+
+	profiler.reset();
+	result = profiler.collect();
+	EXPECT_EQ(result["concurrent"].count(), 0);
+	EXPECT_EQ(result["concurrent"].overall_ns(), 0);
+	EXPECT_EQ(result["concurrent"].percentile_ns(100), 0);
+}
+
+TEST(Statistics, TimerCalibration)
+{
+	auto ratio = carl::statistics::timing::nanoseconds_per_tick();
+	EXPECT_GT(ratio, 0);
+	EXPECT_EQ(ratio, carl::statistics::timing::nanoseconds_per_tick());
+}
+
+class MetricsStatistics: public carl::statistics::Statistics {
+public:
+	carl::statistics::counter calls;
+	carl::statistics::gauge size;
+	carl::statistics::concurrent_histogram degrees;
+	MetricsStatistics() {
+		addMetric("calls", calls);
+		addMetric("size", size);
+		addMetric("degrees", degrees);
+	}
+	void collect() override {
+		addKeyValuePair("solver", std::string("test"));
+	}
+};
+
+TEST(Statistics, Export)
+{
+	auto& stats = carl::statistics::get<MetricsStatistics>("metrics");
+	stats.calls.inc(3);
+	stats.size.set(5);
+	stats.size.add(-2);
+	for (std::size_t d: {1, 2, 3, 100}) stats.degrees.add(d);
+	stats.collect();
+
+	std::stringstream json;
+	json << carl::statistics::statistics_as_json();
+	EXPECT_NE(json.str().find("\"metrics\": {"), std::string::npos);
+	EXPECT_NE(json.str().find("\"calls\": 3"), std::string::npos);
+	EXPECT_NE(json.str().find("\"size\": 3"), std::string::npos);
+	EXPECT_NE(json.str().find("\"solver\": \"test\""), std::string::npos);
+	EXPECT_NE(json.str().find("\"degrees\": {\"count\": 4, \"sum\": 106, \"max\": 100"), std::string::npos);
+
+	std::stringstream prometheus;
+	prometheus << carl::statistics::statistics_as_prometheus();
+	EXPECT_NE(prometheus.str().find("# TYPE carl_metrics_calls counter\ncarl_metrics_calls 3\n"), std::string::npos);
+	EXPECT_NE(prometheus.str().find("carl_metrics_size 3\n"), std::string::npos);
+	EXPECT_NE(prometheus.str().find("carl_metrics_degrees_bucket{le=\"+Inf\"} 4\n"), std::string::npos);
+	EXPECT_NE(prometheus.str().find("carl_metrics_degrees_bucket{le=\"3\"} 3\n"), std::string::npos);
+	EXPECT_EQ(prometheus.str().find("solver"), std::string::npos);
+
+	std::stringstream smtlib;
+	smtlib << carl::statistics::statistics_as_smtlib();
+	EXPECT_NE(smtlib.str().find(":calls"), std::string::npos);
+
+	std::string filename = testing::TempDir() + "carl_statistics_snapshot.json";
+	carl::statistics::StatisticsSnapshotWriter writer;
+	writer.start(filename, std::chrono::milliseconds(5));
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	stats.calls.inc();
+	writer.stop();
+	EXPECT_FALSE(writer.running());
+	std::ifstream file(filename);
+	std::stringstream snapshot;
+	snapshot << file.rdbuf();
+	EXPECT_NE(snapshot.str().find("\"calls\": 4"), std::string::npos);
+	std::remove(filename.c_str());
+}
+
+class CollectedStatistics: public carl::statistics::Statistics {
+public:
+	std::size_t value = 0;
+	void collect() override {
+		addKeyValuePair("value", value);
+	}
+};
+
+TEST(Statistics, CollectTwice)
+{
+	auto& stats = carl::statistics::get<CollectedStatistics>("collected");
+	stats.value = 1;
+	stats.collect();
+	EXPECT_EQ("1", stats.collected().at("value"));
+	stats.value = 2;
+	stats.collect();
+	EXPECT_EQ("2", stats.collected().at("value"));
+
+	// the snapshot writer collects before every snapshot
+	stats.value = 7;
+	std::string filename = testing::TempDir() + "carl_statistics_collected.json";
+	carl::statistics::StatisticsSnapshotWriter writer;
+	writer.start(filename, std::chrono::milliseconds(5));
+	writer.stop();
+	std::ifstream file(filename);
+	std::stringstream snapshot;
+	snapshot << file.rdbuf();
+	EXPECT_NE(snapshot.str().find("\"value\": 7"), std::string::npos);
+	std::remove(filename.c_str());
+}
+
+TEST(Statistics, Instrumentation)
+{
+	auto& op = carl::statistics::operation_statistics("instrumented_operation");
+	EXPECT_EQ(&op, &carl::statistics::operation_statistics("instrumented_operation"));
+	{
+		carl::statistics::operation_scope scope(op, carl::statistics::input_size{3, 5, 64});
+	}
+	op.record(carl::statistics::input_size{1, 2, 8}, 100);
+	EXPECT_EQ(op.calls.value(), 2);
+	EXPECT_GE(op.time_ns.value(), 100);
+
+	std::stringstream json;
+	json << carl::statistics::statistics_as_json();
+	EXPECT_NE(json.str().find("\"instrumented_operation\""), std::string::npos);
+	EXPECT_NE(json.str().find("\"degree\": {\"count\": 2, \"sum\": 4, \"max\": 3"), std::string::npos);
+	EXPECT_NE(json.str().find("\"terms\": {\"count\": 2, \"sum\": 7, \"max\": 5"), std::string::npos);
 }
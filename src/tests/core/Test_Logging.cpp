@@ -7,6 +7,8 @@
 #include "../get_output.h"
 
 #include <sstream>
+#include <thread>
+#include <vector>
 
 TEST(Logging, LogLevelOutput)
 {
@@ -45,6 +47,125 @@ TEST(Logging, Logger)
 	UNUSED(logger);
 }
 
+namespace {
+	std::size_t count(const std::string& haystack, const std::string& needle) {
+		std::size_t res = 0;
+		for (auto pos = haystack.find(needle); pos != std::string::npos; pos = haystack.find(needle, pos + 1)) ++res;
+		return res;
+	}
+	void emit(const std::string& channel, const std::string& msg) {
+		std::stringstream ss;
+		ss << msg;
+		carl::logging::logger().log(carl::logging::LogLevel::LVL_INFO, channel, ss, carl::logging::RecordInfo{"file", "func", 0});
+	}
+}
+
+TEST(Logging, VisibilityCache)
+{
+	using carl::logging::LogLevel;
+	// sinks cannot be removed, hence the stream must outlive the test
+	static std::stringstream out;
+	auto& logger = carl::logging::logger();
+	logger.configure("test_visibility", out);
+	logger.filter("test_visibility")("carltest.visibility", LogLevel::LVL_DEBUG);
+
+	carl::logging::VisibilityCache cache;
+	const char* channel = "carltest.visibility";
+	EXPECT_TRUE(cache.visible(LogLevel::LVL_DEBUG, channel));
+	EXPECT_TRUE(cache.visible(LogLevel::LVL_DEBUG, channel));
+	// adding a rule invalidates the cached decision
+	logger.filter("test_visibility")("carltest.visibility", LogLevel::LVL_ERROR);
+	EXPECT_FALSE(cache.visible(LogLevel::LVL_DEBUG, channel));
+	// other channels are not served from the cache
+	const char* other = "carltest.visibility.other";
+	logger.filter("test_visibility")("carltest.visibility.other", LogLevel::LVL_DEBUG);
+	EXPECT_TRUE(cache.visible(LogLevel::LVL_DEBUG, other));
+	EXPECT_FALSE(cache.visible(LogLevel::LVL_DEBUG, channel));
+	logger.filter("test_visibility")("carltest.visibility", LogLevel::LVL_DEBUG);
+	EXPECT_TRUE(cache.visible(LogLevel::LVL_DEBUG, channel));
+	EXPECT_EQ(LogLevel::LVL_DEBUG, logger.filter("test_visibility").get().data().at("carltest.visibility"));
+}
+
+TEST(Logging, VisibilityCacheConcurrent)
+{
+	using carl::logging::LogLevel;
+	static std::stringstream out;
+	auto& logger = carl::logging::logger();
+	logger.configure("test_visibility_concurrent", out);
+	logger.filter("test_visibility_concurrent")("carltest.concurrent", LogLevel::LVL_ERROR);
+
+	carl::logging::VisibilityCache cache;
+	const char* channel = "carltest.concurrent";
+	std::atomic<bool> done = false;
+	std::vector<std::thread> readers;
+	for (std::size_t i = 0; i < 4; ++i) {
+		readers.emplace_back([&](){
+			while (!done) cache.visible(LogLevel::LVL_DEBUG, channel);
+		});
+	}
+	for (std::size_t i = 0; i < 100; ++i) {
+		logger.filter("test_visibility_concurrent")("carltest.concurrent", i % 2 == 0 ? LogLevel::LVL_DEBUG : LogLevel::LVL_ERROR);
+	}
+	logger.filter("test_visibility_concurrent")("carltest.concurrent", LogLevel::LVL_DEBUG);
+	done = true;
+	for (auto& t: readers) t.join();
+	// no reader may have cached a stale decision under the final version
+	EXPECT_TRUE(cache.visible(LogLevel::LVL_DEBUG, channel));
+}
+
+TEST(Logging, Asynchronous)
+{
+	using carl::logging::LogLevel;
+	static std::stringstream out;
+	auto& logger = carl::logging::logger();
+	logger.configure("test_async", out);
+	logger.filter("test_async")("carltest.async", LogLevel::LVL_INFO);
+	logger.resetFormatter();
+
+	logger.asynchronous(true, 8);
+	emit("carltest.async", "first message");
+	logger.flush();
+	EXPECT_EQ(1, count(out.str(), "first message"));
+
+	std::vector<std::thread> threads;
+	for (std::size_t i = 0; i < 4; ++i) {
+		threads.emplace_back([](){
+			for (std::size_t j = 0; j < 100; ++j) emit("carltest.async", "async message");
+		});
+	}
+	for (auto& t: threads) t.join();
+	logger.asynchronous(false);
+	EXPECT_EQ(400, count(out.str(), "async message"));
+
+	emit("carltest.async", "written synchronously");
+	EXPECT_EQ(1, count(out.str(), "written synchronously"));
+}
+
+TEST(Logging, AsynchronousDisabledConcurrently)
+{
+	using carl::logging::LogLevel;
+	static std::stringstream out;
+	auto& logger = carl::logging::logger();
+	logger.configure("test_async_disable", out);
+	logger.filter("test_async_disable")("carltest.disable", LogLevel::LVL_INFO);
+	logger.resetFormatter();
+
+	std::vector<std::thread> threads;
+	for (std::size_t i = 0; i < 4; ++i) {
+		threads.emplace_back([](){
+			for (std::size_t j = 0; j < 500; ++j) emit("carltest.disable", "toggled message");
+		});
+	}
+	for (std::size_t i = 0; i < 20; ++i) {
+		logger.asynchronous(true, 4);
+		std::this_thread::yield();
+		logger.asynchronous(false);
+	}
+	for (auto& t: threads) t.join();
+	// every message has been written once asynchronous logging is disabled, even if it was pushed after the final drain
+	EXPECT_EQ(2000, count(out.str(), "toggled message"));
+}
+
 TEST(LoggingHelper, binary)
 {
 	EXPECT_EQ("00000000 00000000 00110000 00111001", carl::binary(int(12345)));
@@ -13,4 +13,25 @@ TEST(MonomialPool, singleton)
 	
 	auto m = createMonomial(x, 3);
 	EXPECT_EQ(pool2.size(), pool1.size());
-}
\ No newline at end of file
+}
+TEST(MonomialPool, collectGarbage)
+{
+	MonomialPool& pool = MonomialPool::getInstance();
+	Variable x = freshRealVariable("x");
+
+	auto m = createMonomial(x, 2);
+	std::size_t id = m->id();
+	{
+		auto tmp = createMonomial(x, 5);
+		EXPECT_EQ(tmp, createMonomial(x, 5));
+	}
+	std::size_t entries = pool.entries();
+	std::size_t size = pool.size();
+	pool.collectGarbage();
+	EXPECT_LT(pool.entries(), entries);
+	// only unreferenced monomials are collected
+	EXPECT_EQ(pool.size(), size);
+	auto m2 = createMonomial(x, 2);
+	EXPECT_EQ(m, m2);
+	EXPECT_EQ(id, m2->id());
+}
@@ -0,0 +1,149 @@
+#include "gtest/gtest.h"
+
+#include "carl/core/UnivariatePolynomial.h"
+#include "carl/ran/dyadic/ran_dyadic.h"
+#include "carl/ran/dyadic/ran_dyadic_evaluation.h"
+#include "carl/ran/dyadic/ran_dyadic_real_roots.h"
+
+#include "../Common.h"
+
+using namespace carl;
+using RAN = real_algebraic_number_dyadic<Rational>;
+
+namespace {
+	/// Checks that the isolating interval has dyadic bounds.
+	bool is_dyadic(const Interval<Rational>& i) {
+		return ran::dyadic::dyadic_exponent(i.lower()) && ran::dyadic::dyadic_exponent(i.upper());
+	}
+}
+
+TEST(RANDyadic, Construction)
+{
+	Variable x = freshRealVariable("x");
+	// 3*x^2 - 2 in (1/3, 1)
+	RAN r(UnivariatePolynomial<Rational>(x, {Rational(-2), Rational(0), Rational(3)}), Interval<Rational>(Rational(1)/3, BoundType::STRICT, Rational(1), BoundType::STRICT));
+	EXPECT_FALSE(r.is_numeric());
+	EXPECT_TRUE(is_dyadic(r.interval()));
+	EXPECT_TRUE(r.interval().contains(Rational(8165)/10000));
+	EXPECT_EQ(Rational(0), carl::floor(r));
+	EXPECT_EQ(Rational(1), carl::ceil(r));
+	for (int i = 0; i < 20; ++i) r.refine();
+	EXPECT_TRUE(is_dyadic(r.interval()));
+	EXPECT_TRUE(r.interval().diameter() < Rational(1) / 1000000);
+
+	// a dyadic root is found by bisection
+	RAN half(UnivariatePolynomial<Rational>(x, {Rational(-1), Rational(0), Rational(4)}), Interval<Rational>(Rational(0), BoundType::STRICT, Rational(1), BoundType::STRICT));
+	half.refine();
+	EXPECT_TRUE(half.is_numeric());
+	EXPECT_EQ(Rational(1)/2, half.value());
+
+	// an integer root is found when making the interval free of integers
+	RAN two(UnivariatePolynomial<Rational>(x, {Rational(-6), Rational(1), Rational(1)}), Interval<Rational>(Rational(1), BoundType::STRICT, Rational(5), BoundType::STRICT));
+	EXPECT_TRUE(two.is_numeric());
+	EXPECT_EQ(Rational(2), two.value());
+}
+
+TEST(RANDyadic, Comparison)
+{
+	Variable x = freshRealVariable("x");
+	Interval<Rational> i(Rational(1), BoundType::STRICT, Rational(2), BoundType::STRICT);
+	RAN sqrt2(UnivariatePolynomial<Rational>(x, {Rational(-2), Rational(0), Rational(1)}), i);
+	RAN sqrt3(UnivariatePolynomial<Rational>(x, {Rational(-3), Rational(0), Rational(1)}), i);
+	RAN sqrt2b(UnivariatePolynomial<Rational>(x, {Rational(6), Rational(0), Rational(-5), Rational(0), Rational(1)}), Interval<Rational>(Rational(1), BoundType::STRICT, Rational(3)/2, BoundType::STRICT));
+
+	EXPECT_TRUE(sqrt2 < sqrt3);
+	EXPECT_TRUE(sqrt2 != sqrt3);
+	EXPECT_FALSE(sqrt3 <= sqrt2);
+	// (x^2-2)(x^2-3) has the same root in (1, 3/2)
+	EXPECT_TRUE(sqrt2 == sqrt2b);
+	EXPECT_TRUE(sqrt2 > Rational(Rational(14142)/10000));
+	EXPECT_TRUE(sqrt2 < Rational(Rational(14143)/10000));
+	EXPECT_TRUE(sqrt3 > Rational(Rational(17320)/10000));
+	// comparing to a non-dyadic rational bisects until the dyadic interval excludes it
+	EXPECT_TRUE(sqrt3 > Rational(Rational(17)/10));
+	EXPECT_TRUE(is_dyadic(sqrt3.interval()));
+	EXPECT_FALSE(sqrt3.interval().contains(Rational(17)/10));
+
+	Rational s = sample_between(sqrt2, sqrt3);
+	EXPECT_TRUE(sqrt2 < s && s < sqrt3);
+	EXPECT_TRUE(sample_below(sqrt2) < sqrt2);
+	EXPECT_TRUE(sample_above(sqrt2) > sqrt2);
+}
+
+TEST(RANDyadic, AbsAndSign)
+{
+	Variable x = freshRealVariable("x");
+	RAN r(UnivariatePolynomial<Rational>(x, {Rational(-2), Rational(0), Rational(1)}), Interval<Rational>(Rational(-2), BoundType::STRICT, Rational(-1), BoundType::STRICT));
+	EXPECT_EQ(Sign::NEGATIVE, r.sgn());
+	RAN a = r.abs();
+	EXPECT_EQ(Sign::POSITIVE, a.sgn());
+	EXPECT_TRUE(a > Rational(Rational(14142)/10000));
+	EXPECT_TRUE(a < Rational(Rational(14143)/10000));
+
+	EXPECT_EQ(Sign::ZERO, a.sgn(UnivariatePolynomial<Rational>(x, {Rational(-2), Rational(0), Rational(1)})));
+	EXPECT_EQ(Sign::POSITIVE, a.sgn(UnivariatePolynomial<Rational>(x, {Rational(-1), Rational(1)})));
+	EXPECT_EQ(Sign::NEGATIVE, r.sgn(UnivariatePolynomial<Rational>(x, {Rational(0), Rational(1)})));
+}
+
+TEST(RANDyadic, RealRootsAndEvaluation)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	auto roots = ran::dyadic::real_roots(UnivariatePolynomial<Rational>(x, {Rational(-2), Rational(0), Rational(1)})).roots();
+	ASSERT_EQ(2, roots.size());
+	EXPECT_TRUE(roots[0] < roots[1]);
+	for (const auto& r: roots) {
+		EXPECT_TRUE(r.is_numeric() || is_dyadic(r.interval()));
+	}
+
+	ran::ran_assignment_t<RAN> m;
+	m.emplace(x, roots[1]);
+	MultivariatePolynomial<Rational> mpx(x);
+	auto res = evaluate(mpx * mpx, m);
+	ASSERT_TRUE(res);
+	EXPECT_TRUE(res->is_numeric());
+	EXPECT_EQ(Rational(2), res->value());
+	EXPECT_TRUE((bool)evaluate(Constraint<MultivariatePolynomial<Rational>>(mpx * mpx - Rational(2), Relation::EQ), m));
+	EXPECT_FALSE((bool)evaluate(Constraint<MultivariatePolynomial<Rational>>(mpx - Rational(1), Relation::LESS), m));
+
+	// y^2 - x over x = sqrt(2)
+	auto yroots = ran::dyadic::real_roots(UnivariatePolynomial<MultivariatePolynomial<Rational>>(y, {-mpx, MultivariatePolynomial<Rational>(0), MultivariatePolynomial<Rational>(1)}), m);
+	ASSERT_TRUE(yroots.is_univariate());
+	ASSERT_EQ(2, yroots.roots().size());
+	EXPECT_TRUE(yroots.roots()[1] > Rational(Rational(1189)/1000));
+	EXPECT_TRUE(yroots.roots()[1] < Rational(Rational(1190)/1000));
+}
+
+TEST(RANDyadic, EvaluationStaysDyadic)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Interval<Rational> i(Rational(1), BoundType::STRICT, Rational(2), BoundType::STRICT);
+	RAN sqrt2(UnivariatePolynomial<Rational>(x, {Rational(-2), Rational(0), Rational(1)}), i);
+	RAN sqrt3(UnivariatePolynomial<Rational>(x, {Rational(-3), Rational(0), Rational(1)}), i);
+	MultivariatePolynomial<Rational> mpx(x);
+	MultivariatePolynomial<Rational> mpy(y);
+	using ConstraintT = Constraint<MultivariatePolynomial<Rational>>;
+
+	// a single irrational number is evaluated on its dyadic bounds, bisecting it in place
+	ran::ran_assignment_t<RAN> m;
+	m.emplace(x, sqrt2);
+	m.emplace(y, RAN(Rational(1)/3));
+	EXPECT_TRUE((bool)evaluate(ConstraintT(mpx - Rational(Rational(141)/100) - mpy, Relation::LESS), m));
+	EXPECT_TRUE((bool)evaluate(ConstraintT(mpx * mpx - Rational(2), Relation::EQ), m));
+	EXPECT_FALSE((bool)evaluate(ConstraintT(Rational(1000) * mpx - Rational(1414), Relation::LESS), m));
+	EXPECT_TRUE(is_dyadic(sqrt2.interval()));
+	EXPECT_LT(sqrt2.interval().diameter(), Rational(1)/100);
+
+	// several irrational numbers are evaluated by the interval backend, its refinements are kept
+	// the filter can not decide the sign of x*y - 2449/1000 on the initial intervals, hence the numbers are refined
+	ran::ran_assignment_t<RAN> m2;
+	m2.emplace(x, sqrt2);
+	m2.emplace(y, sqrt3);
+	auto before = sqrt3.interval().diameter();
+	auto res = evaluate(mpx * mpy - Rational(Rational(2449)/1000), m2);
+	ASSERT_TRUE(res);
+	EXPECT_TRUE(*res > Rational(0) && *res < Rational(Rational(1)/1000));
+	EXPECT_LT(sqrt3.interval().diameter(), before);
+	EXPECT_TRUE(is_dyadic(sqrt3.interval()));
+}
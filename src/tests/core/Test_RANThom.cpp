@@ -0,0 +1,56 @@
+#include "gtest/gtest.h"
+
+#include "carl/core/UnivariatePolynomial.h"
+#include "carl/ran/thom/ran_thom.h"
+#include "carl/ran/thom/ran_thom_evaluation.h"
+#include "carl/ran/thom/ran_thom_real_roots.h"
+
+#include "../Common.h"
+
+using namespace carl;
+using RAN = real_algebraic_number_thom<Rational>;
+
+TEST(RANThom, RootsAndComparison)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	MultivariatePolynomial<Rational> mpx(x);
+
+	// x^2 - 2 has the roots -sqrt(2) and sqrt(2)
+	auto res = ran::thom::real_roots(UnivariatePolynomial<Rational>(x, {Rational(-2), Rational(0), Rational(1)}));
+	ASSERT_TRUE(res.is_univariate());
+	ASSERT_EQ(2, res.roots().size());
+	RAN msqrt2 = res.roots()[0];
+	RAN sqrt2 = res.roots()[1];
+	EXPECT_FALSE(sqrt2.is_numeric());
+	EXPECT_TRUE(msqrt2 < sqrt2);
+	EXPECT_TRUE(msqrt2 != sqrt2);
+	EXPECT_EQ(Sign::NEGATIVE, msqrt2.sgn());
+	EXPECT_TRUE(sqrt2 > Rational(Rational(14142)/10000));
+	EXPECT_TRUE(sqrt2 < Rational(Rational(14143)/10000));
+	EXPECT_EQ(Rational(1), carl::floor(sqrt2));
+	EXPECT_EQ(Rational(-1), carl::ceil(msqrt2));
+	EXPECT_TRUE(msqrt2.abs() == sqrt2);
+
+	// the same root of (x^2-2)(x^2-3) is equal, although it is encoded on another polynomial
+	RAN sqrt2b(UnivariatePolynomial<Rational>(x, {Rational(6), Rational(0), Rational(-5), Rational(0), Rational(1)}), Interval<Rational>(Rational(1), BoundType::STRICT, Rational(3)/2, BoundType::STRICT));
+	RAN sqrt3(UnivariatePolynomial<Rational>(x, {Rational(-3), Rational(0), Rational(1)}), Interval<Rational>(Rational(1), BoundType::STRICT, Rational(2), BoundType::STRICT));
+	EXPECT_TRUE(sqrt2 == sqrt2b);
+	EXPECT_TRUE(sqrt2 < sqrt3);
+	Rational s = sample_between(sqrt2, sqrt3);
+	EXPECT_TRUE(sqrt2 < s && s < sqrt3);
+
+	ran::ran_assignment_t<RAN> m;
+	m.emplace(x, sqrt2);
+	EXPECT_TRUE((bool)carl::evaluate(Constraint<MultivariatePolynomial<Rational>>(mpx * mpx - Rational(2), Relation::EQ), m));
+	EXPECT_FALSE((bool)carl::evaluate(Constraint<MultivariatePolynomial<Rational>>(mpx - Rational(Rational(3)/2), Relation::GREATER), m));
+	auto shifted = carl::evaluate(mpx + Rational(10), m);
+	ASSERT_TRUE((bool)shifted);
+	EXPECT_TRUE(*shifted > Rational(11) && *shifted < Rational(12));
+
+	// y^2 - x has two roots over x = sqrt(2)
+	UnivariatePolynomial<MultivariatePolynomial<Rational>> py(y, {-mpx, MultivariatePolynomial<Rational>(0), MultivariatePolynomial<Rational>(1)});
+	auto lifted = ran::thom::real_roots(py, m);
+	ASSERT_TRUE(lifted.is_univariate());
+	EXPECT_EQ(2, lifted.roots().size());
+}
@@ -1,8 +1,10 @@
 #include "gtest/gtest.h"
 #include <map>
+#include <thread>
 
 #include "carl/core/UnivariatePolynomial.h"
 #include "carl/ran/ran.h"
+#include "carl/ran/interval/FilteredEvaluation.h"
 
 #include "../Common.h"
 
@@ -99,6 +101,81 @@ TEST(RealAlgebraicNumber, EvalBug2)
 	EXPECT_TRUE((bool) res);
 }
 
+#ifdef RAN_USE_INTERVAL
+TEST(RealAlgebraicNumber, FilteredEvaluation)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	MultivariatePolynomial<Rational> mpx(x);
+	MultivariatePolynomial<Rational> mpy(y);
 
+	std::map<Variable, Interval<Rational>> map;
+	map.emplace(x, Interval<Rational>(Rational(141)/100, BoundType::STRICT, Rational(142)/100, BoundType::STRICT));
+	map.emplace(y, Interval<Rational>(Rational(1)/3, BoundType::STRICT, Rational(1)/2, BoundType::STRICT));
+
+	// x^2 - 2 can not be decided on this interval
+	EXPECT_TRUE(indeterminate(carl::ran::interval::evaluate_filtered(mpx*mpx - Rational(2), Relation::GREATER, map)));
+	// x^2 - 3*y > 0 holds
+	EXPECT_TRUE((bool)carl::ran::interval::evaluate_filtered(mpx*mpx - Rational(3)*mpy, Relation::GREATER, map));
+	EXPECT_FALSE((bool)carl::ran::interval::evaluate_filtered(mpx*mpx - Rational(3)*mpy, Relation::LEQ, map));
+	// y - 1/3 > 0 holds, but 1/3 is not representable as a double
+	EXPECT_TRUE(indeterminate(carl::ran::interval::evaluate_filtered(mpy - Rational(Rational(1)/3), Relation::GREATER, map)));
+	EXPECT_TRUE((bool)carl::ran::interval::evaluate_filtered(mpy - Rational(Rational(1)/4), Relation::GREATER, map));
+
+	// Constraints that the filter decides on the isolating intervals do not refine the numbers.
+	RealAlgebraicNumber<Rational> sqrt2(UnivariatePolynomial<Rational>(x, {Rational(-2), Rational(0), Rational(1)}), Interval<Rational>(Rational(1), BoundType::STRICT, Rational(2), BoundType::STRICT));
+	ran::ran_assignment_t<RealAlgebraicNumber<Rational>> assignment;
+	assignment.emplace(x, sqrt2);
+	EXPECT_TRUE((bool)carl::evaluate(Constraint<MultivariatePolynomial<Rational>>(mpx - Rational(3), Relation::LESS), assignment));
+	EXPECT_EQ(Interval<Rational>(Rational(1), BoundType::STRICT, Rational(2), BoundType::STRICT), sqrt2.interval());
+	EXPECT_FALSE((bool)carl::evaluate(Constraint<MultivariatePolynomial<Rational>>(mpx - Rational(Rational(3)/2), Relation::GREATER), assignment));
+	EXPECT_TRUE(sqrt2.interval().diameter() < Rational(1));
+	EXPECT_TRUE(carl::evaluate(mpx * mpx - Rational(3), assignment)->sgn() == Sign::NEGATIVE);
+
+	// Polynomials that the filter shows to be nonzero are evaluated without refining to 2^-20 first.
+	RealAlgebraicNumber<Rational> sqrt3(UnivariatePolynomial<Rational>(x, {Rational(-3), Rational(0), Rational(1)}), Interval<Rational>(Rational(1), BoundType::STRICT, Rational(2), BoundType::STRICT));
+	ran::ran_assignment_t<RealAlgebraicNumber<Rational>> assignment3;
+	assignment3.emplace(x, sqrt3);
+	auto shifted = carl::evaluate(mpx + Rational(10), assignment3);
+	ASSERT_TRUE((bool)shifted);
+	EXPECT_TRUE(*shifted > Rational(11));
+	EXPECT_TRUE(*shifted < Rational(12));
+	EXPECT_TRUE(sqrt3.interval().diameter() > Rational(Rational(1) / 1048576));
+}
 
-
+#ifdef THREAD_SAFE
+TEST(RealAlgebraicNumber, ConcurrentRefinement)
+{
+	Variable x = freshRealVariable("x");
+	// x^2 - 2 in (1, 2)
+	RealAlgebraicNumber<Rational> sqrt2(UnivariatePolynomial<Rational>(x, {Rational(-2), Rational(0), Rational(1)}), Interval<Rational>(Rational(1), BoundType::STRICT, Rational(2), BoundType::STRICT));
+	// x^2 - 3 in (1, 2)
+	RealAlgebraicNumber<Rational> sqrt3(UnivariatePolynomial<Rational>(x, {Rational(-3), Rational(0), Rational(1)}), Interval<Rational>(Rational(1), BoundType::STRICT, Rational(2), BoundType::STRICT));
+
+	// the polynomial is shared, not copied, while other threads refine the number
+	const auto& poly = sqrt2.polynomial();
+	EXPECT_EQ(&poly, &sqrt2.polynomial());
+
+	std::vector<std::thread> threads;
+	std::vector<int> results(8, 0);
+	for (std::size_t t = 0; t < results.size(); ++t) {
+		threads.emplace_back([&, t]() {
+			for (int i = 0; i < 50; ++i) {
+				Rational pivot = Rational(14142 + i) / 10000;
+				if (sqrt2 < sqrt3 && sqrt2 != sqrt3 && (sqrt2 > pivot) == (i == 0) && &sqrt2.polynomial() == &poly) results[t]++;
+				sqrt2.refine();
+				sqrt3.refine();
+			}
+		});
+	}
+	for (auto& t: threads) t.join();
+	for (int r: results) {
+		EXPECT_EQ(r, 50);
+	}
+	// all threads refined the same content
+	EXPECT_TRUE(sqrt2.interval().diameter() < Rational(1) / 1000000);
+	EXPECT_TRUE(sqrt2 > Rational(Rational(141421356) / 100000000));
+	EXPECT_TRUE(sqrt2 < Rational(Rational(141421357) / 100000000));
+}
+#endif
+#endif
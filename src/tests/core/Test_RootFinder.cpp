@@ -5,6 +5,8 @@
 #include <carl/core/UnivariatePolynomial.h>
 #include <carl/core/polynomialfunctions/Chebyshev.h>
 #include <carl/ran/interval/LazardEvaluation.h>
+#include <carl/ran/interval/LiftingContext.h>
+#include <carl/ran/interval/ran_interval_real_roots_batch.h>
 
 #include <carl/formula/Formula.h>
 #include <carl-model/Model.h>
@@ -99,6 +101,106 @@ TEST(RootFinder, evalRoots)
 	EXPECT_TRUE(roots.roots().front() == xval);
 }
 
+TEST(RootFinder, LiftingContext)
+{
+	carl::Variable x = freshRealVariable("x");
+	carl::Variable y = freshRealVariable("y");
+	carl::Variable z = freshRealVariable("z");
+
+	UPolynomial ypoly(y, {-2, 0, 1});
+	carl::Interval<Rational> yint(Rational(1), carl::BoundType::STRICT, Rational(2), carl::BoundType::STRICT);
+	carl::RealAlgebraicNumber<Rational> yval(ypoly, yint);
+
+	// x^2 - y*z
+	UMPolynomial p(x, {-MPolynomial(y) * MPolynomial(z), MPolynomial(0), MPolynomial(1)});
+
+	carl::ran::interval::LiftingContext<Rational> lc;
+	lc.extend(z, carl::RealAlgebraicNumber<Rational>(Rational(2)));
+	EXPECT_TRUE(lc.real_roots(p).is_non_univariate());
+	lc.extend(y, yval);
+	EXPECT_EQ(lc.level(), 2);
+	auto roots = lc.real_roots(p);
+	auto expected = carl::real_roots(p, lc.assignment());
+	ASSERT_TRUE(roots.is_univariate());
+	EXPECT_EQ(roots.roots(), expected.roots());
+	EXPECT_EQ(roots.roots().size(), 2);
+
+	lc.retract();
+	lc.extend(y, carl::RealAlgebraicNumber<Rational>(Rational(8)));
+	roots = lc.real_roots(p);
+	ASSERT_TRUE(roots.is_univariate());
+	EXPECT_EQ(roots.roots().size(), 2);
+	EXPECT_TRUE(represents(roots.roots().front(), Rational(-4)));
+	EXPECT_TRUE(represents(roots.roots().back(), Rational(4)));
+
+	// Caches hold the polynomials of the last two cells only.
+	lc.retract();
+	UMPolynomial q(x, {-MPolynomial(y) - MPolynomial(z), MPolynomial(1)});
+	for (int i = 0; i < 10; ++i) {
+		lc.extend(y, carl::RealAlgebraicNumber<Rational>(Rational(i)));
+		lc.real_roots(p + UMPolynomial(x, MPolynomial(Rational(i))));
+		lc.real_roots(q);
+		lc.retract();
+	}
+	std::size_t size = lc.cache_size();
+	for (int i = 0; i < 10; ++i) {
+		lc.extend(y, carl::RealAlgebraicNumber<Rational>(Rational(i)));
+		lc.real_roots(q);
+		lc.retract();
+	}
+	EXPECT_LT(lc.cache_size(), size);
+	EXPECT_LE(lc.cache_size(), 2);
+
+	lc.retract(0);
+	EXPECT_EQ(lc.level(), 0);
+	EXPECT_TRUE(lc.assignment().empty());
+}
+
+TEST(RootFinder, real_roots_batch)
+{
+	carl::Variable x = freshRealVariable("x");
+	carl::Variable y = freshRealVariable("y");
+
+	// x^2 - 2, x^3 - 2x, x - 1, 0
+	std::vector<UPolynomial> polys = {
+		UPolynomial(x, {Rational(-2), Rational(0), Rational(1)}),
+		UPolynomial(x, {Rational(0), Rational(-2), Rational(0), Rational(1)}),
+		UPolynomial(x, {Rational(-1), Rational(1)}),
+		UPolynomial(x)
+	};
+	auto roots = carl::ran::interval::real_roots_batch(polys);
+	ASSERT_EQ(roots.size(), 4);
+	EXPECT_EQ(roots[0].polynomials, std::vector<std::size_t>({0, 1}));
+	EXPECT_EQ(roots[1].polynomials, std::vector<std::size_t>({1}));
+	EXPECT_TRUE(represents(roots[1].value, Rational(0)));
+	EXPECT_EQ(roots[2].polynomials, std::vector<std::size_t>({2}));
+	EXPECT_TRUE(represents(roots[2].value, Rational(1)));
+	EXPECT_EQ(roots[3].polynomials, std::vector<std::size_t>({0, 1}));
+	EXPECT_TRUE(roots[0].value < carl::RealAlgebraicNumber<Rational>(Rational(-1)));
+	EXPECT_TRUE(roots[3].value > carl::RealAlgebraicNumber<Rational>(Rational(1)));
+
+	auto sequential = carl::ran::interval::real_roots_batch(polys, carl::Interval<Rational>::unboundedInterval(), false);
+	ASSERT_EQ(sequential.size(), roots.size());
+	for (std::size_t i = 0; i < roots.size(); ++i) {
+		EXPECT_EQ(sequential[i].value, roots[i].value);
+		EXPECT_EQ(sequential[i].polynomials, roots[i].polynomials);
+	}
+
+	// x^2 - y, x - y over y = 2
+	std::vector<UMPolynomial> mpolys = {
+		UMPolynomial(x, {-MPolynomial(y), MPolynomial(0), MPolynomial(1)}),
+		UMPolynomial(x, {-MPolynomial(y), MPolynomial(1)})
+	};
+	carl::ran::interval::LiftingContext<Rational> lc;
+	lc.extend(y, carl::RealAlgebraicNumber<Rational>(Rational(2)));
+	auto lifted = carl::ran::interval::real_roots_batch(mpolys, lc);
+	ASSERT_EQ(lifted.size(), 3);
+	EXPECT_EQ(lifted[0].polynomials, std::vector<std::size_t>({0}));
+	EXPECT_EQ(lifted[1].polynomials, std::vector<std::size_t>({0}));
+	EXPECT_EQ(lifted[2].polynomials, std::vector<std::size_t>({1}));
+	EXPECT_TRUE(represents(lifted[2].value, Rational(2)));
+}
+
 TEST(RootFinder, Chebyshev)
 {
 	carl::Chebyshev<Rational> chebyshev(freshRealVariable("x"));
@@ -0,0 +1,59 @@
+#include "gtest/gtest.h"
+#include <algorithm>
+
+#include "carl/core/MultivariatePolynomial.h"
+#include "carl/ran/thom/SignDetermination/SignDetermination.h"
+
+#include "../Common.h"
+
+using namespace carl;
+
+TEST(SignDetermination, SharedTarskiQueries)
+{
+	Variable x = freshRealVariable("x");
+	MultivariatePolynomial<Rational> mpx(x);
+	// (x^2 - 2) * (x - 3) has three real roots
+	MultivariatePolynomial<Rational> p = (mpx * mpx - Rational(2)) * (mpx - Rational(3));
+	std::vector<MultivariatePolynomial<Rational>> zeroSet = {p};
+
+	SignDetermination<Rational> sd1(zeroSet.begin(), zeroSet.end());
+	EXPECT_EQ(3, sd1.sizeOfZeroSet());
+	sd1.getSignsAndAdd(mpx);
+	std::size_t cached = sd1.tarskiQueryManager().cacheSize();
+	EXPECT_TRUE(cached > 0);
+
+	// a sign determination on the same zero set reuses the query results
+	std::vector<MultivariatePolynomial<Rational>> sameZeroSet = {Rational(2) * p};
+	SignDetermination<Rational> sd2(sameZeroSet.begin(), sameZeroSet.end());
+	EXPECT_TRUE(sd2.tarskiQueryManager().sharesTablesWith(sd1.tarskiQueryManager()));
+	EXPECT_EQ(cached, sd2.tarskiQueryManager().cacheSize());
+
+	std::vector<MultivariatePolynomial<Rational>> otherZeroSet = {mpx * mpx - Rational(2)};
+	SignDetermination<Rational> sd3(otherZeroSet.begin(), otherZeroSet.end());
+	EXPECT_FALSE(sd3.tarskiQueryManager().sharesTablesWith(sd1.tarskiQueryManager()));
+}
+
+TEST(SignDetermination, IncrementalUpdate)
+{
+	Variable x = freshRealVariable("x");
+	MultivariatePolynomial<Rational> mpx(x);
+	// roots -2, -1, 1, 2
+	MultivariatePolynomial<Rational> p = (mpx * mpx - Rational(1)) * (mpx * mpx - Rational(4));
+	std::vector<MultivariatePolynomial<Rational>> zeroSet = {p};
+	SignDetermination<Rational> sd(zeroSet.begin(), zeroSet.end());
+
+	auto signs = sd.getSignsAndAdd(mpx);
+	EXPECT_EQ(2, signs.size());
+	signs = sd.getSignsAndAdd(mpx - Rational(Rational(3)/2));
+	EXPECT_EQ(3, signs.size());
+	signs = sd.getSignsAndAdd(mpx + Rational(Rational(3)/2));
+	EXPECT_EQ(4, signs.size());
+	// the matrix after the next update is invertible and matches the sign conditions
+	signs = sd.getSigns(mpx * mpx - Rational(1));
+	EXPECT_EQ(4, signs.size());
+	EXPECT_EQ(sd.adaptedList().size(), static_cast<std::size_t>(sd.matrix().rows()));
+	EXPECT_EQ(sd.signs().size(), static_cast<std::size_t>(sd.matrix().cols()));
+	// x^2 - 1 vanishes on -1 and 1 and is positive on -2 and 2
+	EXPECT_EQ(2, std::count_if(signs.begin(), signs.end(), [](const auto& sigma){ return sigma.front() == Sign::ZERO; }));
+	EXPECT_EQ(2, std::count_if(signs.begin(), signs.end(), [](const auto& sigma){ return sigma.front() == Sign::POSITIVE; }));
+}
@@ -2,6 +2,8 @@
 #include <carl/core/polynomialfunctions/Derivative.h>
 #include <carl/core/polynomialfunctions/Substitution.h>
 #include <carl/core/Monomial.h>
+#include <carl/core/MonomialOrdering.h>
+#include <carl/core/PackedTerm.h>
 #include <carl/core/Term.h>
 #include <carl/core/Variable.h>
 #include <carl/core/VariablePool.h>
@@ -125,3 +127,64 @@ TYPED_TEST(TermTest, OtherComparison)
 
     expectRightOrder(list);
 }
+
+static_assert(std::is_trivially_copyable<PackedTerm<double>>::value, "packed terms are plain values");
+
+TYPED_TEST(TermTest, PackedTerm)
+{
+    Variable x = freshRealVariable("x");
+    Variable y = freshRealVariable("y");
+    Term<TypeParam> t1 = static_cast<TypeParam>(3) * x * y;
+    Term<TypeParam> t2 = static_cast<TypeParam>(5) * x * x;
+    Term<TypeParam> t3 = static_cast<TypeParam>(2) * y;
+    Term<TypeParam> c(static_cast<TypeParam>(4));
+
+    MonomialPins pins;
+    PackedTerm<TypeParam> p1(t1, pins);
+    PackedTerm<TypeParam> p2(t2, pins);
+    PackedTerm<TypeParam> p3(t3, pins);
+    PackedTerm<TypeParam> pc(c, pins);
+    EXPECT_EQ(t1, p1.toTerm());
+    EXPECT_EQ(t1.monomial(), p1.monomial());
+    EXPECT_EQ(t1.monomial()->id(), p1.monomialId());
+    EXPECT_EQ(2u, p1.tdeg());
+    EXPECT_TRUE(pc.isConstant());
+    EXPECT_EQ(c, pc.toTerm());
+    EXPECT_EQ(std::hash<Term<TypeParam>>()(t1), std::hash<PackedTerm<TypeParam>>()(p1));
+    EXPECT_TRUE(PackedTerm<TypeParam>::monomialEqual(p1, PackedTerm<TypeParam>(static_cast<TypeParam>(7), t1.monomial(), pins)));
+    EXPECT_NE(p1, PackedTerm<TypeParam>(static_cast<TypeParam>(7), t1.monomial(), pins));
+    // every monomial is pinned once
+    EXPECT_EQ(3u, pins.size());
+
+    // The orderings agree with those on terms.
+    std::vector<std::pair<Term<TypeParam>, PackedTerm<TypeParam>>> terms = {{t1, p1}, {t2, p2}, {t3, p3}, {c, pc}};
+    for (const auto& a: terms) {
+        for (const auto& b: terms) {
+            EXPECT_EQ(GrLexOrdering::compare(a.first, b.first), GrLexOrdering::compare(a.second, b.second));
+            EXPECT_EQ(LexOrdering::compare(a.first, b.first), LexOrdering::compare(a.second, b.second));
+        }
+    }
+
+    // Packed terms stay valid after the original terms are gone, as long as their pins exist.
+    auto& pool = MonomialPool::getInstance();
+    pool.collectGarbage();
+    std::size_t size = pool.size();
+    {
+        MonomialPins owner;
+        Monomial::Arg m = createMonomial(x, 7);
+        std::size_t id = m->id();
+        PackedTerm<TypeParam> p(static_cast<TypeParam>(1), m, owner);
+        m = nullptr;
+        EXPECT_EQ(id, p.monomial()->id());
+        EXPECT_EQ(7u, p.tdeg());
+        std::vector<PackedTerm<TypeParam>> copies(3, p);
+        PackedTerm<TypeParam> moved(std::move(p));
+        EXPECT_EQ(id, moved.monomial()->id());
+        EXPECT_EQ(id, copies[2].monomial()->id());
+        pool.collectGarbage();
+        EXPECT_EQ(size + 1, pool.size());
+    }
+    // The monomial is released with its pins.
+    pool.collectGarbage();
+    EXPECT_EQ(size, pool.size());
+}
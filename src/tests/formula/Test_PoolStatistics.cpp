@@ -0,0 +1,48 @@
+#include "gtest/gtest.h"
+
+#include "carl/formula/PoolStatistics.h"
+#include <carl-statistics/StatisticsPrinter.h>
+#include "../Common.h"
+
+
+using namespace carl;
+
+typedef MultivariatePolynomial<Rational> Pol;
+typedef Constraint<Pol> ConstraintT;
+
+TEST(PoolStatistics, collect)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	ConstraintT c(Pol(x) * Pol(y) + Rational(1024) * Pol(x) - Pol(y), Relation::LESS);
+
+	auto& stats = pool_statistics<Pol>();
+	stats.collect();
+	auto res = statistics::detail::key_values(stats);
+	EXPECT_TRUE(res.find("monomials_size") != res.end());
+	EXPECT_LE(std::stoul(res.at("monomials_size")), std::stoul(res.at("monomials_entries")));
+	EXPECT_TRUE(res.find("monomials_hit_rate") != res.end());
+	EXPECT_TRUE(res.find("formulas_bytes") != res.end());
+	EXPECT_TRUE(res.find("bvterms_load_factor") != res.end());
+	EXPECT_EQ("3", res.at("constraints_largest_terms"));
+	EXPECT_EQ(3, stats.term_counts.max());
+	EXPECT_LE(11, stats.coefficient_bits.max());
+	EXPECT_LE(1, ConstraintPool<Pol>::getInstance().counters().misses.value());
+}
+
+TEST(PoolStatistics, collectTwice)
+{
+	Variable x = freshRealVariable("x");
+	auto& stats = pool_statistics<Pol>();
+	stats.collect();
+	auto first = statistics::detail::key_values(stats);
+
+	ConstraintT c(Pol(x) * x * x + Rational(7), Relation::GREATER);
+	auto m = createMonomial(x, 17);
+	stats.collect();
+	auto second = statistics::detail::key_values(stats);
+	EXPECT_LT(std::stoul(first.at("constraints_size")), std::stoul(second.at("constraints_size")));
+	EXPECT_LT(std::stoul(first.at("constraints_misses")), std::stoul(second.at("constraints_misses")));
+	EXPECT_LT(std::stoul(first.at("monomials_entries")), std::stoul(second.at("monomials_entries")));
+	EXPECT_LE(std::stoul(first.at("constraints_bytes")), std::stoul(second.at("constraints_bytes")));
+}
@@ -0,0 +1,172 @@
+#include "gtest/gtest.h"
+
+#include "carl/core/MultivariatePolynomial.h"
+#include "carl/vs/substitute.h"
+#include "carl/vs/substitution_cache.h"
+#include "carl/vs/zeros.h"
+#include "../Common.h"
+
+using namespace carl;
+
+typedef MultivariatePolynomial<Rational> Pol;
+typedef Constraint<Pol> ConstraintT;
+
+TEST(VirtualSubstitution, substitute)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	// x^2 - y < 0 [y+1 // x] is y^2 + y + 1 < 0
+	ConstraintT c(Pol(x) * x - y, Relation::LESS);
+	auto res = vs::substitute(c, x, vs::Term<Pol>::normal(SqrtEx<Pol>(Pol(y) + Rational(1))));
+	ASSERT_TRUE(res);
+	ASSERT_EQ(1, res->size());
+	ASSERT_EQ(1, res->front().size());
+	EXPECT_EQ(ConstraintT(Pol(y) * y + y + Rational(1), Relation::LESS), res->front().front());
+
+	// x - 3 < 0 holds for x -> -infinity
+	auto resInf = vs::substitute(ConstraintT(Pol(x) - Rational(3), Relation::LESS), x, vs::Term<Pol>::minus_infty());
+	ASSERT_TRUE(resInf);
+	ASSERT_FALSE(resInf->empty());
+	EXPECT_TRUE(std::all_of(resInf->front().begin(), resInf->front().end(), [](const auto& cons) { return cons == ConstraintT(true); }));
+}
+
+TEST(VirtualSubstitution, cache)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	ConstraintT c(Pol(x) * x - y, Relation::LESS);
+	auto term = vs::Term<Pol>::normal(SqrtEx<Pol>(Pol(y) + Rational(1)));
+
+	vs::substitution_cache<Pol> cache;
+	auto first = cache.substitute(c, x, term);
+	auto second = cache.substitute(c, x, term);
+	EXPECT_EQ(1, cache.misses());
+	EXPECT_EQ(1, cache.hits());
+	EXPECT_EQ(1, cache.size());
+	EXPECT_EQ(vs::substitute(c, x, term), first);
+	EXPECT_EQ(first, second);
+
+	// results are returned by value and outlive the cache entries
+	cache.clear();
+	EXPECT_EQ(0, cache.size());
+	ASSERT_TRUE(first);
+	EXPECT_EQ(1, first->size());
+}
+
+TEST(VirtualSubstitution, caseGenerator)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	auto term = vs::Term<Pol>::normal(SqrtEx<Pol>(Pol(y)));
+	vs::substitution_cache<Pol> cache;
+
+	// x > 0 implies x >= 0, hence the only branch is y > 0
+	auto gen = cache.substitute({ConstraintT(Pol(x), Relation::GREATER), ConstraintT(Pol(x), Relation::GEQ)}, x, term);
+	ASSERT_TRUE(gen);
+	auto branch = gen->next();
+	ASSERT_TRUE(branch);
+	EXPECT_EQ(vs::ConstraintConjunction<Pol>({ConstraintT(Pol(y), Relation::GREATER)}), *branch);
+	EXPECT_FALSE(gen->next());
+
+	// x > 0 and x < 0 conflict, hence there is no branch
+	auto conflict = cache.substitute({ConstraintT(Pol(x), Relation::GREATER), ConstraintT(Pol(x), Relation::LESS)}, x, term);
+	ASSERT_TRUE(conflict);
+	EXPECT_FALSE(conflict->next());
+	EXPECT_EQ(3, cache.misses());
+}
+
+TEST(VirtualSubstitution, caseGeneratorBatch)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable z = freshRealVariable("z");
+	std::vector<vs::CaseDistinction<Pol>> factors = {
+		{{ConstraintT(Pol(x), Relation::LESS)}, {ConstraintT(Pol(x), Relation::GREATER)}, {ConstraintT(false)}},
+		{{ConstraintT(Pol(y), Relation::EQ)}, {ConstraintT(Pol(x), Relation::LEQ), ConstraintT(Pol(z), Relation::EQ)}}
+	};
+	vs::case_generator<Pol> sequential(factors);
+	vs::case_generator<Pol> batched(factors, true);
+	EXPECT_EQ(6, sequential.size());
+
+	std::vector<vs::ConstraintConjunction<Pol>> expected;
+	while (auto b = sequential.next()) expected.push_back(*b);
+	// branches with false or with x > 0 and x <= 0 are skipped, and x <= 0 is implied by x < 0
+	ASSERT_EQ(3, expected.size());
+	EXPECT_EQ(vs::ConstraintConjunction<Pol>({ConstraintT(Pol(x), Relation::LESS), ConstraintT(Pol(z), Relation::EQ)}), expected[2]);
+
+	std::vector<vs::ConstraintConjunction<Pol>> actual;
+	for (auto b = batched.next_batch(4); !b.empty(); b = batched.next_batch(4)) {
+		actual.insert(actual.end(), b.begin(), b.end());
+	}
+	EXPECT_EQ(expected, actual);
+}
+
+TEST(VirtualSubstitution, zeroGenerator)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	// linear zeros are yielded first, and y*x - 1 < 0 yields the same zero 1/y with the same side condition as y*x - 1 = 0
+	std::vector<ConstraintT> constraints = {
+		ConstraintT(Pol(x) * x - y, Relation::LESS),
+		ConstraintT(Pol(x) * y - Rational(1), Relation::EQ),
+		ConstraintT(Pol(x) * y - Rational(1), Relation::LESS),
+		ConstraintT(Pol(y), Relation::GREATER)
+	};
+	vs::zero_generator<Pol> gen(constraints.begin(), constraints.end(), x);
+	auto first = gen.next();
+	ASSERT_TRUE(first);
+	EXPECT_FALSE(first->sqrt_ex.hasSqrt());
+	EXPECT_EQ(1, first->side_condition.size());
+	auto second = gen.next();
+	ASSERT_TRUE(second);
+	EXPECT_TRUE(second->sqrt_ex.hasSqrt());
+	auto third = gen.next();
+	ASSERT_TRUE(third);
+	EXPECT_TRUE(third->sqrt_ex.hasSqrt());
+	EXPECT_FALSE(third->sqrt_ex == second->sqrt_ex);
+	EXPECT_FALSE(gen.next());
+	EXPECT_TRUE(gen.complete());
+}
+
+TEST(VirtualSubstitution, zeroGeneratorIncomplete)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	std::vector<ConstraintT> constraints = {
+		ConstraintT(Pol(x) * x * x - y, Relation::LESS),
+		ConstraintT(Pol(x) - y, Relation::LESS)
+	};
+	vs::zero_generator<Pol> gen(constraints.begin(), constraints.end(), x);
+	// the cubic constraint is only processed once the linear zero has been yielded
+	ASSERT_TRUE(gen.next());
+	EXPECT_TRUE(gen.complete());
+	EXPECT_FALSE(gen.next());
+	EXPECT_FALSE(gen.complete());
+}
+
+TEST(VirtualSubstitution, zeroGeneratorVariableComparison)
+{
+	using VC = VariableComparison<Pol>;
+	using Atom = std::variant<ConstraintT, VC>;
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	std::vector<Atom> atoms = {
+		VC(x, VC::RAN(Rational(2)), Relation::LESS),
+		ConstraintT(Pol(x) - Rational(2), Relation::GREATER)
+	};
+	vs::zero_generator<Pol> gen(atoms.begin(), atoms.end(), x);
+	auto z = gen.next();
+	ASSERT_TRUE(z);
+	EXPECT_EQ(SqrtEx<Pol>(Pol(Rational(2))), z->sqrt_ex);
+	// x - 2 > 0 yields the same zero
+	EXPECT_FALSE(gen.next());
+	EXPECT_TRUE(gen.complete());
+
+	// a comparison with a multivariate root yields no zero
+	std::vector<VC> mvroots = {
+		VC(x, MultivariateRoot<Pol>(Pol(MultivariateRoot<Pol>::var()) * MultivariateRoot<Pol>::var() - y, 1), Relation::LESS)
+	};
+	vs::zero_generator<Pol> mvgen(mvroots.begin(), mvroots.end(), x);
+	EXPECT_FALSE(mvgen.next());
+	EXPECT_FALSE(mvgen.complete());
+}
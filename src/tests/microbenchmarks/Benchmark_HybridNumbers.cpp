@@ -0,0 +1,46 @@
+#include <benchmark/benchmark.h>
+
+#include <carl/core/MultivariatePolynomial.h>
+#include <carl/core/polynomialfunctions/Power.h>
+#include <carl/numbers/numbers.h>
+
+template<typename Coeff>
+class MVP_Coeff_Fixture: public benchmark::Fixture {
+public:
+    using MVP = carl::MultivariatePolynomial<Coeff>;
+    carl::Variable x = carl::freshRealVariable("x");
+    carl::Variable y = carl::freshRealVariable("y");
+    carl::Variable z = carl::freshRealVariable("z");
+    MVP p;
+    MVP q;
+
+    // Fixtures are constructed during static initialization, hence we can not do polynomial arithmetic in the constructor.
+    void SetUp(const benchmark::State&) override {
+        p = carl::pow(MVP(x) * Coeff(3) + MVP(y) * Coeff(Coeff(1) / Coeff(2)) + MVP(z) + Coeff(7), 4);
+        q = carl::pow(MVP(x) - MVP(y) * Coeff(5) + MVP(z) * Coeff(Coeff(2) / Coeff(3)), 4);
+    }
+};
+
+BENCHMARK_TEMPLATE_F(MVP_Coeff_Fixture, MVP_Mul_mpq, mpq_class)(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(p * q);
+    }
+}
+
+BENCHMARK_TEMPLATE_F(MVP_Coeff_Fixture, MVP_Mul_Hybrid, carl::HybridRational)(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(p * q);
+    }
+}
+
+BENCHMARK_TEMPLATE_F(MVP_Coeff_Fixture, MVP_Add_mpq, mpq_class)(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(p + q);
+    }
+}
+
+BENCHMARK_TEMPLATE_F(MVP_Coeff_Fixture, MVP_Add_Hybrid, carl::HybridRational)(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(p + q);
+    }
+}
@@ -1,41 +1,87 @@
 #include <benchmark/benchmark.h>
 
-#include <carl/ran/real_roots.h>
-#include <carl/ran/ran.h>
+#include <carl/ran/interval/ran_interval.h>
+#include <carl/ran/interval/ran_interval_real_roots.h>
+#include <carl/ran/dyadic/ran_dyadic.h>
+#include <carl/ran/dyadic/ran_dyadic_real_roots.h>
 
 using Poly = carl::UnivariatePolynomial<mpq_class>;
+using IntervalRAN = carl::real_algebraic_number_interval<mpq_class>;
+using DyadicRAN = carl::real_algebraic_number_dyadic<mpq_class>;
 
 class RAN_Fixture: public benchmark::Fixture {
 public:
 	carl::Variable x = carl::freshRealVariable("x");
-	Poly p = Poly(x, {-2, 0, 1}); // * Poly(x, {-2, 0, 0, 1});
+	// sqrt(2) and 2^(1/3) in (1, 2)
+	Poly p = Poly(x, {-2, 0, 1});
+	Poly q = Poly(x, {-2, 0, 0, 1});
+	carl::Interval<mpq_class> i = carl::Interval<mpq_class>(1, carl::BoundType::STRICT, 2, carl::BoundType::STRICT);
+	// a root of the Wilkinson-like polynomial (x-1)(x-2)...(x-8) - 1/3 with large coefficients
+	Poly w = Poly(x, {mpq_class(40319, 1) + mpq_class(2, 3), -109584, 118124, -67284, 22449, -4536, 546, -36, 1});
 };
 
-BENCHMARK_F(RAN_Fixture, RAN_Create)(benchmark::State& state) {
-	auto rans = carl::real_roots(p);
-	auto p = rans[0].polynomial();
-	auto i = rans[0].interval();
+template<typename RAN>
+void create(benchmark::State& state, const Poly& p, const carl::Interval<mpq_class>& i) {
 	for (auto _ : state) {
-		auto ran = carl::RealAlgebraicNumber<mpq_class>(p, i);
+		RAN ran(p, i);
+		benchmark::DoNotOptimize(ran);
 	}
 }
 
-BENCHMARK_F(RAN_Fixture, RAN_CreateRefineOld)(benchmark::State& state) {
-	auto rans = carl::real_roots(p);
-	auto p = rans[0].polynomial();
-	auto i = rans[0].interval();
+template<typename RAN>
+void refine(benchmark::State& state, const Poly& p, const carl::Interval<mpq_class>& i) {
 	for (auto _ : state) {
-		auto ran = carl::RealAlgebraicNumber<mpq_class>(p, i);
-		ran.refine(false);
+		RAN ran(p, i);
+		for (int n = 0; n < state.range(0); ++n) {
+			ran.refine();
+		}
 	}
 }
 
-BENCHMARK_F(RAN_Fixture, RAN_CreateRefineNew)(benchmark::State& state) {
-	auto rans = carl::real_roots(p);
-	auto p = rans[0].polynomial();
-	auto i = rans[0].interval();
+template<typename RAN>
+void compare(benchmark::State& state, const Poly& p, const Poly& q, const carl::Interval<mpq_class>& i) {
 	for (auto _ : state) {
-		auto ran = carl::RealAlgebraicNumber<mpq_class>(p, i);
-		ran.refine(true);
+		RAN a(p, i);
+		RAN b(q, i);
+		benchmark::DoNotOptimize(a < b);
+	}
+}
+
+template<typename RAN>
+void compare_rational(benchmark::State& state, const Poly& p, const carl::Interval<mpq_class>& i) {
+	RAN ran(p, i);
+	mpq_class pivot(1414213, 1000000);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(ran > pivot);
+	}
+}
+
+BENCHMARK_F(RAN_Fixture, Interval_Create)(benchmark::State& state) { create<IntervalRAN>(state, p, i); }
+BENCHMARK_F(RAN_Fixture, Dyadic_Create)(benchmark::State& state) { create<DyadicRAN>(state, p, i); }
+
+BENCHMARK_DEFINE_F(RAN_Fixture, Interval_Refine)(benchmark::State& state) { refine<IntervalRAN>(state, p, i); }
+BENCHMARK_DEFINE_F(RAN_Fixture, Dyadic_Refine)(benchmark::State& state) { refine<DyadicRAN>(state, p, i); }
+BENCHMARK_REGISTER_F(RAN_Fixture, Interval_Refine)->Arg(8)->Arg(64)->Arg(256);
+BENCHMARK_REGISTER_F(RAN_Fixture, Dyadic_Refine)->Arg(8)->Arg(64)->Arg(256);
+
+BENCHMARK_DEFINE_F(RAN_Fixture, Interval_RefineLarge)(benchmark::State& state) { refine<IntervalRAN>(state, w, carl::Interval<mpq_class>(mpq_class(3, 2), carl::BoundType::STRICT, mpq_class(5, 2), carl::BoundType::STRICT)); }
+BENCHMARK_DEFINE_F(RAN_Fixture, Dyadic_RefineLarge)(benchmark::State& state) { refine<DyadicRAN>(state, w, carl::Interval<mpq_class>(mpq_class(3, 2), carl::BoundType::STRICT, mpq_class(5, 2), carl::BoundType::STRICT)); }
+BENCHMARK_REGISTER_F(RAN_Fixture, Interval_RefineLarge)->Arg(8)->Arg(64)->Arg(256);
+BENCHMARK_REGISTER_F(RAN_Fixture, Dyadic_RefineLarge)->Arg(8)->Arg(64)->Arg(256);
+
+BENCHMARK_F(RAN_Fixture, Interval_Compare)(benchmark::State& state) { compare<IntervalRAN>(state, p, q, i); }
+BENCHMARK_F(RAN_Fixture, Dyadic_Compare)(benchmark::State& state) { compare<DyadicRAN>(state, p, q, i); }
+
+BENCHMARK_F(RAN_Fixture, Interval_CompareRational)(benchmark::State& state) { compare_rational<IntervalRAN>(state, p, i); }
+BENCHMARK_F(RAN_Fixture, Dyadic_CompareRational)(benchmark::State& state) { compare_rational<DyadicRAN>(state, p, i); }
+
+BENCHMARK_F(RAN_Fixture, Interval_RealRoots)(benchmark::State& state) {
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(carl::ran::interval::real_roots(w));
+	}
+}
+BENCHMARK_F(RAN_Fixture, Dyadic_RealRoots)(benchmark::State& state) {
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(carl::ran::dyadic::real_roots(w));
 	}
 }
@@ -9,7 +9,8 @@ using IntegerTypes = testing::Types<
 	#ifdef USE_CLN_NUMBERS
 	cln::cl_I,
 	#endif
-	mpz_class
+	mpz_class,
+	carl::HybridInteger
 >;
 
 using RationalTypes = testing::Types<
@@ -22,6 +23,8 @@ using RationalTypes = testing::Types<
 using NumberTypes = testing::Types<
 	mpz_class,
 	mpq_class,
+	carl::HybridInteger,
+	carl::HybridRational,
 	#ifdef USE_CLN_NUMBERS
 	cln::cl_I,
 	cln::cl_RA,
@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+#include <carl/numbers/numbers.h>
+#include <carl/core/MultivariatePolynomial.h>
+#include <carl/core/UnivariatePolynomial.h>
+#include <carl/core/VariablePool.h>
+#include <carl/core/polynomialfunctions/Derivative.h>
+#include <carl/core/polynomialfunctions/Division.h>
+#include <carl/core/polynomialfunctions/Evaluation.h>
+#include <carl/core/polynomialfunctions/GCD.h>
+#include <carl/core/polynomialfunctions/Power.h>
+#include <carl/core/polynomialfunctions/Resultant.h>
+#include <carl/core/polynomialfunctions/to_univariate_polynomial.h>
+
+#include <limits>
+
+using carl::HybridInteger;
+using carl::HybridRational;
+
+TEST(Hybrid, IntegerOverflow)
+{
+	const carl::sint max = std::numeric_limits<carl::sint>::max();
+	HybridInteger a(max);
+	EXPECT_TRUE(a.isSmall());
+	HybridInteger b = a + 1;
+	EXPECT_FALSE(b.isSmall());
+	EXPECT_EQ(mpz_class(static_cast<signed long>(max)) + 1, b.toMpz());
+	b -= 1;
+	EXPECT_TRUE(b.isSmall());
+	EXPECT_EQ(a, b);
+
+	HybridInteger c = a * a;
+	EXPECT_FALSE(c.isSmall());
+	EXPECT_EQ(mpz_class(static_cast<signed long>(max)) * mpz_class(static_cast<signed long>(max)), c.toMpz());
+	EXPECT_EQ(a, c / a);
+	EXPECT_TRUE((c / a).isSmall());
+
+	// The smallest native integer is never stored inline.
+	HybridInteger d(std::numeric_limits<carl::sint>::min());
+	EXPECT_FALSE(d.isSmall());
+	EXPECT_TRUE(carl::abs(d) > a);
+	EXPECT_EQ(-a - 1, d);
+}
+
+TEST(Hybrid, IntegerOperations)
+{
+	EXPECT_EQ(HybridInteger(4), carl::gcd(HybridInteger(12), HybridInteger(-8)));
+	EXPECT_EQ(HybridInteger(24), carl::lcm(HybridInteger(12), HybridInteger(8)));
+	EXPECT_EQ(HybridInteger(-1), carl::mod(HybridInteger(-7), HybridInteger(3)));
+	EXPECT_EQ(HybridInteger(-2), carl::quotient(HybridInteger(-7), HybridInteger(3)));
+	HybridInteger q;
+	HybridInteger r;
+	carl::divide(HybridInteger(-7), HybridInteger(3), q, r);
+	EXPECT_EQ(HybridInteger(-3), q);
+	EXPECT_EQ(HybridInteger(2), r);
+	EXPECT_EQ(HybridInteger("1267650600228229401496703205376"), carl::pow(HybridInteger(2), 100));
+	EXPECT_EQ(101u, carl::bitsize(carl::pow(HybridInteger(2), 100)));
+	EXPECT_EQ(3u, carl::bitsize(HybridInteger(-5)));
+	EXPECT_EQ(carl::sint(-5), carl::toInt<carl::sint>(HybridInteger(-5)));
+	EXPECT_EQ(std::hash<mpz_class>()(mpz_class(-17)), std::hash<HybridInteger>()(HybridInteger(-17)));
+}
+
+TEST(Hybrid, Rational)
+{
+	HybridRational a = HybridRational(2) / 6;
+	EXPECT_TRUE(a.isSmall());
+	EXPECT_EQ(HybridInteger(1), carl::getNum(a));
+	EXPECT_EQ(HybridInteger(3), carl::getDenom(a));
+	EXPECT_EQ(HybridRational(1) / 2, a + HybridRational(1) / 6);
+	EXPECT_EQ(HybridRational(-1) / 12, a * (HybridRational(-1) / 4));
+	EXPECT_EQ(HybridRational(-4) / 3, a / (HybridRational(-1) / 4));
+	EXPECT_TRUE(a < HybridRational(1) / 2);
+	EXPECT_TRUE(-a < 0);
+	EXPECT_EQ(HybridInteger(0), carl::floor(a));
+	EXPECT_EQ(HybridInteger(1), carl::ceil(a));
+	EXPECT_EQ(HybridInteger(-1), carl::floor(-a));
+	EXPECT_EQ(HybridInteger(0), carl::ceil(-a));
+	EXPECT_EQ(HybridInteger(1), carl::round(HybridRational(1) / 2));
+	EXPECT_EQ(HybridInteger(0), carl::round(HybridRational(-1) / 2));
+	EXPECT_EQ(carl::parse<HybridRational>("1/3"), a);
+	EXPECT_EQ("(-1/3)", carl::toString(-a));
+	EXPECT_EQ(std::hash<mpq_class>()(mpq_class(-1, 3)), std::hash<HybridRational>()(-a));
+
+	HybridRational root;
+	EXPECT_TRUE(carl::sqrt_exact(HybridRational(9) / 16, root));
+	EXPECT_EQ(HybridRational(3) / 4, root);
+	EXPECT_FALSE(carl::sqrt_exact(HybridRational(2), root));
+}
+
+TEST(Hybrid, RationalOverflow)
+{
+	const carl::sint max = std::numeric_limits<carl::sint>::max();
+	HybridRational a = HybridRational(1) / max;
+	HybridRational b = HybridRational(1) / (max - 1);
+	HybridRational sum = a + b;
+	EXPECT_FALSE(sum.isSmall());
+	EXPECT_EQ(mpq_class(1, max) + mpq_class(1, max - 1), sum.toMpq());
+	sum -= b;
+	EXPECT_TRUE(sum.isSmall());
+	EXPECT_EQ(a, sum);
+	EXPECT_TRUE(a < b);
+	EXPECT_EQ(a, carl::reciprocal(HybridRational(max)));
+	EXPECT_EQ(HybridRational(1), a * max);
+	EXPECT_EQ(carl::pow(mpq_class(2, 3), 80), carl::pow(HybridRational(2) / 3, 80).toMpq());
+}
+
+TEST(Hybrid, Polynomial)
+{
+	using Poly = carl::MultivariatePolynomial<HybridRational>;
+	carl::Variable x = carl::freshRealVariable("x");
+	carl::Variable y = carl::freshRealVariable("y");
+	Poly p = Poly(x) * HybridRational(1) / 2 + Poly(y);
+	Poly r = Poly(x) - Poly(y);
+	Poly q = p * r;
+	EXPECT_EQ(Poly(x) * Poly(x) * (HybridRational(1) / 2) + Poly(x) * Poly(y) * (HybridRational(1) / 2) - Poly(y) * Poly(y), q);
+	EXPECT_EQ(HybridRational(2), carl::evaluate(q, std::map<carl::Variable, HybridRational>({{x, 2}, {y, 1}})));
+	EXPECT_EQ(Poly(x) + Poly(y) * (HybridRational(1) / 2), carl::derivative(q, x));
+	Poly quot;
+	EXPECT_TRUE(carl::try_divide(q, p, quot));
+	EXPECT_EQ(r, quot);
+#ifdef USE_COCOA
+	Poly g = carl::gcd(q, p * HybridRational(3));
+	EXPECT_EQ(1u, g.totalDegree());
+	EXPECT_TRUE(carl::try_divide(p, g, quot));
+#endif
+
+	auto uq = carl::to_univariate_polynomial(q, x);
+	auto up = carl::to_univariate_polynomial(p, x);
+	EXPECT_TRUE(carl::isZero(carl::resultant(uq, up)));
+
+	Poly big = carl::pow(Poly(x) + HybridRational(std::numeric_limits<carl::sint>::max()), 3);
+	EXPECT_EQ(carl::pow(mpq_class(std::numeric_limits<carl::sint>::max()), 3).get_num(), carl::getNum(big.constantPart()).toMpz());
+}
@@ -0,0 +1,130 @@
+#include "gtest/gtest.h"
+
+#include "carl/core/MultivariatePolynomial.h"
+#include "carl/core/VariablePool.h"
+#include "carl/util/ArenaAllocator.h"
+
+#include "../Common.h"
+
+#include <thread>
+#include <vector>
+
+using namespace carl;
+
+TEST(ArenaAllocator, MemoryArena)
+{
+	MemoryArena arena(128);
+	void* a = arena.allocate(24, 8);
+	void* b = arena.allocate(1000, 64);
+	EXPECT_TRUE(arena.owns(a));
+	EXPECT_TRUE(arena.owns(b));
+	EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(b) % 64);
+	EXPECT_EQ(1024u, arena.used());
+	EXPECT_GE(arena.reserved(), arena.used());
+	int local = 0;
+	EXPECT_FALSE(arena.owns(&local));
+	// The most recent allocation is reused.
+	arena.deallocate(b, 1000);
+	EXPECT_EQ(b, arena.allocate(1000, 64));
+	arena.release();
+	EXPECT_EQ(0u, arena.reserved());
+	EXPECT_FALSE(arena.owns(a));
+	// Pointers are found among many chunks.
+	std::vector<void*> blocks;
+	for (std::size_t i = 0; i < 100; ++i) blocks.push_back(arena.allocate(100 * i + 1));
+	for (void* p: blocks) EXPECT_TRUE(arena.owns(p));
+	EXPECT_FALSE(arena.owns(&local));
+}
+
+TEST(ArenaAllocator, SlabPool)
+{
+	std::vector<int, ArenaAllocator<int>> v;
+	for (int i = 0; i < 1000; ++i) v.push_back(i);
+	std::vector<int, ArenaAllocator<int>> w(v);
+	v.clear();
+	v.shrink_to_fit();
+	for (int i = 0; i < 1000; ++i) EXPECT_EQ(i, w[std::size_t(i)]);
+}
+
+TEST(ArenaAllocator, OverAligned)
+{
+	struct alignas(256) Aligned {
+		char data[8];
+	};
+	// Over-aligned blocks bypass the slab pool and use the aligned operator new.
+	std::vector<Aligned, ArenaAllocator<Aligned>> v(3);
+	EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(v.data()) % 256);
+	v.resize(100);
+	EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(v.data()) % 256);
+	{
+		ScopedArena scope;
+		std::vector<Aligned, ArenaAllocator<Aligned>> w(5);
+		EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(w.data()) % 256);
+	}
+}
+
+TEST(ArenaAllocator, SlabPoolThreads)
+{
+	// Blocks outlive the thread that allocated them and are freed by another thread.
+	std::vector<std::vector<int, ArenaAllocator<int>>> results(4);
+	std::vector<std::thread> threads;
+	for (std::size_t t = 0; t < results.size(); ++t) {
+		threads.emplace_back([&results,t](){
+			std::vector<std::vector<int, ArenaAllocator<int>>> temporary;
+			for (int i = 0; i < 100; ++i) temporary.emplace_back(std::size_t(i % 50 + 1), i);
+			results[t] = std::vector<int, ArenaAllocator<int>>(10, int(t));
+		});
+	}
+	for (auto& t: threads) t.join();
+	for (std::size_t t = 0; t < results.size(); ++t) {
+		EXPECT_EQ(std::vector<int>(10, int(t)), std::vector<int>(results[t].begin(), results[t].end()));
+	}
+	results.clear();
+}
+
+TEST(ArenaAllocator, ScopedArena)
+{
+	EXPECT_EQ(nullptr, ScopedArena::active());
+	{
+		ScopedArena outer;
+		EXPECT_EQ(&outer, ScopedArena::active());
+		std::vector<int, ArenaAllocator<int>> v(100, 1);
+		EXPECT_TRUE(outer.arena().owns(v.data()));
+		{
+			ScopedArena inner;
+			EXPECT_EQ(&outer, inner.previous());
+			std::vector<int, ArenaAllocator<int>> w(100, 2);
+			EXPECT_TRUE(inner.arena().owns(w.data()));
+			// Memory of the outer scope can be freed within the inner scope.
+			v = std::vector<int, ArenaAllocator<int>>();
+		}
+		EXPECT_EQ(&outer, ScopedArena::active());
+		EXPECT_EQ(0u, outer.arena().used());
+	}
+	EXPECT_EQ(nullptr, ScopedArena::active());
+}
+
+TEST(ArenaAllocator, Polynomial)
+{
+	using ArenaPoly = MultivariatePolynomial<Rational, GrLexOrdering, StdMultivariatePolynomialPolicies<NoReasons, ArenaPolynomialAllocator>>;
+	using Poly = MultivariatePolynomial<Rational>;
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+
+	Poly expected = Poly(x) * Poly(x) * Poly(x) + Rational(3) * Poly(x) * Poly(x) * Poly(y) + Rational(3) * Poly(x) * Poly(y) * Poly(y) + Poly(y) * Poly(y) * Poly(y);
+	Poly result;
+	{
+		ScopedArena scope;
+		ArenaPoly p = ArenaPoly(x) + ArenaPoly(y);
+		ArenaPoly q = p * p * p;
+		EXPECT_TRUE(scope.arena().owns(q.getTerms().data()));
+		EXPECT_EQ(ArenaPoly(x) * Rational(3) * ArenaPoly(x) * ArenaPoly(y), q - ArenaPoly(x) * ArenaPoly(x) * ArenaPoly(x) - ArenaPoly(y) * ArenaPoly(y) * (ArenaPoly(y) + Rational(3) * ArenaPoly(x)));
+		// Copy the result out of the arena.
+		result = Poly(Poly::TermsType(q.begin(), q.end()));
+	}
+	EXPECT_EQ(expected, result);
+
+	// Without a scope, the terms are taken from the slab pool.
+	ArenaPoly p = ArenaPoly(x) - ArenaPoly(y);
+	EXPECT_EQ(ArenaPoly(x) * ArenaPoly(x) - ArenaPoly(y) * ArenaPoly(y), p * (ArenaPoly(x) + ArenaPoly(y)));
+}